@@ -254,6 +254,60 @@ static inline int PrintBitfield
 				0, 8*bit_field_size-1, use_ranges, 1, 0 );
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    Bitmap_t			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// [[Bitmap_t]]
+// A bit field (bit order like SetBit() & co) with a summary layer: a Fenwick
+// tree over the number of set bits of each block of BITMAP_BLOCK_BITS bits.
+// It supports rank, select and the search of the next set or cleared bit
+// in O(log n). The bits are modified only by the functions below.
+
+#define BITMAP_BLOCK_BITS 512
+
+typedef struct Bitmap_t
+{
+    u8		*field;		// bit field, multiple of block size, padding is 0
+    uint	n_bits;		// number of usable bits
+    uint	n_set;		// total number of set bits
+    uint	n_block;	// number of blocks
+    u32		*tree;		// Fenwick tree of 'n_block' set bit counters,
+				// 1-based => 'tree[0]' is unused
+}
+Bitmap_t;
+
+//-----------------------------------------------------------------------------
+
+void InitializeBitmap ( Bitmap_t *bm, uint n_bits );
+void ResetBitmap ( Bitmap_t *bm );
+void ClearAllBitmap ( Bitmap_t *bm );
+
+static inline bool TestBitmap ( const Bitmap_t *bm, uint bit_num )
+	{ DASSERT(bm); return bit_num < bm->n_bits && TestBit(bm->field,bit_num); }
+
+// change a single bit and return the previous state, ignore invalid 'bit_num'
+bool SetBitmap   ( Bitmap_t *bm, uint bit_num );
+bool ClearBitmap ( Bitmap_t *bm, uint bit_num );
+
+// number of set bits in range 0 (inclusive) to 'bit_num' (exclusive)
+uint RankBitmap ( const Bitmap_t *bm, uint bit_num );
+static inline uint Rank0Bitmap ( const Bitmap_t *bm, uint bit_num )
+{
+    DASSERT(bm);
+    if ( bit_num > bm->n_bits )
+	bit_num = bm->n_bits;
+    return bit_num - RankBitmap(bm,bit_num);
+}
+
+// index of set|cleared bit number 'rank' (0-based), or -1 if not exist
+int SelectBitmap  ( const Bitmap_t *bm, uint rank );
+int Select0Bitmap ( const Bitmap_t *bm, uint rank );
+
+// index of first set|cleared bit >= 'bit_num', or -1 if not exist
+int FindNextSetBitmap   ( const Bitmap_t *bm, uint bit_num );
+int FindNextClearBitmap ( const Bitmap_t *bm, uint bit_num );
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////		low level endian conversions		///////////////
@@ -591,7 +645,7 @@ void write_le64 ( void * le_data_ptr, u64 data );
 void write_lef4 ( void * le_data_ptr, float data );
 void write_lef8 ( void * le_data_ptr, double data );
 
-// convert lists
+// convert lists, 'dest' and 'src' may be unaligned; 'dest==src' is allowed
 void be16n ( u16     * dest, const u16     * src, int n );
 void be32n ( u32     * dest, const u32     * src, int n );
 void bef4n ( float32 * dest, const float32 * src, int n );
@@ -606,6 +660,11 @@ void write_le16n ( u16     * dest, const u16     * src, int n );
 void write_le32n ( u32     * dest, const u32     * src, int n );
 void write_lef4n ( float32 * dest, const float32 * src, int n );
 
+// swap the bytes of 'n' elements in place
+void dswap16n ( void * data, int n );
+void dswap32n ( void * data, int n );
+void dswap64n ( void * data, int n );
+
 //-----------------------------------------------------------------------------
 // [[endian_func_t]]
 
@@ -1282,6 +1341,26 @@ void * MemDupMemPool  ( MemPool_t *mp, cvp source, uint size );
 static inline void * StrDupMemPool  ( MemPool_t *mp, ccp source )
   { DASSERT(mp); return source ? MemDupMemPool(mp,source,strlen(source)) : 0; }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    mirror maps			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void * AllocMirrorMap
+(
+    // Map the same anonymous memory file twice, back to back. Then the bytes
+    // at 'ptr+i' and 'ptr+i+*size' are identical for all 0 <= i < *size.
+    // Returns NULL if not supported or on error.
+
+    uint	*size		// in: minimal size, out: size rounded up to pages
+);
+
+void FreeMirrorMap
+(
+    void	*ptr,		// NULL or pointer returned by AllocMirrorMap()
+    uint	size		// size returned by AllocMirrorMap()
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    CircBuf_t			///////////////
@@ -1294,12 +1373,14 @@ typedef struct CircBuf_t
     uint pos;		// position of first valid byte
     uint used;		// used bytes in buffer
     uint size;		// size of 'buf'
+    bool mirror;	// true: 'buf' is NULL or a mirrored mapping of 2*'size' bytes
 }
 CircBuf_t;
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void InitializeCircBuf ( CircBuf_t *cb, uint size );
+void InitializeMirrorCircBuf ( CircBuf_t *cb, uint size );
 void ResetCircBuf  ( CircBuf_t *cb );
 uint WriteCircBuf  ( CircBuf_t *cb, cvp data, uint size );
 uint PeakCircBuf   ( CircBuf_t *cb, char *buf, uint buf_size );
@@ -1308,6 +1389,14 @@ uint DropCircBuf   ( CircBuf_t *cb, uint size );
 void ClearCircBuf  ( CircBuf_t *cb );
 uint PurgeCircBuf  ( CircBuf_t *cb );
 
+static inline ccp GetPtrCircBuf ( const CircBuf_t *cb )
+{
+    // Returns NULL or a pointer to the first valid byte. If the buffer is
+    // mirrored, all 'cb->used' bytes are contiguous behind this pointer.
+    DASSERT(cb);
+    return cb->buf ? cb->buf + cb->pos : 0;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			PrintMode_t			///////////////
@@ -2058,6 +2147,130 @@ static inline mem_t GetFastBufMem ( const FastBuf_t *fb )
 char * MoveFromFastBufString ( FastBuf_t *fb );
 mem_t  MoveFromFastBufMem    ( FastBuf_t *fb );
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    SegBuf_t			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// [[SegBufChunk_t]]
+
+// SegBuf_t is a segmented variant of FastBuf_t for large outputs. Data is
+// stored in a chain of chunks, so that append and insert never copy data
+// that is already stored. The data is only flattened on explicit request.
+
+#define SEGBUF_DEFAULT_CHUNK_SIZE 0x10000
+
+typedef struct SegBufChunk_t
+{
+    struct SegBufChunk_t *next;	// NULL or next chunk
+    uint	used;		// number of used bytes of 'data'
+    uint	size;		// size of 'data'
+    char	data[];		// data
+}
+SegBufChunk_t;
+
+//-----------------------------------------------------------------------------
+// [[SegBuf_t]]
+
+typedef struct SegBuf_t
+{
+    SegBufChunk_t *first;	// NULL or first chunk
+    SegBufChunk_t *last;	// NULL or last chunk, the only one to append
+    uint	n_chunks;	// number of chunks in chain
+    uint	chunk_size;	// size for new chunks, 0: use default
+    u64		len;		// total number of used bytes
+}
+SegBuf_t;
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline void InitializeSegBuf ( SegBuf_t *sb, uint chunk_size )
+	{ DASSERT(sb); memset(sb,0,sizeof(*sb)); sb->chunk_size = chunk_size; }
+
+void ResetSegBuf ( SegBuf_t *sb );
+
+static inline u64 GetSegBufLen ( const SegBuf_t *sb )
+	{ DASSERT(sb); return sb->len; }
+
+char * GetSpaceSegBuf
+(
+    // returns a pointer to 'size' contiguous bytes at the end of the buffer
+
+    SegBuf_t	*sb,		// valid segmented buffer
+    uint	size		// number of bytes to reserve
+);
+
+void AppendSegBuf
+(
+    SegBuf_t	*sb,		// valid segmented buffer
+    cvp		source,		// data to append
+    int		size		// size of 'source', if <0: use strlen(source)
+);
+
+static inline void AppendMemSegBuf ( SegBuf_t *sb, const mem_t mem )
+	{ AppendSegBuf(sb,mem.ptr,mem.len); }
+
+static inline void AppendCharSegBuf ( SegBuf_t *sb, char ch )
+	{ *GetSpaceSegBuf(sb,1) = ch; }
+
+static inline void AppendFastBufSegBuf ( SegBuf_t *sb, const FastBuf_t *fb )
+	{ DASSERT(fb); AppendSegBuf(sb,fb->buf,fb->ptr-fb->buf); }
+
+uint PrintSegBuf
+(
+    // returns the number of appended bytes
+
+    SegBuf_t	*sb,		// valid segmented buffer
+    ccp		format,		// format string for vsnprintf()
+    ...				// arguments for 'vsnprintf(format,...)'
+)
+__attribute__ ((__format__(__printf__,2,3)));
+
+u64 InsertSegBuf
+(
+    // Insert data at 'index'. The chunk at 'index' is split, so that only
+    // the bytes behind 'index' of this single chunk are copied.
+    // Returns the normalized index, see CheckIndex1().
+
+    SegBuf_t	*sb,		// valid segmented buffer
+    s64		index,		// index of insertion, <0: relative to end
+    cvp		source,		// data to insert
+    int		size		// size of 'source', if <0: use strlen(source)
+);
+
+//-----------------------------------------------------------------------------
+
+struct iovec;
+
+uint GetIOVecSegBuf
+(
+    // Store pointers to the chunks into 'iov' (empty chunks are skipped).
+    // Returns the number of needed vector elements. If the result is
+    // larger than 'n_iov', only the first 'n_iov' elements are stored.
+
+    const SegBuf_t *sb,		// valid segmented buffer
+    struct iovec *iov,		// NULL or destination vector
+    uint	n_iov		// number of elements of 'iov'
+);
+
+s64 WriteSegBuf
+(
+    // write all data by writev() and return the number of written bytes.
+    // If an error (e.g. EAGAIN for non-blocking files) stops the writing,
+    // the number of bytes written so far is returned, or -1 if nothing
+    // was written. 'errno' is set in both cases.
+
+    int		fd,		// valid file descriptor
+    const SegBuf_t *sb		// valid segmented buffer
+);
+
+//-----------------------------------------------------------------------------
+// The allocated result is always terminated by an additional NULL byte.
+// SegBuf_t itself is reset, similar to ResetSegBuf()
+// Because 'mem_t.len' is an int, buffers of INT_MAX or more bytes are
+// rejected: {NULL,0} is returned and 'sb' is left untouched.
+
+mem_t MoveFromSegBufMem ( SegBuf_t *sb );
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			 MatchPattern()			///////////////
@@ -2081,6 +2294,88 @@ bool MatchPattern
     char	path_sep	// path separator character, standard is '/'
 );
 
+//-----------------------------------------------------------------------------
+// [[Pattern_t]]
+
+typedef enum PatternMode_t
+{
+    PATMD_ALL,		// empty pattern, match all
+    PATMD_PREFIX,	// literal, text must begin with 'literal'
+    PATMD_EQUAL,	// literal, text must be equal to 'literal'
+    PATMD_SUFFIX,	// literal, text must end with 'literal'
+    PATMD_CONTAINS,	// literal, text must contain 'literal'
+    PATMD_GENERIC,	// use MatchPatternHelper()
+}
+__attribute__ ((packed)) PatternMode_t;
+
+typedef struct Pattern_t
+{
+    // A compiled pattern for MatchPattern() or MatchPatternFull().
+    // Literal patterns are resolved by string functions. Other patterns are
+    // prefiltered by a literal prefix and by a required literal.
+
+    char	*pattern;	// alloced copy of the source pattern
+    ccp		generic;	// GENERIC: pattern behind 'prefix'
+    mem_t	literal;	// alloced literal text, not for ALL
+				//   GENERIC: required part of text or empty
+    uint	prefix_len;	// GENERIC+anchored: length of literal prefix
+    char	path_sep;	// path separator character
+    PatternMode_t mode;		// PATMD_*
+    bool	anchored;	// GENERIC: match at text begin only
+    bool	skip_end;	// GENERIC: don't need to match until text end
+    bool	dollar;		// EQUAL, SUFFIX: also accept 'literal'+"$"
+}
+Pattern_t;
+
+//-----------------------------------------------------------------------------
+
+void SetupPattern
+(
+    // compile 'pattern' for the rules of MatchPattern()
+
+    Pattern_t	*pat,		// pattern object, initialized by this function
+    ccp		pattern,	// NULL or pattern text
+    char	path_sep	// path separator character, standard is '/'
+);
+
+void SetupPatternFull
+(
+    // compile 'pattern' for the rules of MatchPatternFull()
+
+    Pattern_t	*pat,		// pattern object, initialized by this function
+    ccp		pattern		// NULL or pattern text
+);
+
+void ResetPattern ( Pattern_t *pat );
+
+bool MatchCompiledPattern
+(
+    const Pattern_t *pat,	// valid pattern, set up by SetupPattern*()
+    ccp		text		// NULL or raw text
+);
+
+uint MatchPatternMemList
+(
+    // match all elements of 'ml' and return the number of matches
+
+    const Pattern_t *pat,	// valid pattern, set up by SetupPattern*()
+    const mem_list_t *ml,	// list of NULL terminated strings
+    bool	*result		// NULL or store results here, 'ml->used' elements
+);
+
+struct StringField_t;
+
+uint MatchPatternStringField
+(
+    // match all elements of 'sf' and return the number of matches
+
+    const Pattern_t *pat,	// valid pattern, set up by SetupPattern*()
+    const struct StringField_t *sf, // list of strings
+    bool	*result		// NULL or store results here, 'sf->used' elements
+);
+
+//-----------------------------------------------------------------------------
+
 char * MatchRuleLine
 (
     // returns a pointer to the first non scanned char
@@ -2378,12 +2673,32 @@ typedef struct ContainerData_t
 {
     u8			*data;		// data
     uint		size;		// size of 'data'
-    int			ref_count;	// reference counter
-    int			protect_count;	// >0: don't modify data
+    int			ref_count;	// reference counter, modified atomic
+    int			protect_count;	// >0: don't modify data, modified atomic
     bool		data_alloced;	// true: free data
 
 } ContainerData_t;
 
+//-----------------------------------------------------------------------------
+// The counters of ContainerData_t are modified by atomic operations, so that
+// container-data can be shared by containers of different threads.
+// Each Container_t itself must still be used by only one thread.
+
+static inline int IncRefContainerData ( ContainerData_t *cdata )
+	{ return __atomic_add_fetch(&cdata->ref_count,1,__ATOMIC_RELAXED); }
+
+static inline int DecRefContainerData ( ContainerData_t *cdata )
+	{ return __atomic_sub_fetch(&cdata->ref_count,1,__ATOMIC_ACQ_REL); }
+
+static inline int AddProtectContainerData ( ContainerData_t *cdata, int add )
+	{ return __atomic_add_fetch(&cdata->protect_count,add,__ATOMIC_ACQ_REL); }
+
+static inline int GetRefContainerData ( const ContainerData_t *cdata )
+	{ return __atomic_load_n(&cdata->ref_count,__ATOMIC_ACQUIRE); }
+
+static inline int GetProtectContainerData ( const ContainerData_t *cdata )
+	{ return __atomic_load_n(&cdata->protect_count,__ATOMIC_ACQUIRE); }
+
 //-----------------------------------------------------------------------------
 // [[Container_t]]
 
@@ -2537,8 +2852,9 @@ void FreeContainerData
 
 static inline bool ModificationAllowed ( const Container_t *c )
 	{ return c && c->cdata
-		&& ( c->cdata->ref_count <= 1
-			|| c->cdata->protect_count <= ( c->protect_level > 0 ) );
+		&& ( GetRefContainerData(c->cdata) <= 1
+			|| GetProtectContainerData(c->cdata)
+				<= ( c->protect_level > 0 ) );
 	}
 
 //-----------------------------------------------------------------------------
@@ -2553,6 +2869,30 @@ bool ModifyAllContainer
 
 //-----------------------------------------------------------------------------
 
+Container_t * ShareContainer
+(
+    // Share the container-data of 'src' with 'c' without copying (zero-copy).
+    // Both containers are protected, so that the first modification of any
+    // of them by ModifyAllContainer() or ModifyContainer() creates a private
+    // copy (copy-on-write). 'c' and 'src' may be used by different threads
+    // after this call. Returns 'c' or the alloced container.
+
+    Container_t		*c,		// valid container, alloc one if NULL
+    Container_t		*src		// NULL or valid source container
+);
+
+//-----------------------------------------------------------------------------
+
+u8 * WriteAccessContainer
+(
+    // Call ModifyAllContainer() to unshare the data if necessary and return
+    // a pointer to the writable data, or NULL if 'c' has no data.
+
+    Container_t		*c		// NULL or valid container
+);
+
+//-----------------------------------------------------------------------------
+
 bool ModifyContainer
 (
     // prepare modification of container-data, create an extract if necessary
@@ -2758,8 +3098,14 @@ __attribute__ ((__format__(__printf__,7,8)));
 ///////////////////////////////////////////////////////////////////////////////
 
 extern const u32 TableCRC32[0x100];
+extern const u32 TableCRC32Slice8[8][0x100];
 u32 CalcCRC32 ( u32 crc, cvp buf, uint size );
 
+// Return the CRC32 of the concatenation of 2 data blocks:
+// 'crc1' is the CRC32 of block 1, 'crc2' and 'len2' are CRC32 and size of
+// block 2. Blocks can be checksummed independently and combined later.
+u32 CombineCRC32 ( u32 crc1, u32 crc2, u64 len2 );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 extern const u16 TableCP1252_80[0x20];
@@ -2868,6 +3214,20 @@ char * PrintEscapedString
     uint	*dest_len	// not NULL: Store length of result here
 );
 
+//-----------------------------------------------------------------------------
+
+uint PrintEscapedFastBuf
+(
+    // Append the escaped string to 'fb' without size limit.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,		// valid destination buffer
+    ccp		source,		// NULL or string to print
+    int		len,		// length of string. if -1, str is null terminated
+    CharMode_t	char_mode,	// modes, bit field (CHMD_*)
+    char	quote		// NULL or quotation char, that must be quoted
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 
 uint ScanEscapedString
@@ -3013,6 +3373,61 @@ static inline uint GetEncodeBase64FillLen ( uint src_len )
 static inline uint GetDecodeBase64Len ( uint src_len )
 	{ return 3 * src_len / 4; }
 
+///////////////////////////////////////////////////////////////////////////////
+// [[Base64Stream_t]]
+// Incremental BASE64 encoding or decoding of unbounded data into a FastBuf_t.
+// Data is processed in chunks of any size by PutBase64Stream(),
+// CloseBase64Stream() writes the final tupel.
+
+typedef struct Base64Stream_t
+{
+    ccp		table;			// encoding or decoding table
+    bool	decode;			// true: decoder, false: encoder
+    bool	use_filler;		// encoder: use filler for aligned output
+    bool	allow_white_spaces;	// decoder: skip white spaces
+    bool	stopped;		// decoder: end of data or invalid char found
+    u8		n_pending;		// number of pending bytes|chars
+    u8		pending[3];		// encoder: pending bytes of incomplete tupel
+    u32		acc;			// decoder: accumulated 6-bit values
+    u64		total_in;		// total number of accepted input bytes
+    u64		total_out;		// total number of output bytes
+}
+Base64Stream_t;
+
+//-----------------------------------------------------------------------------
+
+void InitializeEncodeBase64Stream
+(
+    Base64Stream_t	*bs,		// valid stream to initialize
+    const char		encode64[64+1],	// encoding table; if NULL: use TableEncode64default
+    bool		use_filler	// use filler for aligned output
+);
+
+void InitializeDecodeBase64Stream
+(
+    Base64Stream_t	*bs,		// valid stream to initialize
+    const char		decode64[256],	// decoding table; if NULL: use TableDecode64default
+    bool		allow_white_spaces // true: skip white spaces
+);
+
+uint PutBase64Stream
+(
+    // returns the number of bytes appended to 'fb'
+
+    Base64Stream_t	*bs,		// valid stream
+    FastBuf_t		*fb,		// valid destination buffer
+    cvp			data,		// NULL or data to encode|decode
+    int			size		// size of 'data'; if <0: use strlen(data)
+);
+
+uint CloseBase64Stream
+(
+    // flush pending data, returns the number of bytes appended to 'fb'
+
+    Base64Stream_t	*bs,		// valid stream
+    FastBuf_t		*fb		// valid destination buffer
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -3084,6 +3499,34 @@ mem_t QuoteJSONCirc
 					//	>=2: if source_len == 0
 );
 
+///////////////////////////////////////////////////////////////////////////////
+
+uint EncodeJSONFastBuf
+(
+    // Append the JSON encoded 'source' to 'fb' without size limit.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    const void	*source,		// NULL or data to encode
+    int		source_len		// length of 'source'; if <0: use strlen(source)
+);
+
+//-----------------------------------------------------------------------------
+
+uint QuoteJSONFastBuf
+(
+    // Append the JSON encoded and quoted 'source' to 'fb' without size limit.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    const void	*source,		// NULL or data to encode
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		null_if			// append 'null' without quotes ...
+					//	<=0: never
+					//	>=1: if source == NULL
+					//	>=2: if source_len == 0
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -3114,6 +3557,32 @@ mem_t DecodeHexCirc
 
 ///////////////////////////////////////////////////////////////////////////////
 
+char * PrintHexNumber
+(
+    // Print 'num' in hex, right aligned in a field of at least 'min_digits'
+    // chars and filled with 'fill' (' ' or '0'). No NULL termination.
+    // Returns a pointer to the end of the printed number.
+
+    char	*dest,			// valid destination, >= 16 or 'min_digits' bytes
+    u64		num,			// number to print
+    uint	min_digits,		// minimal field width
+    char	fill,			// fill char, usually ' ' or '0'
+    ccp		digits			// digits to use, eg. LoDigits[] (=fallback) or HiDigits[]
+);
+
+char * PrintFixedDecimal
+(
+    // Print the lowest 'n_digits' decimal digits of 'num' with leading
+    // zeros. No NULL termination.
+    // Returns a pointer to the end of the printed number.
+
+    char	*dest,			// valid destination, >= 'n_digits' bytes
+    u32		num,			// number to print
+    uint	n_digits		// number of digits to print
+);
+
+//-----------------------------------------------------------------------------
+
 uint EncodeHex
 (
     // returns the number of valid bytes in 'buf'. Result is NULL-terminated.
@@ -3226,9 +3695,38 @@ static inline bool IsValidShiftJIS ( uint code )
 int ScanShiftJISChar ( cucp * str );
 int ScanShiftJISCharE ( cucp * str, cvp end );
 
-void SetupGetShiftJISCache(void);
+void SetupGetShiftJISCache(void); // obsolete: tables are static
 int GetShiftJISChar ( u32 code );
 
+//-----------------------------------------------------------------------------
+
+uint ShiftJISToUTF8FastBuf
+(
+    // Append the UTF-8 encoded Shift-JIS string 'source' to 'fb'.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    const void	*source,		// NULL or Shift-JIS string to convert
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		invalid			// >=0: unicode replacement of invalid chars
+					//  <0: skip invalid chars
+);
+
+uint UTF8ToShiftJISFastBuf
+(
+    // Append the Shift-JIS encoded UTF-8 string 'source' to 'fb'.
+    // Invalid UTF-8 sequences are scanned as ANSI characters.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    ccp		source,			// NULL or UTF-8 string to convert
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		invalid			// >=0: Shift-JIS replacement of invalid chars
+					//  <0: skip invalid chars
+);
+
+//-----------------------------------------------------------------------------
+
 ccp GetShiftJISStatistics(void);
 
 //
@@ -3440,6 +3938,13 @@ const KeywordTab_t * ScanKeyword
 
 //-----------------------------------------------------------------------------
 
+// ScanKeyword() and ScanKeywordListEx() use a lazy index per keyword table,
+// cached by table address. Drop it after a table was modified and before
+// a table is freed, so that the address can be reused. NULL: drop all.
+void ResetKeywordIndex ( const KeywordTab_t *key_tab );
+
+//-----------------------------------------------------------------------------
+
 s64 ScanKeywordListEx
 (
     ccp			arg,		// argument to scan
@@ -3718,7 +4223,15 @@ uint ReadFromUrandom ( void *dest, uint size );
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Each thread uses its own xoshiro256** generator, seeded on first use.
+// If 'use_urandom_for_myrandom' is set, /dev/urandom is read instead.
+// MyRandom*(): max>0: return a value in the range 0..max-1 without bias;
+//		max=0: return a value of the full range.
+
 u32 MyRandom ( u32 max );
+u64 MyRandom64 ( u64 max );
+
+// MySeed*(): seed the generator of the current thread
 u64 MySeed ( u64 base );
 u64 MySeedByTime(void);
 
@@ -3727,6 +4240,7 @@ void MyRandomFill ( void * buf, size_t size );
 ///////////////////////////////////////////////////////////////////////////////
 
 void CreateUUID ( uuid_buf_t dest );
+void CreateUUIDList ( uuid_buf_t *dest, uint n ); // create 'n' UUIDs at once
 uint CreateTextUUID ( char *buf, uint bufsize );
 uint PrintUUID ( char *buf, uint bufsize, uuid_buf_t uuid );
 char * ScanUUID ( uuid_buf_t uuid, ccp source );
@@ -3872,6 +4386,45 @@ long long int str2ll ( const char *nptr, char **endptr, int base );
 unsigned long int str2ul ( const char *nptr, char **endptr, int base );
 unsigned long long int str2ull ( const char *nptr, char **endptr, int base );
 
+//-----------------------------------------------------------------------------
+// Scan a column of numbers: 'source' is split into fields by 'sep' and
+// each field is scanned as one number, so that the index of 'dest' is the
+// field number. Blanks around numbers are ignored. An empty field after
+// a terminating separator is ignored. Empty and invalid fields and
+// overflows store 'invalid'. Decimal integers are scanned by a fast path,
+// other formats by ScanS64() or strtod().
+// All functions return the number of stored values (<= max_num).
+
+uint ScanColumnU64
+(
+    u64		*dest,			// store values here
+    uint	max_num,		// max number of elements of 'dest'
+    mem_t	source,			// source text
+    char	sep,			// field separator, e.g. ',' or '\n'
+    u64		invalid,		// value for empty or invalid fields
+    uint	*n_invalid		// not NULL: store number of invalid fields
+);
+
+uint ScanColumnS64
+(
+    s64		*dest,			// store values here
+    uint	max_num,		// max number of elements of 'dest'
+    mem_t	source,			// source text
+    char	sep,			// field separator, e.g. ',' or '\n'
+    s64		invalid,		// value for empty or invalid fields
+    uint	*n_invalid		// not NULL: store number of invalid fields
+);
+
+uint ScanColumnD
+(
+    double	*dest,			// store values here
+    uint	max_num,		// max number of elements of 'dest'
+    mem_t	source,			// source text
+    char	sep,			// field separator, e.g. ',' or '\n'
+    double	invalid,		// value for empty or invalid fields
+    uint	*n_invalid		// not NULL: store number of invalid fields
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////		     print numbers and size		///////////////
@@ -4367,6 +4920,50 @@ static inline void SetMicroSecondChar ( bool use_micro )
 void SetupTimezone ( bool force );
 int GetTimezoneAdjust ( time_t tim );
 
+///////////////////////////////////////////////////////////////////////////////
+// [[ClockMode_t]]
+
+typedef enum ClockMode_t
+{
+    CLKM_EXACT,		// default: read the system clock on each call
+    CLKM_COARSE,	// use CLOCK_*_COARSE (faster, but resolution of a tick)
+			//  falls back to CLKM_EXACT if not supported
+    CLKM_CACHED,	// use the time of the last UpdateClockCache() or
+			//  UpdateCurrentTime(); refresh automatically if older
+			//  than 'max_stale_nsec' (checked by the coarse clock)
+}
+ClockMode_t;
+
+//-----------------------------------------------------------------------------
+// [[ClockCache_t]]
+
+typedef struct ClockCache_t
+{
+    ClockMode_t		mode;		// active mode, set by SetClockMode()
+    u_nsec_t		max_stale_nsec;	// CLKM_CACHED: max age of the cache
+					//  0: refresh only by UpdateClockCache()
+
+    // Both values are read and written atomically, so that no torn values
+    // are seen. 'mono_nsec' is only increased, even by concurrent updates.
+    u_nsec_t		real_nsec;	// cached CLOCK_REALTIME (UTC) in nsec
+    u_nsec_t		mono_nsec;	// cached CLOCK_MONOTONIC in nsec
+}
+ClockCache_t;
+
+extern ClockCache_t clock_cache;
+
+// The clock mode affects GetTimeOfDay(), GetClockTime(), GetClockTimer()
+// and all functions based on them, e.g. GetTime*(), GetTimer*() and
+// GetCurrentTime(). Reading and updating the cache is thread safe,
+// SetClockMode() is not. The statistics are counted per thread.
+
+void SetClockMode ( ClockMode_t mode, u_nsec_t max_stale_nsec ); // reset statistics
+void UpdateClockCache(void);		// refresh cache, only if CLKM_CACHED
+ccp  GetClockCacheStatistics(void);	// statistics of the current thread,
+					//  stored in circ-buf
+
+//-----------------------------------------------------------------------------
+
 struct timeval	GetTimeOfDay ( bool localtime );
 struct timespec	GetClockTime ( bool localtime );
 DayTime_t	GetDayTime   ( bool localtime );
@@ -4448,8 +5045,14 @@ CurrentTime_t;
 CurrentTime_t GetCurrentTime ( bool localtime );
 
 extern CurrentTime_t current_time;
+
 static inline void UpdateCurrentTime(void)
-	{ current_time = GetCurrentTime(false); }
+{
+    // called by the event loop once per wakeup
+    if ( clock_cache.mode == CLKM_CACHED )
+	UpdateClockCache();
+    current_time = GetCurrentTime(false);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -5412,8 +6015,11 @@ typedef struct UsageParam_t
     //--- not saved/restored
 
     bool	dirty;			// TRUE: record needs an update @ 'update_nsec'
+    bool	busy;			// TRUE: an update is running, see UpdateUsage*()
     u_nsec_t	update_nsec;		// next update, based on GetTimerNSec()
     u_nsec_t	force_update_nsec;	// force next update, based on GetTimerNSec()
+
+    struct UsageShardList_t *shard_list; // NULL or per-thread recording shards
 }
 UsageParam_t;
 
@@ -5454,6 +6060,17 @@ static inline void DisableUsageCount(void) { usage_count_enabled--; }
 
 //-----------------------------------------------------------------------------
 
+// Recording (*Add(), *Increment()) is lock-free: each thread counts into
+// its own shard of the counter. The shards of a terminated thread are
+// reused by the next new thread. The shards are aggregated into 'ref' by
+// UpdateUsage*(), which never waits: if another thread is updating the
+// same object, the call is skipped. A copy of a counter starts with new
+// shards. Call ReleaseUsageShards() before a dynamic counter is freed,
+// while no other thread is recording into it. For a UsageDuration_t use
+// ReleaseUsageDuration(), which frees the histograms too.
+
+void ReleaseUsageShards ( UsageParam_t *par );
+
 // n_rec<0: clear from end, n_rec>=0: clear from index
 void ClearUsageCount ( UsageCount_t *uc, int count );
 
@@ -5487,6 +6104,37 @@ typedef struct UsageDurationEntry_t
 }
 __attribute__ ((packed)) UsageDurationEntry_t;
 
+//-----------------------------------------------------------------------------
+// [[UsageHisto_t]]
+// Log-linear (HDR style) histogram of durations in nanoseconds: Each power
+// of 2 is divided into 2^USAGE_HISTO_SUB_BITS linear buckets, so the
+// relative error of a bucket is less than 1/2^USAGE_HISTO_SUB_BITS.
+// Values below 2^(USAGE_HISTO_SUB_BITS+1) nsec are exact.
+
+#define USAGE_HISTO_SUB_BITS	 3	// 8 sub-buckets => error <12.5%
+#define USAGE_HISTO_MAX_BITS	40	// larger values (>18 min) use the last bucket
+#define USAGE_HISTO_BUCKETS \
+	( ( USAGE_HISTO_MAX_BITS - USAGE_HISTO_SUB_BITS + 1 ) << USAGE_HISTO_SUB_BITS )
+
+typedef struct UsageHisto_t
+{
+    u64		count[USAGE_HISTO_BUCKETS];	// number of events per bucket
+}
+UsageHisto_t;
+
+//-----------------------------------------------------------------------------
+
+uint GetUsageHistoIndex ( u_nsec_t nsec );
+u_nsec_t GetUsageHistoMaxValue ( uint index ); // highest value of bucket
+
+void AddUsageHistoValue ( UsageHisto_t *uh, u_nsec_t nsec, u64 count );
+void AddUsageHisto ( UsageHisto_t *dest, const UsageHisto_t *add );
+u64  GetUsageHistoCount ( const UsageHisto_t *uh );
+
+// returns the highest value of the bucket with the given percentile,
+// or 0 if the histogram is empty. PERCENT is in range 0.0 .. 100.0
+u_nsec_t GetUsageHistoPercentile ( const UsageHisto_t *uh, double percent );
+
 //-----------------------------------------------------------------------------
 //  [[UsageDuration_t]]
 
@@ -5499,6 +6147,11 @@ typedef struct UsageDuration_t
  #else
     UsageDurationEntry_t entry[USAGE_COUNT_ENTRIES];	// list of entries with delta values
  #endif
+
+    // NULL or histograms, enabled by EnableUsageDurationHisto():
+    // histo[0] is related to 'ref' and histo[1+i] to 'entry[i]'.
+    // A copy of the counter gets new empty histograms on its next update.
+    UsageHisto_t	 *histo;
 }
 UsageDuration_t;
 
@@ -5516,6 +6169,19 @@ void UsageDurationIncrement ( UsageDuration_t *ud, u_nsec_t wait_nsec );
 // stat about last 'nsec' nanoseconds
 UsageDurationEntry_t GetUsageDuration ( const UsageDuration_t *ud, s_nsec_t nsec );
 
+// Allocate the histograms. All *Increment() and *Add() functions feed them.
+// *Add() with ADD>1 counts ADD values of WAIT_NSEC/ADD.
+void EnableUsageDurationHisto ( UsageDuration_t *ud );
+
+// Release the shards and the histograms of a dynamic counter before it is
+// freed. 'ud' is left without histograms.
+void ReleaseUsageDuration ( UsageDuration_t *ud );
+
+// histogram about last 'nsec' nanoseconds, same range as GetUsageDuration()
+// returns false and clears DEST, if histograms are not enabled
+bool GetUsageDurationHisto
+	( UsageHisto_t *dest, const UsageDuration_t *ud, s_nsec_t nsec );
+
 void AddUsageDurationEntry ( UsageDurationEntry_t *dest, const UsageDurationEntry_t *add );
 
 //
@@ -6363,27 +7029,67 @@ typedef struct MemMapItem_t
 
 } MemMapItem_t;
 
+//-----------------------------------------------------------------------------
+// [[MemMapNode_t]]
+
+typedef struct MemMapNode_t
+{
+    struct MemMapNode_t *left;	// NULL or left subtree (smaller keys)
+    struct MemMapNode_t *right;	// NULL or right subtree (larger keys)
+    int		height;		// height of subtree, used for AVL balancing
+    uint	seq;		// insertion sequence number, last part of key
+
+    u64		min_off;	// smallest 'off' of subtree
+    u64		max_end;	// largest 'off+size' of subtree
+    u64		max_gap;	// upper limit of unused space inside subtree
+
+    MemMapItem_t item;		// the item itself
+
+} MemMapNode_t;
+
 //-----------------------------------------------------------------------------
 // [[MemMap_t]]
 
 typedef struct MemMap_t
 {
-    MemMapItem_t ** field;	// pointer to the item field
-    uint	used;		// number of used titles in the item field
+    MemMapItem_t ** field;	// pointer to the item field, sorted view of
+				// the tree => call SyncMemMap() before usage
+    uint	used;		// number of used items, always valid
     uint	size;		// number of allocated pointers in 'field'
     u64		begin;		// first address
 
+    MemMapNode_t *root;		// NULL or root of interval tree
+    uint	seq;		// sequence counter for new nodes
+    bool	field_dirty;	// true: 'field' must be rebuilt
+
 } MemMap_t;
 
 //-----------------------------------------------------------------------------
 //	Memory maps allow duplicate entries.
 //	The off+size pair is used as key.
-//	The entries are sorted by off and size (small values first).
+//	The entries are sorted by off and size (small values first),
+//	duplicates in order of insertion.
+//	Items are stored in an augmented AVL tree (interval tree), so that
+//	insertion, overlap queries and free space searches are O(log n).
+//	'field' is only a sorted view of the tree, rebuilt by SyncMemMap().
+//	GetNextMemMap() iterates without 'field', also for const maps.
 //-----------------------------------------------------------------------------
 
 void InitializeMemMap ( MemMap_t * mm );
 void ResetMemMap ( MemMap_t * mm );
 
+// Rebuild 'mm->field' if necessary. Needed before accessing 'mm->field'.
+void SyncMemMap ( MemMap_t * mm );
+
+const MemMapItem_t * GetNextMemMap
+(
+    // returns the first item (prev==NULL) or the successor of 'prev',
+    // or NULL at the end. Each step is O(log n).
+
+    const MemMap_t	* mm,		// valid mem map
+    const MemMapItem_t	* prev		// NULL or an item of 'mm'
+);
+
 void CopyMemMap
 (
     MemMap_t		* mm1,		// merged mem map, not NULL, cleared
@@ -6400,7 +7106,7 @@ void MergeMemMap
 
 MemMapItem_t * FindMemMap
 (
-    // returns NULL or the pointer to the one! matched key (={off,size})
+    // returns NULL or the pointer to the first item overlapping the area
 
     MemMap_t		* mm,
     off_t		off,
@@ -7116,6 +7822,7 @@ void RestoreStateByTable
 
 extern const SaveRestoreTab_t SRT_UsageCount[];
 extern const SaveRestoreTab_t SRT_UsageDuration[];
+extern const SaveRestoreTab_t SRT_UsageHisto[];
 extern const SaveRestoreTab_t SRT_CpuUsage[];
 
 //
@@ -7138,6 +7845,10 @@ typedef struct GrowBuffer_t
     uint	max_used;	// max 'used' value
 
     uint	disabled;	// disable rading from TCP socket
+    bool	mirror;		// true: use a mirrored ring mapping for 'buf'
+				//   (set by EnableMirrorGrowBuffer())
+    bool	is_mirrored;	// true: 'buf' is currently a mirrored mapping
+				//   of 2*('size'+1) bytes and 'ptr' wraps
 }
 GrowBuffer_t;
 
@@ -7160,6 +7871,16 @@ void ResetGrowBuffer ( GrowBuffer_t *gb );
 uint ClearGrowBuffer ( GrowBuffer_t *gb ); // returns available space
 uint PurgeGrowBuffer ( GrowBuffer_t *gb ); // returns available space
 
+static inline void EnableMirrorGrowBuffer ( GrowBuffer_t *gb )
+{
+    // Request a mirrored ring mapping (see AllocMirrorMap()) for the next
+    // allocation of the buffer. With it, DropGrowBuffer() and
+    // PrepareGrowBuffer() never move data. If mapping fails,
+    // the buffer silently falls back to malloc().
+    DASSERT(gb);
+    gb->mirror = true;
+}
+
 //-----------------------------------------------------------------------------
 
 uint GetSpaceGrowBuffer
@@ -1463,6 +1463,9 @@ typedef struct TCPHandler_t
 					// is created and added
     TCPStreamFunc  OnDestroyStream;	// not NULL: called by ResetTCPStream()
 
+    bool	mirror_buffers;		// true: CreateTCPStream() enables mirrored
+					// ring buffers for 'ibuf' and 'obuf'
+
     Socket_t listen[TCP_HANDLER_MAX_LISTEN];
 					// sockets to listen
 
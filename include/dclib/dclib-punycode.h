@@ -65,6 +65,36 @@ uint Domain2ASCII
     int		source_len		// length of 'source'; if <0: use strlen(source)
 );
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			DomainList2*()			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Convert all domains of 'src' by Domain2UTF8() or Domain2ASCII() and
+// append the results to 'dest'. NULL elements are copied, failed
+// conversions are appended as empty strings.
+// Returns the number of failed conversions.
+
+uint DomainList2UTF8  ( mem_list_t *dest, const mem_list_t *src );
+uint DomainList2ASCII ( mem_list_t *dest, const mem_list_t *src );
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			punycode label cache		///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Domain2UTF8() and Domain2ASCII() can store converted labels in a LRU
+// cache. Plain ASCII labels are never cached, because they are converted
+// to itself. The cache is thread local and disabled by default, so the
+// functions below affect only the current thread. A thread that enables
+// the cache by SetupPunycodeCache() must call ResetPunycodeCache() before
+// it terminates to free its labels.
+
+#define PUNYCODE_CACHE_DEFAULT 4096 // suggested size for SetupPunycodeCache()
+
+void SetupPunycodeCache ( uint max_labels ); // reset cache and set size, 0: disable
+void ResetPunycodeCache(void);		// remove all labels and reset statistics
+ccp  GetPunycodeCacheStatistics(void);	// statistics as string, stored in circ-buf
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			punycode lib			///////////////
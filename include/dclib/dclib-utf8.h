@@ -109,6 +109,7 @@ u32	ScanUTF8AnsiCharE ( ccp * str, ccp end );
 int	ScanUTF8Length	  ( ccp str );
 int	ScanUTF8LengthE	  ( ccp str, ccp end );
 int	CalcUTF8PrintFW   ( ccp str, ccp end, uint wanted_fw );
+int	ValidateUTF8      ( ccp str, ccp end );
 
 char *	PrintUTF8Char ( char * buf, u32 code );
 char *	PrintUTF8CharToCircBuf ( u32 code );
@@ -156,6 +157,35 @@ typedef struct dcUnicodeTripel
 extern const dcUnicodeTripel TableUnicodeDecomp[];
 const dcUnicodeTripel * DecomposeUnicode ( u32 code );
 
+///////////////////////////////////////////////////////////////////////////////
+// [[dcUnicodeFold]]
+
+typedef enum dcUnicodeFold
+{
+    DC_UFOLD_DECOMP	= 0x01, // decompose chars recursively
+    DC_UFOLD_MARKS	= 0x02, // remove combining diacritical marks
+    DC_UFOLD_CASE	= 0x04, // simple case folding, see FoldUnicodeCase()
+
+    DC_UFOLD_SEARCH	= 0x07, // case and accent insensitive searching
+
+} dcUnicodeFold;
+
+// simple lower case folding of ASCII, Latin-1, Latin Extended-A,
+// Greek and Cyrillic; all other codes are returned unchanged
+u32 FoldUnicodeCase ( u32 code );
+
+uint DecomposeUTF8FastBuf
+(
+    // Append the decomposed and folded UTF-8 string 'source' to 'fb'.
+    // Invalid UTF-8 sequences are scanned as ANSI characters.
+    // Returns the number of appended bytes.
+
+    FastBuf_t		*fb,		// valid destination buffer
+    ccp			source,		// NULL or UTF-8 string to convert
+    int			source_len,	// length of 'source'; if <0: use strlen(source)
+    dcUnicodeFold	mode		// bit field of DC_UFOLD_*
+);
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////				END			///////////////
@@ -177,6 +177,8 @@ typedef struct XDump_t
     ccp			num_format2;	// pointer to second numeric format
     uint		num_format_fw;	// current field width of a number
     uint		max_format_fw;	// max possible fw for format
+    uint		num_hex_digits;	// >0: hex format with this number of digits,
+					//     printed by PrintHexNumber() instead of sprintf()
     ccp			format_name;	// name of the format
 
     u64			written;	// total written bytes
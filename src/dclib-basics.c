@@ -44,6 +44,8 @@
 #include <sys/time.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 
 #include "dclib/dclib-basics.h"
 #include "dclib/dclib-debug.h"
@@ -2614,6 +2616,378 @@ void MoveFastBuf ( FastBuf_t *dest, FastBuf_t *src )
     }
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    SegBuf_t			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetSegBuf ( SegBuf_t *sb )
+{
+    DASSERT(sb);
+
+    SegBufChunk_t *chunk = sb->first;
+    while (chunk)
+    {
+	SegBufChunk_t *next = chunk->next;
+	FREE(chunk);
+	chunk = next;
+    }
+    InitializeSegBuf(sb,sb->chunk_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static SegBufChunk_t * NewChunkSegBuf ( SegBuf_t *sb, uint min_size )
+{
+    // create a new chunk, but don't add it to the chain
+
+    DASSERT(sb);
+    uint size = sb->chunk_size ? sb->chunk_size : SEGBUF_DEFAULT_CHUNK_SIZE;
+    if ( size < min_size )
+	size = min_size;
+
+    SegBufChunk_t *chunk = MALLOC(sizeof(*chunk)+size);
+    chunk->next = 0;
+    chunk->used = 0;
+    chunk->size = size;
+    sb->n_chunks++;
+    return chunk;
+}
+
+//-----------------------------------------------------------------------------
+
+static SegBufChunk_t * AddChunkSegBuf ( SegBuf_t *sb, uint min_size )
+{
+    // create a new chunk and append it to the chain
+
+    SegBufChunk_t *chunk = NewChunkSegBuf(sb,min_size);
+    if (sb->last)
+	sb->last->next = chunk;
+    else
+	sb->first = chunk;
+    sb->last = chunk;
+    return chunk;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+char * GetSpaceSegBuf
+(
+    // returns a pointer to 'size' contiguous bytes at the end of the buffer
+
+    SegBuf_t	*sb,		// valid segmented buffer
+    uint	size		// number of bytes to reserve
+)
+{
+    DASSERT(sb);
+
+    SegBufChunk_t *chunk = sb->last;
+    if ( !chunk || chunk->size - chunk->used < size )
+	chunk = AddChunkSegBuf(sb,size);
+
+    char *res = chunk->data + chunk->used;
+    chunk->used += size;
+    sb->len += size;
+    return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AppendSegBuf
+(
+    SegBuf_t	*sb,		// valid segmented buffer
+    cvp		source,		// data to append
+    int		size		// size of 'source', if <0: use strlen(source)
+)
+{
+    DASSERT(sb);
+    DASSERT(source||!size);
+
+    if ( size < 0 )
+	size = strlen(source);
+    sb->len += size;
+
+    ccp src = source;
+    SegBufChunk_t *chunk = sb->last;
+    while ( size > 0 )
+    {
+	if ( !chunk || chunk->used == chunk->size )
+	    chunk = AddChunkSegBuf(sb,0);
+
+	uint copy_len = chunk->size - chunk->used;
+	if ( copy_len > size )
+	    copy_len = size;
+	memcpy( chunk->data + chunk->used, src, copy_len );
+	chunk->used += copy_len;
+	src  += copy_len;
+	size -= copy_len;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint PrintSegBuf
+(
+    // returns the number of appended bytes
+
+    SegBuf_t	*sb,		// valid segmented buffer
+    ccp		format,		// format string for vsnprintf()
+    ...				// arguments for 'vsnprintf(format,...)'
+)
+{
+    DASSERT(sb);
+    DASSERT(format);
+
+    //--- try to print directly into the last chunk
+
+    SegBufChunk_t *chunk = sb->last;
+    uint avail = chunk ? chunk->size - chunk->used : 0;
+
+    va_list arg;
+    va_start(arg,format);
+    const int stat = vsnprintf( avail ? chunk->data + chunk->used : 0,
+				avail, format, arg );
+    va_end(arg);
+    if ( stat <= 0 )
+	return 0;
+
+    if ( stat < avail )
+    {
+	chunk->used += stat;
+	sb->len += stat;
+    }
+    else
+    {
+	//--- too small, print into a new contiguous area
+
+	char *dest = GetSpaceSegBuf(sb,stat+1);
+	va_start(arg,format);
+	vsnprintf(dest,stat+1,format,arg);
+	va_end(arg);
+	sb->last->used--;
+	sb->len--;
+    }
+    return stat;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+u64 InsertSegBuf
+(
+    // Insert data at 'index'. The chunk at 'index' is split, so that only
+    // the bytes behind 'index' of this single chunk are copied.
+    // Returns the normalized index, see CheckIndex1().
+
+    SegBuf_t	*sb,		// valid segmented buffer
+    s64		index,		// index of insertion, <0: relative to end
+    cvp		source,		// data to insert
+    int		size		// size of 'source', if <0: use strlen(source)
+)
+{
+    DASSERT(sb);
+    DASSERT(source||!size);
+
+    if ( size < 0 )
+	size = strlen(source);
+
+    if ( index < 0 )
+    {
+	index += sb->len;
+	if ( index < 0 )
+	    index = 0;
+    }
+    else if ( index > sb->len )
+	index = sb->len;
+
+    if ( index == sb->len )
+    {
+	AppendSegBuf(sb,source,size);
+	return index;
+    }
+
+    if (!size)
+	return index;
+
+
+    //--- find chunk at 'index'
+
+    SegBufChunk_t *prev = 0, *chunk = sb->first;
+    u64 pos = 0;
+    while ( pos + chunk->used <= index )
+    {
+	pos += chunk->used;
+	prev = chunk;
+	chunk = chunk->next;
+	DASSERT(chunk);
+    }
+    const uint offset = index - pos;
+
+
+    //--- split 'chunk' at 'offset': the tail is moved into a new chunk
+
+    SegBufChunk_t *tail = chunk;
+    if (offset)
+    {
+	const uint tail_len = chunk->used - offset;
+	tail = NewChunkSegBuf(sb,tail_len);
+	memcpy(tail->data,chunk->data+offset,tail_len);
+	tail->used  = tail_len;
+	tail->next  = chunk->next;
+	chunk->used = offset;
+	if ( sb->last == chunk )
+	    sb->last = tail;
+	prev = chunk;
+    }
+
+
+    //--- insert a single new chunk with the data between 'prev' and 'tail'
+
+    SegBufChunk_t *ins = NewChunkSegBuf(sb,size);
+    memcpy(ins->data,source,size);
+    ins->used = size;
+    ins->next = tail;
+    if (prev)
+	prev->next = ins;
+    else
+	sb->first = ins;
+
+    sb->len += size;
+    return index;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint GetIOVecSegBuf
+(
+    // Store pointers to the chunks into 'iov' (empty chunks are skipped).
+    // Returns the number of needed vector elements. If the result is
+    // larger than 'n_iov', only the first 'n_iov' elements are stored.
+
+    const SegBuf_t *sb,		// valid segmented buffer
+    struct iovec *iov,		// NULL or destination vector
+    uint	n_iov		// number of elements of 'iov'
+)
+{
+    DASSERT(sb);
+    DASSERT(iov||!n_iov);
+
+    uint count = 0;
+    const SegBufChunk_t *chunk;
+    for ( chunk = sb->first; chunk; chunk = chunk->next )
+    {
+	if (!chunk->used)
+	    continue;
+	if ( count < n_iov )
+	{
+	    iov[count].iov_base = (void*)chunk->data;
+	    iov[count].iov_len  = chunk->used;
+	}
+	count++;
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+s64 WriteSegBuf
+(
+    // write all data by writev() and return the number of written bytes.
+    // If an error (e.g. EAGAIN for non-blocking files) stops the writing,
+    // the number of bytes written so far is returned, or -1 if nothing
+    // was written. 'errno' is set in both cases.
+
+    int		fd,		// valid file descriptor
+    const SegBuf_t *sb		// valid segmented buffer
+)
+{
+    DASSERT(sb);
+
+    struct iovec iov[64];
+    const SegBufChunk_t *chunk = sb->first;
+    uint skip = 0; // bytes of 'chunk' already written
+    s64 total = 0;
+
+    while (chunk)
+    {
+	//--- collect the next vector
+
+	uint n = 0;
+	const SegBufChunk_t *ptr;
+	for ( ptr = chunk; ptr && n < sizeof(iov)/sizeof(*iov); ptr = ptr->next )
+	{
+	    const uint offset = ptr == chunk ? skip : 0;
+	    if ( ptr->used > offset )
+	    {
+		iov[n].iov_base = (void*)( ptr->data + offset );
+		iov[n].iov_len  = ptr->used - offset;
+		n++;
+	    }
+	}
+	if (!n)
+	    break;
+
+	ssize_t stat = writev(fd,iov,n);
+	if ( stat < 0 )
+	{
+	    if ( errno == EINTR )
+		continue;
+	    return total ? total : -1;
+	}
+	total += stat;
+
+
+	//--- skip written data
+
+	stat += skip;
+	while ( chunk && stat >= chunk->used )
+	{
+	    stat -= chunk->used;
+	    chunk = chunk->next;
+	}
+	skip = stat;
+    }
+    return total;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+mem_t MoveFromSegBufMem ( SegBuf_t *sb )
+{
+    DASSERT(sb);
+
+    if ( sb->len > INT_MAX - 1 )
+	return NullMem; // 'mem_t.len' is an int; 'sb' is left untouched
+
+    mem_t res;
+    res.len = sb->len;
+
+    if ( sb->first && sb->first == sb->last && sb->first->used == res.len )
+    {
+	//--- single chunk: reuse it without copying
+
+	SegBufChunk_t *chunk = sb->first;
+	memmove(chunk,chunk->data,res.len);
+	res.ptr = REALLOC(chunk,res.len+1);
+	sb->first = sb->last = 0;
+	sb->n_chunks = 0;
+    }
+    else
+    {
+	char *dest = MALLOC(res.len+1);
+	res.ptr = dest;
+	const SegBufChunk_t *chunk;
+	for ( chunk = sb->first; chunk; chunk = chunk->next )
+	{
+	    memcpy(dest,chunk->data,chunk->used);
+	    dest += chunk->used;
+	}
+    }
+
+    ((char*)res.ptr)[res.len] = 0;
+    ResetSegBuf(sb);
+    return res;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    alloc info			///////////////
@@ -4704,6 +5078,74 @@ void * MemDupMemPool ( MemPool_t *mp, cvp source, uint size )
     return res;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    mirror maps			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void * AllocMirrorMap
+(
+    // Map the same anonymous memory file twice, back to back. Then the bytes
+    // at 'ptr+i' and 'ptr+i+*size' are identical for all 0 <= i < *size.
+    // Returns NULL if not supported or on error.
+
+    uint	*size		// in: minimal size, out: size rounded up to pages
+)
+{
+    DASSERT(size);
+
+ #if defined(__linux__) && defined(MFD_CLOEXEC)
+
+    const uint page_size = sysconf(_SC_PAGESIZE);
+    const u64 map_size = ( (u64)( *size ? *size : 1 ) + page_size - 1 )
+			/ page_size * page_size;
+    if ( 2*map_size > UINT_MAX )
+	return 0;
+
+    const int fd = memfd_create("dclib-mirror",MFD_CLOEXEC);
+    if ( fd == -1 )
+	return 0;
+
+    u8 *base = MAP_FAILED;
+    if (!ftruncate(fd,map_size))
+    {
+	// reserve the address range first, then replace both halfs
+	base = mmap(0,2*map_size,PROT_NONE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+	if ( base != MAP_FAILED
+	    && (   mmap( base, map_size, PROT_READ|PROT_WRITE,
+				MAP_SHARED|MAP_FIXED, fd, 0 ) == MAP_FAILED
+		|| mmap( base+map_size, map_size, PROT_READ|PROT_WRITE,
+				MAP_SHARED|MAP_FIXED, fd, 0 ) == MAP_FAILED ))
+	{
+	    munmap(base,2*map_size);
+	    base = MAP_FAILED;
+	}
+    }
+    close(fd);
+
+    if ( base == MAP_FAILED )
+	return 0;
+
+    *size = map_size;
+    return base;
+
+ #else
+    return 0;
+ #endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void FreeMirrorMap
+(
+    void	*ptr,		// NULL or pointer returned by AllocMirrorMap()
+    uint	size		// size returned by AllocMirrorMap()
+)
+{
+    if (ptr)
+	munmap(ptr,2*(size_t)size);
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    CircBuf_t			///////////////
@@ -4718,10 +5160,26 @@ void InitializeCircBuf ( CircBuf_t *cb, uint size )
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void InitializeMirrorCircBuf ( CircBuf_t *cb, uint size )
+{
+    // Like InitializeCircBuf(), but use a mirrored mapping. 'size' is rounded
+    // up to pages on first insertion. If mapping fails, fall back to malloc().
+
+    DASSERT(cb);
+    memset(cb,0,sizeof(*cb));
+    cb->size = size;
+    cb->mirror = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void ResetCircBuf ( CircBuf_t *cb )
 {
     DASSERT(cb);
-    FREE(cb->buf);
+    if (cb->mirror)
+	FreeMirrorMap(cb->buf,cb->size);
+    else
+	FREE(cb->buf);
     cb->buf = 0;
     cb->used = cb->pos = 0;
 }
@@ -4738,7 +5196,17 @@ uint WriteCircBuf ( CircBuf_t *cb, cvp data, uint size )
 
     if (!cb->buf)
     {
-	cb->buf = MALLOC(cb->size);
+	if (cb->mirror)
+	{
+	    uint map_size = cb->size;
+	    cb->buf = AllocMirrorMap(&map_size);
+	    if (cb->buf)
+		cb->size = map_size;
+	    else
+		cb->mirror = false;
+	}
+	if (!cb->buf)
+	    cb->buf = MALLOC(cb->size);
 	DASSERT(cb->buf);
 	cb->used = cb->pos = 0;
     }
@@ -4758,7 +5226,7 @@ uint WriteCircBuf ( CircBuf_t *cb, cvp data, uint size )
     if ( ins_pos >= cb->size )
 	ins_pos -= cb->size;
 
-    if ( ins_pos + size > cb->size )
+    if ( ins_pos + size > cb->size && !cb->mirror )
     {
 	const uint copy_len = cb->size - ins_pos;
 	//fprintf(stderr,"COPY %u..%u\n",ins_pos,ins_pos+copy_len);
@@ -4770,7 +5238,7 @@ uint WriteCircBuf ( CircBuf_t *cb, cvp data, uint size )
 
     DASSERT( size > 0 );
     DASSERT( ins_pos <= cb->size );
-    DASSERT( ins_pos + size <= cb->size );
+    DASSERT( ins_pos + size <= ( cb->mirror ? 2*cb->size : cb->size ));
     //fprintf(stderr,"COPY %u..%u\n",ins_pos,ins_pos+size);
     memcpy( cb->buf + ins_pos, d, size );
 
@@ -4800,6 +5268,12 @@ uint PeakCircBuf ( CircBuf_t *cb, char *buf, uint buf_size )
     if ( buf_size > cb->used )
 	buf_size = cb->used;
 
+    if (cb->mirror)
+    {
+	memcpy( buf, cb->buf + cb->pos, buf_size );
+	return buf_size;
+    }
+
     uint count = cb->size - cb->pos;
     if ( count > buf_size )
 	count -= buf_size;
@@ -4857,6 +5331,9 @@ uint PurgeCircBuf ( CircBuf_t *cb )
 {
     DASSERT(cb);
 
+    if (cb->mirror)
+	return cb->used; // data is always contiguous, see GetPtrCircBuf()
+
     if ( cb->used && cb->pos )
     {
 	char *temp = MALLOC(cb->size);
@@ -5057,9 +5534,9 @@ void UnlinkContainerData
     {
 	ContainerData_t *cdata = c->cdata;
 	if ( c->protect_level > 0 )
-	    cdata->protect_count--;
+	    AddProtectContainerData(cdata,-1);
 	c->cdata = 0;
-	if ( !--cdata->ref_count )
+	if (!DecRefContainerData(cdata))
 	{
 	    if (cdata->data_alloced)
 		FREE((void*)cdata->data);
@@ -5082,7 +5559,7 @@ ContainerData_t * LinkContainerData
     if ( !c || !c->cdata )
 	return 0;
 
-    c->cdata->ref_count++;
+    IncRefContainerData(c->cdata);
     return c->cdata;
 }
 
@@ -5099,7 +5576,7 @@ ContainerData_t * MoveContainerData
 	return 0;
 
     ContainerData_t *cdata = c->cdata;
-    cdata->ref_count++;
+    IncRefContainerData(cdata);
     UnlinkContainerData(c);
     return cdata;
 }
@@ -5125,7 +5602,7 @@ Container_t * CatchContainerData
     {
 	c->cdata = cdata;
 	if ( protect > 0 )
-	    cdata->protect_count++;
+	    AddProtectContainerData(cdata,1);
     }
     return c;
 }
@@ -5190,7 +5667,7 @@ void FreeContainerData
     ContainerData_t	*cdata		// NULL or container-data to free
 )
 {
-    if ( cdata && !--cdata->ref_count )
+    if ( cdata && !DecRefContainerData(cdata) )
     {
 	if (cdata->data_alloced)
 	    FREE((void*)cdata->data);
@@ -5228,6 +5705,49 @@ bool ModifyAllContainer
 
 //-----------------------------------------------------------------------------
 
+Container_t * ShareContainer
+(
+    // Share the container-data of 'src' with 'c' without copying (zero-copy).
+    // Both containers are protected, so that the first modification of any
+    // of them by ModifyAllContainer() or ModifyContainer() creates a private
+    // copy (copy-on-write). 'c' and 'src' may be used by different threads
+    // after this call. Returns 'c' or the alloced container.
+
+    Container_t		*c,		// valid container, alloc one if NULL
+    Container_t		*src		// NULL or valid source container
+)
+{
+    if ( c && c == src )
+	return c;
+
+    if ( src && src->protect_level <= 0 )
+	SetProtectContainer(src,1);
+
+    ContainerData_t *cdata = LinkContainerData(src);
+    if (c)
+	UnlinkContainerData(c);
+    return CatchContainerData(c,1,cdata);
+}
+
+//-----------------------------------------------------------------------------
+
+u8 * WriteAccessContainer
+(
+    // Call ModifyAllContainer() to unshare the data if necessary and return
+    // a pointer to the writable data, or NULL if 'c' has no data.
+
+    Container_t		*c		// NULL or valid container
+)
+{
+    if ( !c || !c->cdata )
+	return 0;
+
+    ModifyAllContainer(c);
+    return c->cdata->data;
+}
+
+//-----------------------------------------------------------------------------
+
 bool ModifyContainer
 (
     // prepare modification of container-data, create an extract if necessary
@@ -5272,12 +5792,12 @@ int SetProtectContainer
 	if ( new_protect > 0 )
 	{
 	    if ( c->protect_level <= 0 )
-		c->cdata->protect_count++;
+		AddProtectContainerData(c->cdata,1);
 	}
 	else
 	{
 	    if ( c->protect_level > 0 )
-		c->cdata->protect_count--;
+		AddProtectContainerData(c->cdata,-1);
 	}
     }
     return c->protect_level = new_protect;
@@ -5944,7 +6464,300 @@ bool MatchPattern
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-ccp MatchStringField ( const StringField_t * sf, ccp key )
+static bool IsPlainPatternChar ( char ch )
+{
+    // true, if MatchPatternHelper() compares 'ch' literally at alt_depth 0;
+    // '$' is excluded because of its special meaning at pattern end
+
+    return ch && !strchr("*#\t?[{,}$\\",ch);
+}
+
+//-----------------------------------------------------------------------------
+
+static void SetupPatternHelper
+(
+    Pattern_t	*pat,		// pattern object
+    ccp		pattern,	// pattern behind an anchor
+    bool	anchored,	// true: match at text begin only
+    bool	skip_end	// true: don't need to match until text end
+)
+{
+    DASSERT(pat);
+    DASSERT(pattern);
+
+    pat->anchored = anchored;
+    pat->skip_end = skip_end;
+
+    //--- literal pattern? (escapes and a final '$' are allowed)
+
+    const uint plen = strlen(pattern);
+    char *lit = MALLOC(plen+1), *dest = lit;
+    ccp src = pattern, end = pattern + plen;
+    bool dollar = false, is_literal = true;
+
+    while ( src < end )
+    {
+	const char ch = *src++;
+	if ( ch == '\\' && src < end )
+	    *dest++ = *src++;
+	else if ( ch == '$' && src == end )
+	    dollar = true;
+	else if ( ch == '$' || ch == ',' || ch == '}' || IsPlainPatternChar(ch) )
+	    *dest++ = ch;
+	else
+	{
+	    is_literal = false;
+	    break;
+	}
+    }
+
+    if ( is_literal && dest > lit )
+    {
+	*dest = 0;
+	pat->literal.ptr = lit;
+	pat->literal.len = dest - lit;
+	pat->dollar = dollar;
+	pat->mode = anchored
+		? ( skip_end && !dollar ? PATMD_PREFIX : PATMD_EQUAL )
+		: ( skip_end && !dollar ? PATMD_CONTAINS : PATMD_SUFFIX );
+	if ( !skip_end && !dollar && !anchored )
+	    pat->mode = PATMD_GENERIC; // not a rule of MatchPattern()
+	else
+	    return;
+    }
+
+
+    //--- generic pattern: find literal prefix and required literal
+
+    pat->mode = PATMD_GENERIC;
+    src = pattern;
+    if (anchored)
+    {
+	while ( IsPlainPatternChar(*src) )
+	    src++;
+	pat->prefix_len = src - pattern;
+    }
+    pat->generic = pattern + pat->prefix_len;
+
+    ccp best = 0;
+    uint best_len = 0;
+    if (!strchr(pattern,'{'))
+    {
+	src = pattern;
+	while (*src)
+	{
+	    if (IsPlainPatternChar(*src))
+	    {
+		ccp start = src;
+		while (IsPlainPatternChar(*src))
+		    src++;
+		if ( src - start > best_len )
+		{
+		    best = start;
+		    best_len = src - start;
+		}
+	    }
+	    else if ( *src == '[' )
+		src = AnalyseBrackets(src+1,0,0,0);
+	    else if ( *src == '\\' && src[1] )
+		src += 2;
+	    else
+		src++;
+	}
+    }
+
+    memcpy(lit,best,best_len);
+    lit[best_len] = 0;
+    pat->literal.ptr = lit;
+    pat->literal.len = best_len;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetupPattern
+(
+    // compile 'pattern' for the rules of MatchPattern()
+
+    Pattern_t	*pat,		// pattern object, initialized by this function
+    ccp		pattern,	// NULL or pattern text
+    char	path_sep	// path separator character, standard is '/'
+)
+{
+    DASSERT(pat);
+    memset(pat,0,sizeof(*pat));
+    pat->path_sep = path_sep;
+    if ( !pattern || !*pattern )
+	return;
+
+    pat->pattern = STRDUP(pattern);
+
+    // same analysis as in MatchPattern()
+    const size_t plen = strlen(pattern);
+    ccp last = pattern + plen - 1;
+    char last_ch = *last;
+    int count = 0;
+    while ( last > pattern && *--last == '\\' )
+	count++;
+    if ( count & 1 )
+	last_ch = 0; // no special char!
+
+    const bool anchored = *pattern == path_sep || *pattern == '^';
+    SetupPatternHelper( pat, pat->pattern + anchored, anchored, last_ch != '$' );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void SetupPatternFull
+(
+    // compile 'pattern' for the rules of MatchPatternFull()
+
+    Pattern_t	*pat,		// pattern object, initialized by this function
+    ccp		pattern		// NULL or pattern text
+)
+{
+    DASSERT(pat);
+    memset(pat,0,sizeof(*pat));
+    pat->path_sep = '/';
+    if ( !pattern || !*pattern )
+	return;
+
+    pat->pattern = STRDUP(pattern);
+    SetupPatternHelper( pat, pat->pattern + ( *pattern == '^' ), true, false );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetPattern ( Pattern_t *pat )
+{
+    if (pat)
+    {
+	FreeString(pat->pattern);
+	FreeString(pat->literal.ptr);
+	memset(pat,0,sizeof(*pat));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool EndsWithPattern ( ccp text, uint tlen, mem_t lit, bool dollar )
+{
+    if ( tlen >= lit.len && !memcmp(text+tlen-lit.len,lit.ptr,lit.len) )
+	return true;
+
+    return dollar && tlen > lit.len && text[tlen-1] == '$'
+	&& !memcmp(text+tlen-lit.len-1,lit.ptr,lit.len);
+}
+
+//-----------------------------------------------------------------------------
+
+bool MatchCompiledPattern
+(
+    const Pattern_t *pat,	// valid pattern, set up by SetupPattern*()
+    ccp		text		// NULL or raw text
+)
+{
+    DASSERT(pat);
+    if (!text)
+	text = "";
+
+    const mem_t lit = pat->literal;
+    switch (pat->mode)
+    {
+	case PATMD_ALL:
+	    return true;
+
+	case PATMD_PREFIX:
+	    return !strncmp(text,lit.ptr,lit.len);
+
+	case PATMD_EQUAL:
+	    if (strncmp(text,lit.ptr,lit.len))
+		return false;
+	    text += lit.len;
+	    return !*text || pat->dollar && text[0] == '$' && !text[1];
+
+	case PATMD_SUFFIX:
+	    return EndsWithPattern(text,strlen(text),lit,pat->dollar);
+
+	case PATMD_CONTAINS:
+	    return strstr(text,lit.ptr) != 0;
+
+	case PATMD_GENERIC:
+	    break;
+    }
+
+    if ( lit.len && !strstr(text,lit.ptr) )
+	return false;
+
+    if (pat->anchored)
+    {
+	if (strncmp(text,pat->generic-pat->prefix_len,pat->prefix_len))
+	    return false;
+	return MatchPatternHelper( pat->generic, text + pat->prefix_len,
+				pat->skip_end, 0, pat->path_sep );
+    }
+
+    while (*text)
+	if (MatchPatternHelper(pat->generic,text++,pat->skip_end,0,pat->path_sep))
+	    return true;
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint MatchPatternMemList
+(
+    // match all elements of 'ml' and return the number of matches
+
+    const Pattern_t *pat,	// valid pattern, set up by SetupPattern*()
+    const mem_list_t *ml,	// list of NULL terminated strings
+    bool	*result		// NULL or store results here, 'ml->used' elements
+)
+{
+    DASSERT(pat);
+    DASSERT(ml);
+
+    uint i, count = 0;
+    for ( i = 0; i < ml->used; i++ )
+    {
+	const bool match = MatchCompiledPattern(pat,ml->list[i].ptr);
+	if (match)
+	    count++;
+	if (result)
+	    result[i] = match;
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint MatchPatternStringField
+(
+    // match all elements of 'sf' and return the number of matches
+
+    const Pattern_t *pat,	// valid pattern, set up by SetupPattern*()
+    const StringField_t *sf,	// list of strings
+    bool	*result		// NULL or store results here, 'sf->used' elements
+)
+{
+    DASSERT(pat);
+    DASSERT(sf);
+
+    uint i, count = 0;
+    for ( i = 0; i < sf->used; i++ )
+    {
+	const bool match = MatchCompiledPattern(pat,sf->field[i]);
+	if (match)
+	    count++;
+	if (result)
+	    result[i] = match;
+    }
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+ccp MatchStringField ( const StringField_t * sf, ccp key )
 {
     DASSERT(sf);
     DASSERT(key);
@@ -6072,13 +6885,197 @@ const KeywordTab_t *GetKewordByIdAndOpt
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+///////////////			keyword index			///////////////
 ///////////////////////////////////////////////////////////////////////////////
+// The keyword index is a sorted list of all names (name1 and name2) of a
+// keyword table. It is build on first use of a table by ScanKeyword() and
+// ScanKeywordListEx() and cached by table address. ResetKeywordIndex()
+// drops the index of a modified or freed table, so that the address can be
+// reused by another table. Exact matches are found
+// by a binary search. For abbreviations, all names with the key as prefix
+// form a single range of the list. Only the table entries of this range are
+// evaluated by the original rules, so the results are identical.
 
-const KeywordTab_t * ScanKeyword
+#define KEYWORD_INDEX_SLOTS	256	// number of cache slots, power of 2
+#define KEYWORD_INDEX_MIN	8	// minimal number of keywords to use an index
+#define KEYWORD_INDEX_RANGE	64	// max abbreviation range, else scan table
+
+typedef struct KeywordIndexEntry_t
+{
+    ccp			name;		// name1 or name2 of a keyword
+    uint		idx;		// index into keyword table
+}
+KeywordIndexEntry_t;
+
+typedef struct KeywordIndex_t
+{
+    const KeywordTab_t	*key_tab;	// related keyword table
+    uint		n_key;		// number of keywords of 'key_tab'
+    uint		n_name;		// number of elements of 'list', 0=no index
+    KeywordIndexEntry_t	list[];		// sorted by name and index
+}
+KeywordIndex_t;
+
+static KeywordIndex_t * keyword_index[KEYWORD_INDEX_SLOTS] = {0};
+
+//-----------------------------------------------------------------------------
+
+static int SortKeywordIndex
+	( const KeywordIndexEntry_t *a, const KeywordIndexEntry_t *b )
+{
+    const int stat = strcmp(a->name,b->name);
+    return stat ? stat : (int)a->idx - (int)b->idx;
+}
+
+//-----------------------------------------------------------------------------
+
+static KeywordIndex_t * CreateKeywordIndex ( const KeywordTab_t *key_tab )
+{
+    DASSERT(key_tab);
+
+    uint n_key = 0, n_name = 0;
+    const KeywordTab_t *ct;
+    for ( ct = key_tab; ct->name1; ct++ )
+	n_key++, n_name += ct->name2 ? 2 : 1;
+    if ( n_key < KEYWORD_INDEX_MIN )
+	n_name = 0;
+
+    KeywordIndex_t *ki = MALLOC( sizeof(*ki) + n_name * sizeof(*ki->list) );
+    ki->key_tab = key_tab;
+    ki->n_key   = n_key;
+    ki->n_name  = n_name;
+
+    if (n_name)
+    {
+	KeywordIndexEntry_t *e = ki->list;
+	uint idx;
+	for ( ct = key_tab, idx = 0; ct->name1; ct++, idx++ )
+	{
+	    e->name = ct->name1;
+	    e->idx  = idx;
+	    e++;
+	    if (ct->name2)
+	    {
+		e->name = ct->name2;
+		e->idx  = idx;
+		e++;
+	    }
+	}
+	DASSERT( e == ki->list + n_name );
+	qsort(ki->list,n_name,sizeof(*ki->list),(qsort_func)SortKeywordIndex);
+    }
+    return ki;
+}
+
+//-----------------------------------------------------------------------------
+
+static KeywordIndex_t ** GetKeywordIndexSlot ( const KeywordTab_t *key_tab )
+{
+    // returns NULL, if table is not cached and all slots are used
+
+    uint slot = ( (uintptr_t)key_tab >> 4 ) * 0x9e3779b1u >> 24;
+    for ( uint n = 0; n < KEYWORD_INDEX_SLOTS; n++ )
+    {
+	slot &= KEYWORD_INDEX_SLOTS - 1;
+	KeywordIndex_t *ki = __atomic_load_n(keyword_index+slot,__ATOMIC_ACQUIRE);
+	if ( !ki || ki->key_tab == key_tab )
+	    return keyword_index + slot;
+	slot++;
+    }
+    return 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static const KeywordIndex_t * GetKeywordIndex ( const KeywordTab_t *key_tab )
+{
+    // returns NULL, if no index is available
+
+    DASSERT(key_tab);
+    for(;;)
+    {
+	KeywordIndex_t **slot = GetKeywordIndexSlot(key_tab);
+	if (!slot)
+	    return 0;
+
+	KeywordIndex_t *ki = __atomic_load_n(slot,__ATOMIC_ACQUIRE);
+	if (ki)
+	    return ki->n_name ? ki : 0;
+
+	KeywordIndex_t *expected = 0;
+	ki = CreateKeywordIndex(key_tab);
+	if (__atomic_compare_exchange_n(slot,&expected,ki,false,
+				__ATOMIC_ACQ_REL,__ATOMIC_ACQUIRE) )
+	    return ki->n_name ? ki : 0;
+
+	// another thread was faster => retry
+	FREE(ki);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetKeywordIndex ( const KeywordTab_t *key_tab )
+{
+    // Drop and free the cached index of 'key_tab' (all indices, if NULL).
+    // The index is rebuilt on next use. Call it if a table was modified
+    // and before a table is freed, so that its address can be reused.
+    // It must not run concurrently with a scan of any table.
+
+    if (!key_tab)
+    {
+	for ( uint slot = 0; slot < KEYWORD_INDEX_SLOTS; slot++ )
+	    FREE(__atomic_exchange_n(keyword_index+slot,0,__ATOMIC_ACQ_REL));
+	return;
+    }
+
+    KeywordIndex_t **slot = GetKeywordIndexSlot(key_tab);
+    if ( !slot || !*slot )
+	return;
+    FREE(__atomic_exchange_n(slot,0,__ATOMIC_ACQ_REL));
+
+    // open addressing: move the rest of the cluster to its new place
+    uint idx = slot - keyword_index;
+    for(;;)
+    {
+	idx = ( idx + 1 ) & ( KEYWORD_INDEX_SLOTS - 1 );
+	KeywordIndex_t *ki = __atomic_exchange_n(keyword_index+idx,0,__ATOMIC_ACQ_REL);
+	if (!ki)
+	    break;
+	__atomic_store_n(GetKeywordIndexSlot(ki->key_tab),ki,__ATOMIC_RELEASE);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static uint FindKeywordIndex ( const KeywordIndex_t *ki, ccp key )
+{
+    // returns the index of the first name >= 'key'
+
+    DASSERT(ki);
+    DASSERT(key);
+
+    uint beg = 0, end = ki->n_name;
+    while ( beg < end )
+    {
+	const uint idx = ( beg + end ) / 2;
+	if ( strcmp(ki->list[idx].name,key) < 0 )
+	    beg = idx + 1;
+	else
+	    end = idx;
+    }
+    return beg;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static const KeywordTab_t * ScanKeywordHelper
 (
     int			* res_abbrev,	// NULL or pointer to result 'abbrev_count'
     ccp			arg,		// argument to scan
-    const KeywordTab_t	* key_tab	// valid pointer to command table
+    const KeywordTab_t	* key_tab,	// valid pointer to command table
+    const KeywordIndex_t *ki		// NULL or index of 'key_tab'
 )
 {
     DASSERT(arg);
@@ -6094,8 +7091,60 @@ const KeywordTab_t * ScanKeyword
     int favor_count = 0, abbrev_count = 0;
     const KeywordTab_t *ct, *key_ct = 0;
     const KeywordTab_t *favor_ct = 0, *favor_prev = 0, *abbrev_ct = 0, *abbrev_prev = 0;
-    for ( ct = key_tab; ct->name1; ct++ )
+
+    //--- use index to select candidates
+
+    uint cand[KEYWORD_INDEX_RANGE], n_cand = 0;
+    if (ki)
     {
+	const KeywordIndexEntry_t *e = ki->list + FindKeywordIndex(ki,key_buf);
+	const KeywordIndexEntry_t *e_end = ki->list + ki->n_name;
+	if ( e < e_end && !strcmp(e->name,key_buf) )
+	{
+	    // first exact match, because of sort order of equal names
+	    key_ct = key_tab + e->idx;
+	    goto finish;
+	}
+
+	for ( ; e < e_end && !strncmp(e->name,key_buf,key_len); e++ )
+	{
+	    if ( n_cand == KEYWORD_INDEX_RANGE )
+	    {
+		// too many abbreviations => scan whole table
+		ki = 0;
+		break;
+	    }
+
+	    // insertion sort to restore table order, ignore duplicates
+	    uint pos = n_cand;
+	    while ( pos > 0 && cand[pos-1] > e->idx )
+		pos--;
+	    if ( pos == 0 || cand[pos-1] != e->idx )
+	    {
+		memmove(cand+pos+1,cand+pos,(n_cand-pos)*sizeof(*cand));
+		cand[pos] = e->idx;
+		n_cand++;
+	    }
+	}
+    }
+
+    //--- evaluate candidates or whole table
+
+    for ( uint i = 0; ; i++ )
+    {
+	if (ki)
+	{
+	    if ( i == n_cand )
+		break;
+	    ct = key_tab + cand[i];
+	}
+	else
+	{
+	    ct = key_tab + i;
+	    if (!ct->name1)
+		break;
+	}
+
 	if ( !strcmp(ct->name1,key_buf) )
 	{
 	    key_ct = ct;
@@ -6145,6 +7194,7 @@ const KeywordTab_t * ScanKeyword
 	}
     }
 
+ finish:
     if (key_ct)
 	abbrev_count = 0;
     else if ( favor_count == 1 )
@@ -6163,6 +7213,19 @@ const KeywordTab_t * ScanKeyword
     return key_ct;
 }
 
+//-----------------------------------------------------------------------------
+
+const KeywordTab_t * ScanKeyword
+(
+    int			* res_abbrev,	// NULL or pointer to result 'abbrev_count'
+    ccp			arg,		// argument to scan
+    const KeywordTab_t	* key_tab	// valid pointer to command table
+)
+{
+    DASSERT(key_tab);
+    return ScanKeywordHelper(res_abbrev,arg,key_tab,GetKeywordIndex(key_tab));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 s64 ScanKeywordListEx
@@ -6187,6 +7250,7 @@ s64 ScanKeywordListEx
     char key_buf[KEYWORD_NAME_MAX];
     char *end  = key_buf + sizeof(key_buf) - 1;
     uint err_cnt = 0;
+    const KeywordIndex_t *ki = GetKeywordIndex(key_tab);
 
     for(;;)
     {
@@ -6203,13 +7267,13 @@ s64 ScanKeywordListEx
 	*dest = 0;
 	char prefix = 0;
 	int abbrev_count;
-	const KeywordTab_t * cptr = ScanKeyword(&abbrev_count,key_buf,key_tab);
+	const KeywordTab_t * cptr = ScanKeywordHelper(&abbrev_count,key_buf,key_tab,ki);
 	if ( !cptr && allow_prefix && key_buf[1]
 	    && (   *key_buf == '+' || *key_buf == '-'
 		|| *key_buf == '/' || *key_buf == '=' ))
 	{
 	    prefix = *key_buf == '/' ? '-' : *key_buf;
-	    cptr = ScanKeyword(&abbrev_count,key_buf+1,key_tab);
+	    cptr = ScanKeywordHelper(&abbrev_count,key_buf+1,key_tab,ki);
 	}
 
 	KeywordTab_t ct_num = { 0, key_buf, 0, 0 };
@@ -8994,122 +10058,446 @@ int PrintMultiColumn ( const MultiColumn_t *mc )
     else // !p.frame_mode
     //-------------------
     {
-	if (mc->print_header)
-	{
-	    mc_print_sep(&p);
+	if (mc->print_header)
+	{
+	    mc_print_sep(&p);
+
+	    fprintf(p.f,"%s%*s",p.prefix,p.indent,"");
+	    const mc_len_t *fw = p.fw_col;
+	    for ( int col = 0; col < p.n_cols; col++, fw++ )
+	    {
+		if (col)
+		    fputs(" | ",p.f);
+		fprintf(p.f,"%s%s%s",
+				AlignEUTF8ToCircBuf(p.head_key,-fw->key,fw->key),
+				p.sep,
+				AlignEUTF8ToCircBuf(p.head_val,-fw->val,fw->val) );
+	    }
+	    fputs(p.eol,p.f);
+	    out_lines += 2;
+	}
+
+	if ( mc->print_header || mc->print_footer )
+	{
+	    mc_print_sep(&p);
+	    out_lines++;
+	}
+
+	for ( int row = 0; row < p.n_rows; row++ )
+	{
+	    fprintf(p.f,"%s%*s",p.prefix,p.indent,"");
+	    const exmem_key_t *ptr = mc->list.list + row;
+	    const mc_len_t *fw = p.fw_col;
+	    for ( int col = 0; col < p.n_cols; col++, ptr += p.n_rows, fw++ )
+	    {
+		if (col)
+		    fputs(" | ",p.f);
+		if ( ptr < list_end )
+		{
+		    fprintf(p.f,"%s%s",
+				AlignEUTF8ToCircBuf(ptr->key,-fw->key,fw->key),
+				p.sep );
+
+
+		    if ( ptr->data.attrib > 1 )
+		    {
+			const int fw_attrib = ptr->data.attrib < fw->val ? ptr->data.attrib : fw->val;
+			const int fw_val = p.len_list[ptr-mc->list.list].val;
+			if ( fw_attrib <= fw_val )
+			    goto std0;
+			fprintf(p.f,"%s%*s",
+				AlignEUTF8ToCircBuf(ptr->data.data.ptr,fw_attrib,fw_attrib),
+				fw_attrib - fw->val, "" );
+		    }
+		    else
+		    {
+		     std0:;
+			const int fw_val = ptr->data.attrib ? -fw->val : fw->val;
+			fputs(AlignEUTF8ToCircBuf(ptr->data.data.ptr,fw_val,fw->val),p.f);
+		    }
+		}
+	    }
+	    fputs(p.eol,p.f);
+	}
+
+	if (mc->print_footer)
+	{
+	    mc_print_sep(&p);
+	    out_lines++;
+	}
+    }
+    //---------------------
+    // end-if !p.frame_mode
+    //---------------------
+
+
+    //--- terminate
+
+    if ( p.debug > 0 )
+    {
+	const u_usec_t now = GetTimerUSec();
+	fprintf(p.f,"#> setup in %llu us, %u ouput lines in %llu us, total %llu us%s",
+		output_time - start_time,
+		out_lines, now - output_time,
+		now - start_time,
+		p.eol );
+    }
+
+    FREE(p.len_list);
+    return out_lines;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    Memory Maps			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+void InitializeMemMap ( MemMap_t * mm )
+{
+    DASSERT(mm);
+    memset(mm,0,sizeof(*mm));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void FreeNodeMemMap ( MemMapNode_t *node )
+{
+    while (node)
+    {
+	FreeNodeMemMap(node->left);
+	MemMapNode_t *right = node->right;
+	FREE(node);
+	node = right;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ResetMemMap ( MemMap_t * mm )
+{
+    DASSERT(mm);
+
+    FreeNodeMemMap(mm->root);
+    FREE(mm->field);
+    memset(mm,0,sizeof(*mm));
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    Memory Map: interval tree		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static inline MemMapNode_t * GetNodeMemMap ( const MemMapItem_t *item )
+{
+    return (MemMapNode_t*)( (u8*)item - offsetof(MemMapNode_t,item) );
+}
+
+//-----------------------------------------------------------------------------
+
+static inline int GetHeightMemMap ( const MemMapNode_t *node )
+{
+    return node ? node->height : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static void UpdateNodeMemMap ( MemMapNode_t *node )
+{
+    // recalculate the augmented values from both children
+
+    DASSERT(node);
+    const MemMapNode_t *left  = node->left;
+    const MemMapNode_t *right = node->right;
+
+    const int hl = GetHeightMemMap(left);
+    const int hr = GetHeightMemMap(right);
+    node->height = ( hl > hr ? hl : hr ) + 1;
+
+    const u64 off = node->item.off;
+    const u64 end = off + node->item.size;
+    u64 max_end = end, max_gap = 0;
+
+    if (left)
+    {
+	node->min_off = left->min_off;
+	max_gap = left->max_gap;
+	if ( off > left->max_end && off - left->max_end > max_gap )
+	    max_gap = off - left->max_end;
+	if ( max_end < left->max_end )
+	     max_end = left->max_end;
+    }
+    else
+	node->min_off = off;
+
+    if (right)
+    {
+	// 'right->max_gap' ignores the ends of the left part
+	// and is therefore an upper limit only
+	if ( max_gap < right->max_gap )
+	     max_gap = right->max_gap;
+	if ( right->min_off > max_end && right->min_off - max_end > max_gap )
+	    max_gap = right->min_off - max_end;
+	if ( max_end < right->max_end )
+	     max_end = right->max_end;
+    }
+
+    node->max_end = max_end;
+    node->max_gap = max_gap;
+}
+
+//-----------------------------------------------------------------------------
+
+static MemMapNode_t * RotateMemMap ( MemMapNode_t *node, bool to_left )
+{
+    DASSERT(node);
+
+    MemMapNode_t *top;
+    if (to_left)
+    {
+	top = node->right;
+	node->right = top->left;
+	top->left = node;
+    }
+    else
+    {
+	top = node->left;
+	node->left = top->right;
+	top->right = node;
+    }
+    UpdateNodeMemMap(node);
+    UpdateNodeMemMap(top);
+    return top;
+}
+
+//-----------------------------------------------------------------------------
+
+static MemMapNode_t * BalanceMemMap ( MemMapNode_t *node )
+{
+    DASSERT(node);
+    UpdateNodeMemMap(node);
+
+    const int diff = GetHeightMemMap(node->left) - GetHeightMemMap(node->right);
+    if ( diff > 1 )
+    {
+	if ( GetHeightMemMap(node->left->left) < GetHeightMemMap(node->left->right) )
+	    node->left = RotateMemMap(node->left,true);
+	node = RotateMemMap(node,false);
+    }
+    else if ( diff < -1 )
+    {
+	if ( GetHeightMemMap(node->right->right) < GetHeightMemMap(node->right->left) )
+	    node->right = RotateMemMap(node->right,false);
+	node = RotateMemMap(node,true);
+    }
+    return node;
+}
+
+//-----------------------------------------------------------------------------
+
+static int CmpNodeMemMap ( const MemMapNode_t *n1, const MemMapNode_t *n2 )
+{
+    // compare keys 'off', 'size' and 'seq'
+
+    DASSERT(n1);
+    DASSERT(n2);
+
+    return n1->item.off  < n2->item.off  ? -1 : n1->item.off  > n2->item.off  ? 1
+	 : n1->item.size < n2->item.size ? -1 : n1->item.size > n2->item.size ? 1
+	 : n1->seq < n2->seq ? -1 : n1->seq > n2->seq;
+}
+
+//-----------------------------------------------------------------------------
+
+static MemMapNode_t * InsertNodeHelper ( MemMapNode_t *tree, MemMapNode_t *node )
+{
+    if (!tree)
+    {
+	node->left = node->right = 0;
+	UpdateNodeMemMap(node);
+	return node;
+    }
+
+    if ( CmpNodeMemMap(node,tree) < 0 )
+	tree->left = InsertNodeHelper(tree->left,node);
+    else
+	tree->right = InsertNodeHelper(tree->right,node);
+    return BalanceMemMap(tree);
+}
+
+//-----------------------------------------------------------------------------
+
+static MemMapNode_t * RemoveMinNodeHelper
+	( MemMapNode_t *tree, MemMapNode_t **min_node )
+{
+    DASSERT(tree);
+    if (!tree->left)
+    {
+	*min_node = tree;
+	return tree->right;
+    }
+    tree->left = RemoveMinNodeHelper(tree->left,min_node);
+    return BalanceMemMap(tree);
+}
+
+//-----------------------------------------------------------------------------
+
+static MemMapNode_t * RemoveNodeHelper ( MemMapNode_t *tree, MemMapNode_t *node )
+{
+    // remove 'node' from 'tree', but don't free it
+
+    DASSERT(tree);
+    DASSERT(node);
+
+    const int cmp = CmpNodeMemMap(node,tree);
+    if ( cmp < 0 )
+	tree->left = RemoveNodeHelper(tree->left,node);
+    else if ( cmp > 0 )
+	tree->right = RemoveNodeHelper(tree->right,node);
+    else
+    {
+	DASSERT( tree == node );
+	if (!tree->right)
+	    return tree->left;
+
+	MemMapNode_t *succ;
+	MemMapNode_t *right = RemoveMinNodeHelper(tree->right,&succ);
+	succ->left  = tree->left;
+	succ->right = right;
+	tree = succ;
+    }
+    return BalanceMemMap(tree);
+}
+
+//-----------------------------------------------------------------------------
+
+static uint FindFieldMemMap ( const MemMap_t *mm, const MemMapNode_t *node )
+{
+    // binary search of 'node' in 'mm->field'
+    // returns the index of 'node' or the insert position
+
+    DASSERT(mm);
+    DASSERT(node);
+
+    uint beg = 0, end = mm->used;
+    while ( beg < end )
+    {
+	const uint idx = (beg+end)/2;
+	const int cmp = CmpNodeMemMap(node,GetNodeMemMap(mm->field[idx]));
+	if ( cmp < 0 )
+	    end = idx;
+	else if ( cmp > 0 )
+	    beg = idx + 1;
+	else
+	    return idx;
+    }
+    return beg;
+}
 
-	    fprintf(p.f,"%s%*s",p.prefix,p.indent,"");
-	    const mc_len_t *fw = p.fw_col;
-	    for ( int col = 0; col < p.n_cols; col++, fw++ )
-	    {
-		if (col)
-		    fputs(" | ",p.f);
-		fprintf(p.f,"%s%s%s",
-				AlignEUTF8ToCircBuf(p.head_key,-fw->key,fw->key),
-				p.sep,
-				AlignEUTF8ToCircBuf(p.head_val,-fw->val,fw->val) );
-	    }
-	    fputs(p.eol,p.f);
-	    out_lines += 2;
-	}
+//-----------------------------------------------------------------------------
 
-	if ( mc->print_header || mc->print_footer )
-	{
-	    mc_print_sep(&p);
-	    out_lines++;
-	}
+static MemMapNode_t * InsertNodeMemMap ( MemMap_t *mm, u64 off, u64 size )
+{
+    DASSERT(mm);
 
-	for ( int row = 0; row < p.n_rows; row++ )
-	{
-	    fprintf(p.f,"%s%*s",p.prefix,p.indent,"");
-	    const exmem_key_t *ptr = mc->list.list + row;
-	    const mc_len_t *fw = p.fw_col;
-	    for ( int col = 0; col < p.n_cols; col++, ptr += p.n_rows, fw++ )
-	    {
-		if (col)
-		    fputs(" | ",p.f);
-		if ( ptr < list_end )
-		{
-		    fprintf(p.f,"%s%s",
-				AlignEUTF8ToCircBuf(ptr->key,-fw->key,fw->key),
-				p.sep );
+    MemMapNode_t *node = CALLOC(sizeof(*node),1);
+    node->item.off  = off;
+    node->item.size = size;
+    node->seq	    = mm->seq++;
 
+    mm->root = InsertNodeHelper(mm->root,node);
+    mm->used++;
+    mm->field_dirty = true;
+    return node;
+}
 
-		    if ( ptr->data.attrib > 1 )
-		    {
-			const int fw_attrib = ptr->data.attrib < fw->val ? ptr->data.attrib : fw->val;
-			const int fw_val = p.len_list[ptr-mc->list.list].val;
-			if ( fw_attrib <= fw_val )
-			    goto std0;
-			fprintf(p.f,"%s%*s",
-				AlignEUTF8ToCircBuf(ptr->data.data.ptr,fw_attrib,fw_attrib),
-				fw_attrib - fw->val, "" );
-		    }
-		    else
-		    {
-		     std0:;
-			const int fw_val = ptr->data.attrib ? -fw->val : fw->val;
-			fputs(AlignEUTF8ToCircBuf(ptr->data.data.ptr,fw_val,fw->val),p.f);
-		    }
-		}
-	    }
-	    fputs(p.eol,p.f);
-	}
+//-----------------------------------------------------------------------------
 
-	if (mc->print_footer)
+static MemMapNode_t * GetNeighborMemMap
+	( const MemMap_t *mm, const MemMapNode_t *node, bool next )
+{
+    // return the previous or next node in sort order
+
+    DASSERT(mm);
+    DASSERT(node);
+
+    MemMapNode_t *res = 0, *tree = mm->root;
+    while (tree)
+    {
+	const int cmp = CmpNodeMemMap(node,tree);
+	if ( next ? cmp < 0 : cmp > 0 )
 	{
-	    mc_print_sep(&p);
-	    out_lines++;
+	    res = tree;
+	    tree = next ? tree->left : tree->right;
 	}
+	else
+	    tree = next ? tree->right : tree->left;
     }
-    //---------------------
-    // end-if !p.frame_mode
-    //---------------------
-
+    return res;
+}
 
-    //--- terminate
+//-----------------------------------------------------------------------------
 
-    if ( p.debug > 0 )
+static void FillFieldMemMap ( MemMapItem_t ***dest, MemMapNode_t *node )
+{
+    while (node)
     {
-	const u_usec_t now = GetTimerUSec();
-	fprintf(p.f,"#> setup in %llu us, %u ouput lines in %llu us, total %llu us%s",
-		output_time - start_time,
-		out_lines, now - output_time,
-		now - start_time,
-		p.eol );
+	FillFieldMemMap(dest,node->left);
+	*(*dest)++ = &node->item;
+	node = node->right;
     }
-
-    FREE(p.len_list);
-    return out_lines;
 }
 
-//
-///////////////////////////////////////////////////////////////////////////////
-///////////////			    Memory Maps			///////////////
-///////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
 
-void InitializeMemMap ( MemMap_t * mm )
+void SyncMemMap ( MemMap_t * mm )
 {
     DASSERT(mm);
-    memset(mm,0,sizeof(*mm));
+    if (!mm->field_dirty)
+	return;
+
+    if ( mm->size < mm->used )
+    {
+	mm->size = ( mm->used + 64 ) / 64 * 64;
+	FREE(mm->field);
+	mm->field = MALLOC(mm->size*sizeof(*mm->field));
+    }
+
+    MemMapItem_t **dest = mm->field;
+    FillFieldMemMap(&dest,mm->root);
+    DASSERT( dest == mm->field + mm->used );
+    mm->field_dirty = false;
 }
 
-///////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
 
-void ResetMemMap ( MemMap_t * mm )
+const MemMapItem_t * GetNextMemMap
+(
+    // returns the first item (prev==NULL) or the successor of 'prev',
+    // or NULL at the end
+
+    const MemMap_t	* mm,		// valid mem map
+    const MemMapItem_t	* prev		// NULL or an item of 'mm'
+)
 {
     DASSERT(mm);
 
-    uint i;
-    if (mm->field)
+    if (prev)
     {
-	for ( i = 0; i < mm->used; i++ )
-	    FREE(mm->field[i]);
-	FREE(mm->field);
+	const MemMapNode_t *node = GetNeighborMemMap(mm,GetNodeMemMap(prev),true);
+	return node ? &node->item : 0;
     }
-    memset(mm,0,sizeof(*mm));
+
+    const MemMapNode_t *node = mm->root;
+    if (!node)
+	return 0;
+    while (node->left)
+	node = node->left;
+    return &node->item;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    Memory Map: interface		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 void CopyMemMap
@@ -9126,6 +10514,26 @@ void CopyMemMap
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static void MergeNodeMemMap
+	( MemMap_t *mm, const MemMapNode_t *node, bool use_tie )
+{
+    while (node)
+    {
+	MergeNodeMemMap(mm,node->left,use_tie);
+
+	const MemMapItem_t *src = &node->item;
+	MemMapItem_t *it = use_tie
+		? InsertMemMapTie(mm,src->off,src->size)
+		: InsertMemMap(mm,src->off,src->size);
+	if (it)
+	    StringCopyS(it->info,sizeof(it->info),src->info);
+
+	node = node->right;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void MergeMemMap
 (
     MemMap_t		* mm1,		// merged mem map, not NULL, not cleared
@@ -9135,46 +10543,41 @@ void MergeMemMap
 {
     DASSERT(mm1);
     if (mm2)
-    {
-	uint i;
-	for ( i = 0; i < mm2->used; i++ )
-	{
-	    const MemMapItem_t *src = mm2->field[i];
-	    if (src)
-	    {
-		MemMapItem_t *it = use_tie
-			? InsertMemMapTie(mm1,src->off,src->size)
-			: InsertMemMap(mm1,src->off,src->size);
-		if (it)
-		    StringCopyS(it->info,sizeof(it->info),src->info);
-	    }
-	}
-    }
+	MergeNodeMemMap(mm1,mm2->root,use_tie);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-MemMapItem_t * FindMemMap ( MemMap_t * mm, off_t off, off_t size )
+static MemMapItem_t * FindNodeMemMap
+	( MemMapNode_t *node, u64 off, u64 off_end )
 {
-    DASSERT(mm);
+    // find first item overlapping 'off..off_end'
 
-    off_t off_end = off + size;
-    int beg = 0;
-    int end = mm->used - 1;
-    while ( beg <= end )
+    while ( node && node->max_end > off )
     {
-	uint idx = (beg+end)/2;
-	MemMapItem_t * mi = mm->field[idx];
+	MemMapItem_t *res = FindNodeMemMap(node->left,off,off_end);
+	if (res)
+	    return res;
+
+	MemMapItem_t *mi = &node->item;
 	if ( off_end <= mi->off )
-	    end = idx - 1 ;
-	else if ( off >= mi->off + mi->size )
-	    beg = idx + 1;
-	else
+	    break; // all other items have larger offsets
+	if ( off < mi->off + mi->size )
 	    return mi;
+
+	node = node->right;
     }
     return 0;
 }
 
+//-----------------------------------------------------------------------------
+
+MemMapItem_t * FindMemMap ( MemMap_t * mm, off_t off, off_t size )
+{
+    DASSERT(mm);
+    return FindNodeMemMap(mm->root,off,off+size);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 uint InsertMemMapIndex
@@ -9187,26 +10590,9 @@ uint InsertMemMapIndex
 )
 {
     DASSERT(mm);
-    uint idx = FindMemMapHelper(mm,off,size);
-
-    DASSERT( mm->used <= mm->size );
-    if ( mm->used == mm->size )
-    {
-	mm->size += 64;
-	mm->field = REALLOC(mm->field,mm->size*sizeof(*mm->field));
-    }
-
-    DASSERT( idx <= mm->used );
-    MemMapItem_t ** dest = mm->field + idx;
-    memmove(dest+1,dest,(mm->used-idx)*sizeof(*dest));
-    mm->used++;
-
-    MemMapItem_t * mi = MALLOC(sizeof(MemMapItem_t));
-    mi->off  = off;
-    mi->size = size;
-    mi->overlap = 0;
-    *dest = mi;
-    return idx;
+    const MemMapNode_t *node = InsertNodeMemMap(mm,off,size);
+    SyncMemMap(mm);
+    return FindFieldMemMap(mm,node);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -9220,42 +10606,43 @@ MemMapItem_t * InsertMemMap
     off_t		size		// size of area
 )
 {
-    const uint idx = InsertMemMapIndex(mm,off,size);
-    // a C sequence point is important here
-    return mm->field[idx];
+    return &InsertNodeMemMap(mm,off,size)->item;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static bool TieMemMap
+static MemMapNode_t * TieMemMap
 (
-    // returns true if element are tied togehther
+    // returns the tied node, if element are tied togehther, or NULL
 
     MemMap_t		* mm,		// mem map pointer
-    uint		idx,		// tie element 'idx' and 'idx+1'
-    bool		force		// always tie and not only if overlapped
+    MemMapNode_t	* n1,		// tie elements 'n1' and 'n2'
+    MemMapNode_t	* n2		// 'n2' is the successor of 'n1'
 )
 {
     DASSERT(mm);
-    DASSERT( idx+1 < mm->used );
+    DASSERT(n1);
+    DASSERT(n2);
 
-    MemMapItem_t * i1 = mm->field[idx];
-    MemMapItem_t * i2 = mm->field[idx+1];
-    if ( force || i1->off + i1->size >= i2->off )
+    MemMapItem_t * i1 = &n1->item;
+    MemMapItem_t * i2 = &n2->item;
+    if ( i1->off + i1->size >= i2->off )
     {
+	mm->root = RemoveNodeHelper(mm->root,n2);
 	const off_t new_size = i2->off + i2->size - i1->off;
 	if ( i1->size < new_size )
-	     i1->size = new_size;
-	FREE(i2);
-	idx++;
+	{
+	    // the key is modified => reinsert node
+	    mm->root = RemoveNodeHelper(mm->root,n1);
+	    i1->size = new_size;
+	    mm->root = InsertNodeHelper(mm->root,n1);
+	}
+	FREE(n2);
 	mm->used--;
-	memmove( mm->field + idx,
-		 mm->field + idx + 1,
-		 ( mm->used - idx ) * sizeof(MemMapItem_t*) );
-
-	return true;
+	mm->field_dirty = true;
+	return n1;
     }
-    return false;
+    return 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -9269,15 +10656,24 @@ MemMapItem_t * InsertMemMapTie
     off_t		size		// size of area
 )
 {
-    uint idx = InsertMemMapIndex(mm,off,size);
+    MemMapNode_t *node = InsertNodeMemMap(mm,off,size);
 
-    if ( idx > 0 && TieMemMap(mm,idx-1,false) )
-	idx--;
+    MemMapNode_t *prev = GetNeighborMemMap(mm,node,false);
+    if (prev)
+    {
+	MemMapNode_t *tied = TieMemMap(mm,prev,node);
+	if (tied)
+	    node = tied;
+    }
 
-    while ( idx + 1 < mm->used && TieMemMap(mm,idx,false) )
-	;
+    for(;;)
+    {
+	MemMapNode_t *next = GetNeighborMemMap(mm,node,true);
+	if ( !next || !TieMemMap(mm,node,next) )
+	    break;
+    }
 
-    return mm->field[idx];
+    return &node->item;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -9301,6 +10697,7 @@ void InsertMemMapWrapper
 uint FindMemMapHelper ( MemMap_t * mm, off_t off, off_t size )
 {
     DASSERT(mm);
+    SyncMemMap(mm);
 
     int beg = 0;
     int end = mm->used - 1;
@@ -9334,6 +10731,7 @@ uint FindMemMapHelper ( MemMap_t * mm, off_t off, off_t size )
 uint CalcOverlapMemMap ( MemMap_t * mm )
 {
     DASSERT(mm);
+    SyncMemMap(mm);
 
     uint i, count = 0;
     MemMapItem_t * prev = 0;
@@ -9354,6 +10752,55 @@ uint CalcOverlapMemMap ( MemMap_t * mm )
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static bool FindFreeSpaceNode
+(
+    // returns true if found; the result is stored in '*addr'
+
+    const MemMapNode_t	*node,		// NULL or node to search
+    u64			*addr,		// current address, always aligned
+    u64			size,		// minimal size
+    u64			align,		// aligning
+    u64			*space		// store available space here
+)
+{
+    while (node)
+    {
+	// Skip the whole subtree, if no item can provide enough space.
+	// Both limits are upper limits of the aligned spaces.
+
+	if ( ( node->min_off <= *addr || node->min_off - *addr < size )
+		&& node->max_gap < size )
+	{
+	    const u64 end = ALIGN64(node->max_end,align);
+	    if ( *addr < end )
+		*addr = end;
+	    return false;
+	}
+
+	if (FindFreeSpaceNode(node->left,addr,size,align,space))
+	    return true;
+
+	const MemMapItem_t *mi = &node->item;
+	const u64 end = ALIGN64( mi->off + mi->size, align );
+	if ( mi->off > *addr )
+	{
+	    u64 found_space = ALIGNOFF64(mi->off,align) - *addr;
+	    if ( size <= found_space )
+	    {
+		*space = found_space;
+		return true;
+	    }
+	}
+	if ( *addr < end )
+	    *addr = end;
+
+	node = node->right;
+    }
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
 u64 FindFreeSpaceMemMap
 (
     // return address or NULL on not-found
@@ -9375,26 +10822,15 @@ u64 FindFreeSpaceMemMap
 	align = 1;
     addr_beg = ALIGN64(addr_beg,align);
 
-    uint i;
-    for ( i = 0; i < mm->used; i++ )
+    u64 found_space;
+    if (FindFreeSpaceNode(mm->root,&addr_beg,size,align,&found_space))
     {
-	MemMapItem_t *mi = mm->field[i];
-	const u64 end = ALIGN64( mi->off + mi->size, align );
-	if ( mi->off > addr_beg )
-	{
-	    u64 found_space = ALIGNOFF64(mi->off,align) - addr_beg;
-	    if ( size <= found_space )
-	    {
-		if (space)
-		    *space = found_space;
-		return addr_beg;
-	    }
-	}
-	if ( addr_beg < end )
-	    addr_beg = end;
+	if (space)
+	    *space = found_space;
+	return addr_beg;
     }
 
-    u64 found_space = ALIGNOFF64(addr_end,align) - addr_beg;
+    found_space = ALIGNOFF64(addr_end,align) - addr_beg;
     if ( size <= found_space )
     {
 	if (space)
@@ -10215,6 +11651,48 @@ static const uint grow_buffer_size_factor = 0x100;
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static inline u8 * GetBufEndGrowBuffer ( const GrowBuffer_t *gb )
+{
+    // a mirrored buffer is mapped twice, so 'ptr' may point into both halfs
+    DASSERT(gb);
+    return gb->buf + ( gb->is_mirrored ? 2*gb->size+1 : gb->size );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void AllocBufGrowBuffer ( GrowBuffer_t *gb )
+{
+    // alloc 'gb->size'+1 bytes (1 extra byte for NULL-TERM)
+    DASSERT(gb);
+
+    if (gb->mirror)
+    {
+	uint map_size = gb->size + 1;
+	gb->buf = AllocMirrorMap(&map_size);
+	if (gb->buf)
+	{
+	    gb->size = map_size - 1;
+	    gb->is_mirrored = true;
+	    return;
+	}
+    }
+
+    gb->buf = MALLOC(gb->size+1);
+    gb->is_mirrored = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void FreeBufGrowBuffer ( u8 *buf, uint size, bool is_mirrored )
+{
+    if (is_mirrored)
+	FreeMirrorMap(buf,size+1);
+    else
+	FREE(buf);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void InitializeGrowBuffer ( GrowBuffer_t *gb, uint max_buf_size )
 {
     DASSERT(gb);
@@ -10229,10 +11707,12 @@ void InitializeGrowBuffer ( GrowBuffer_t *gb, uint max_buf_size )
 void ResetGrowBuffer ( GrowBuffer_t *gb )
 {
     DASSERT(gb);
-    FREE(gb->buf);
+    FreeBufGrowBuffer(gb->buf,gb->size,gb->is_mirrored);
     const uint grow_size = gb->grow_size;
+    const bool mirror = gb->mirror;
     InitializeGrowBuffer(gb,gb->max_size);
     gb->grow_size = grow_size;
+    gb->mirror = mirror;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -10265,7 +11745,7 @@ uint PrepareGrowBuffer
     {
 	DASSERT( gb->used <= gb->size );
 	DASSERT( gb->ptr >= gb->buf );
-	DASSERT( gb->ptr + gb->used <= gb->buf + gb->size );
+	DASSERT( gb->ptr + gb->used <= GetBufEndGrowBuffer(gb) );
     }
     else
     {
@@ -10298,7 +11778,8 @@ uint PrepareGrowBuffer
 	    gb->size =	( size + gb->grow_size )
 			/ gb->grow_size * gb->grow_size - 1;
 
-	gb->buf = gb->ptr = MALLOC(gb->size+1);  // 1 extra byte for NULL-TERM
+	AllocBufGrowBuffer(gb);
+	gb->ptr  = gb->buf;
 	gb->used = 0;
     }
     else
@@ -10315,26 +11796,39 @@ uint PrepareGrowBuffer
     {
 	//--- grow buffer
 
+	u8 *oldbuf = gb->buf;
+	const uint oldsize = gb->size;
+	const bool old_mirrored = gb->is_mirrored;
+
 	gb->size = ( size + gb->used + gb->grow_size )
 		   / gb->grow_size * gb->grow_size - 1;
 	DASSERT( gb->used <= gb->size );
-	u8 *newbuf = MALLOC(gb->size+1); // 1 extra byte for NULL-TERM
-	memcpy(newbuf,gb->ptr,gb->used);
-	FREE(gb->buf);
-	gb->buf = gb->ptr = newbuf;
+	AllocBufGrowBuffer(gb);
+	memcpy(gb->buf,gb->ptr,gb->used);
+	FreeBufGrowBuffer(oldbuf,oldsize,old_mirrored);
+	gb->ptr = gb->buf;
     }
 
-    uint space = ( gb->buf + gb->size ) - ( gb->ptr + gb->used );
-    if ( space < size && gb->buf != gb->ptr )
+    uint space;
+    if (gb->is_mirrored)
     {
-	memmove(gb->buf,gb->ptr,gb->used);
-	gb->ptr = gb->buf;
+	// the free space behind the data is always contiguous
 	space = gb->size - gb->used;
     }
+    else
+    {
+	space = ( gb->buf + gb->size ) - ( gb->ptr + gb->used );
+	if ( space < size && gb->buf != gb->ptr )
+	{
+	    memmove(gb->buf,gb->ptr,gb->used);
+	    gb->ptr = gb->buf;
+	    space = gb->size - gb->used;
+	}
+    }
 
     DASSERT( gb->used <= gb->size );
     DASSERT( gb->ptr >= gb->buf );
-    DASSERT( gb->ptr + gb->used <= gb->buf + gb->size );
+    DASSERT( gb->ptr + gb->used <= GetBufEndGrowBuffer(gb) );
 
     return size < space ? size : space;
 }
@@ -10352,7 +11846,7 @@ uint InsertGrowBuffer
 {
     DASSERT(gb);
     size = PrepareGrowBuffer(gb,size,false);
-    DASSERT( gb->ptr + gb->used + size <= gb->buf + gb->size );
+    DASSERT( gb->ptr + gb->used + size <= GetBufEndGrowBuffer(gb) );
     memcpy( gb->ptr + gb->used, data, size );
     gb->used += size;
     gb->ptr[gb->used] = 0;
@@ -10361,7 +11855,7 @@ uint InsertGrowBuffer
 
     DASSERT( gb->used <= gb->size );
     DASSERT( gb->ptr >= gb->buf );
-    DASSERT( gb->ptr + gb->used <= gb->buf + gb->size );
+    DASSERT( gb->ptr + gb->used <= GetBufEndGrowBuffer(gb) );
 
     return size;
 }
@@ -10610,7 +12104,7 @@ uint PurgeGrowBuffer ( GrowBuffer_t *gb )
     if (!gb->used)
 	return ClearGrowBuffer(gb);
 
-    if ( gb->ptr > gb->buf )
+    if ( gb->ptr > gb->buf && !gb->is_mirrored )
     {
 	memmove(gb->buf,gb->ptr,gb->used);
 	gb->ptr = gb->buf;
@@ -10634,7 +12128,7 @@ uint DropGrowBuffer
     {
 	DASSERT_MSG( gb->used < gb->size, "%d/%d\n",gb->used,gb->size);
 	DASSERT( gb->ptr >= gb->buf );
-	DASSERT( gb->ptr + gb->used <= gb->buf + gb->size );
+	DASSERT( gb->ptr + gb->used <= GetBufEndGrowBuffer(gb) );
     }
     else
     {
@@ -10658,6 +12152,8 @@ uint DropGrowBuffer
 
     gb->ptr  += size;
     gb->used -= size;
+    if ( gb->is_mirrored && gb->ptr > gb->buf + gb->size )
+	gb->ptr -= gb->size + 1; // wrap into first half of the mirror
     return size;
 }
 
@@ -10732,7 +12228,7 @@ int CloseFileGrowBuffer
 	return -1;
 
     const int stat = ftell(f);
-    if ( stat >= 0 && gb->ptr + gb->used + stat <= gb->buf + gb->size )
+    if ( stat >= 0 && gb->ptr + gb->used + stat <= GetBufEndGrowBuffer(gb) )
 	gb->used += stat;
 
     fclose(f);
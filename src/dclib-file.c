@@ -122,49 +122,55 @@ int GetLogTimestamp ( char *buf, uint buf_size, TimestampMode_t ts_mode )
     DASSERT(buf);
     DASSERT(buf_size>2);
 
-    uint len;
-    if ( ts_mode >= TSM_USEC )
+    if ( ts_mode < TSM_SEC )
     {
-	const u64 usec = GetTimeUSec(false);
-	const uint sec = usec/1000000 % SEC_PER_DAY;
-	len = snprintf(buf,buf_size,
-		"%02u:%02u:%02u.%06llu ",
-		sec / 3600,
-		sec / 60 % 60,
-		sec % 60,
-		usec % 1000000 );
+	*buf = 0;
+	return 0;
     }
-    else if ( ts_mode >= TSM_MSEC )
+
+    u_sec_t sec;
+    uint usec = 0;
+    if ( ts_mode >= TSM_MSEC )
     {
-	const u64 msec = GetTimeMSec(false);
-	const uint sec = msec/USEC_PER_MSEC % SEC_PER_DAY;
-	len = snprintf(buf,buf_size,
-		"%02u:%02u:%02u.%03llu ",
-		sec / 3600,
-		sec / 60 % 60,
-		sec % 60,
-		msec % 1000 );
+	const u_usec_t now = GetTimeUSec(false);
+	sec  = now / USEC_PER_SEC;
+	usec = now % USEC_PER_SEC;
     }
-    else if ( ts_mode >= TSM_SEC )
+    else
+	sec = GetTimeSec(false);
+
+    // "HH:MM:SS" is formatted only once per second and thread
+    static __thread u_sec_t last_sec = 0;
+    static __thread char hms[8] = "00:00:00";
+    if ( sec != last_sec )
     {
-	const uint sec = GetTimeSec(false) % SEC_PER_DAY;
-	len = snprintf(buf,buf_size,
-		"%02u:%02u:%02u ",
-		sec / 3600,
-		sec / 60 % 60,
-		sec % 60 );
+	last_sec = sec;
+	const uint day_sec = sec % SEC_PER_DAY;
+	PrintFixedDecimal(hms,  day_sec / 3600,    2);
+	PrintFixedDecimal(hms+3,day_sec / 60 % 60, 2);
+	PrintFixedDecimal(hms+6,day_sec % 60,      2);
     }
-    else
+
+    char temp[20], *dest = temp;
+    memcpy(dest,hms,sizeof(hms));
+    dest += sizeof(hms);
+    if ( ts_mode >= TSM_USEC )
     {
-	*buf = 0;
-	len = 0;
+	*dest++ = '.';
+	dest = PrintFixedDecimal(dest,usec,6);
+    }
+    else if ( ts_mode >= TSM_MSEC )
+    {
+	*dest++ = '.';
+	dest = PrintFixedDecimal(dest,usec/USEC_PER_MSEC,3);
     }
+    *dest++ = ' ';
 
+    uint len = dest - temp;
     if ( len >= buf_size )
-    {
 	len = buf_size - 1;
-	buf[len] = 0;
-    }
+    memcpy(buf,temp,len);
+    buf[len] = 0;
     return len;
 }
 
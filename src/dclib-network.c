@@ -4091,6 +4091,12 @@ TCPStream_t * CreateTCPStream
 	LogTCPStreamActivity(ts,"CreateTCPStream");
     }
 
+    if (th->mirror_buffers)
+    {
+	EnableMirrorGrowBuffer(&ts->ibuf);
+	EnableMirrorGrowBuffer(&ts->obuf);
+    }
+
     ts->allow_mode = allow_mode;
     AddTCPStream(th,ts);
 
@@ -43,7 +43,9 @@
 #include <sys/time.h>
 #include <sys/resource.h>
 #include <fcntl.h>
+#include <pthread.h>
 
+#include "dclib-simd.h"
 #include "dclib/dclib-basics.h"
 #include "dclib/dclib-debug.h"
 #include "dclib/dclib-utf8.h"
@@ -53,12 +55,58 @@
 ///////////////				bits			///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+// The bit scanners process 8 bytes at once by loading them as little or
+// big endian 64-bit words (le64() and be64() are reduced to a single load
+// by the compiler) and use the popcount, ctz and clz builtins. Remaining
+// bytes are scanned by the tables.
+
+#if __GNUC__ > 3
+  #define BITS_WORD_WISE 1
+#else
+  #define BITS_WORD_WISE 0
+#endif
+
+#if BITS_WORD_WISE && defined(__x86_64__) && defined(__linux__) \
+	&& __GNUC__ >= 6 && !defined(__clang__)
+  #define TARGET_POPCNT __attribute__((target_clones("popcnt","default")))
+#else
+  #define TARGET_POPCNT
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+#if BITS_WORD_WISE
+
+ TARGET_POPCNT
+ static uint Count1BitsWords ( const uchar *ptr, uint n_words )
+ {
+    uint count = 0;
+    while ( n_words-- > 0 )
+    {
+	count += __builtin_popcountll(le64(ptr));
+	ptr += 8;
+    }
+    return count;
+ }
+
+#endif
+
+//-----------------------------------------------------------------------------
+
 uint Count1Bits ( cvp addr, uint size )
 {
     DASSERT( CHAR_BIT == 8 );
 
     uint count = 0;
     const uchar *ptr = addr;
+
+ #if BITS_WORD_WISE
+    const uint n_words = size / 8;
+    count = Count1BitsWords(ptr,n_words);
+    ptr  += 8 * n_words;
+    size -= 8 * n_words;
+ #endif
+
     while ( size-- > 0 )
 	count += TableBitCount[*ptr++];
     return count;
@@ -72,8 +120,18 @@ int FindLowest0BitLE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr;
-    uint idx;
-    for ( idx = 0; idx < size; idx++ )
+    uint idx = 0;
+
+ #if BITS_WORD_WISE
+    for ( ; idx + 8 <= size; idx += 8, ptr += 8 )
+    {
+	const u64 data = ~le64(ptr);
+	if (data)
+	    return 8*idx + __builtin_ctzll(data);
+    }
+ #endif
+
+    for ( ; idx < size; idx++ )
     {
 	const int val = TableLowest0Bit[*ptr++];
 	if ( val >= 0 )
@@ -89,8 +147,18 @@ int FindLowest1BitLE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr;
-    uint idx;
-    for ( idx = 0; idx < size; idx++ )
+    uint idx = 0;
+
+ #if BITS_WORD_WISE
+    for ( ; idx + 8 <= size; idx += 8, ptr += 8 )
+    {
+	const u64 data = le64(ptr);
+	if (data)
+	    return 8*idx + __builtin_ctzll(data);
+    }
+ #endif
+
+    for ( ; idx < size; idx++ )
     {
 	const int val = TableLowest1Bit[*ptr++];
 	if ( val >= 0 )
@@ -106,6 +174,18 @@ int FindHighest0BitLE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr + size;
+
+ #if BITS_WORD_WISE
+    while ( size >= 8 )
+    {
+	ptr  -= 8;
+	size -= 8;
+	const u64 data = ~le64(ptr);
+	if (data)
+	    return 8*size + 63 - __builtin_clzll(data);
+    }
+ #endif
+
     while ( size-- > 0 )
     {
 	const int val = TableHighest0Bit[*--ptr];
@@ -122,6 +202,18 @@ int FindHighest1BitLE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr + size;
+
+ #if BITS_WORD_WISE
+    while ( size >= 8 )
+    {
+	ptr  -= 8;
+	size -= 8;
+	const u64 data = le64(ptr);
+	if (data)
+	    return 8*size + 63 - __builtin_clzll(data);
+    }
+ #endif
+
     while ( size-- > 0 )
     {
 	const int val = TableHighest1Bit[*--ptr];
@@ -156,8 +248,19 @@ int FindLowest0BitBE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr + size;
-    uint idx;
-    for ( idx = 0; idx < size; idx++ )
+    uint idx = 0;
+
+ #if BITS_WORD_WISE
+    for ( ; idx + 8 <= size; idx += 8 )
+    {
+	ptr -= 8;
+	const u64 data = ~be64(ptr);
+	if (data)
+	    return 8*idx + __builtin_ctzll(data);
+    }
+ #endif
+
+    for ( ; idx < size; idx++ )
     {
 	const int val = TableLowest0Bit[*--ptr];
 	if ( val >= 0 )
@@ -173,8 +276,19 @@ int FindLowest1BitBE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr + size;
-    uint idx;
-    for ( idx = 0; idx < size; idx++ )
+    uint idx = 0;
+
+ #if BITS_WORD_WISE
+    for ( ; idx + 8 <= size; idx += 8 )
+    {
+	ptr -= 8;
+	const u64 data = be64(ptr);
+	if (data)
+	    return 8*idx + __builtin_ctzll(data);
+    }
+ #endif
+
+    for ( ; idx < size; idx++ )
     {
 	const int val = TableLowest1Bit[*--ptr];
 	if ( val >= 0 )
@@ -190,6 +304,18 @@ int FindHighest0BitBE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr;
+
+ #if BITS_WORD_WISE
+    while ( size >= 8 )
+    {
+	size -= 8;
+	const u64 data = ~be64(ptr);
+	ptr += 8;
+	if (data)
+	    return 8*size + 63 - __builtin_clzll(data);
+    }
+ #endif
+
     while ( size-- > 0 )
     {
 	const int val = TableHighest0Bit[*ptr++];
@@ -206,6 +332,18 @@ int FindHighest1BitBE ( cvp addr, uint size )
     DASSERT( CHAR_BIT == 8 );
 
     const uchar *ptr = addr;
+
+ #if BITS_WORD_WISE
+    while ( size >= 8 )
+    {
+	size -= 8;
+	const u64 data = be64(ptr);
+	ptr += 8;
+	if (data)
+	    return 8*size + 63 - __builtin_clzll(data);
+    }
+ #endif
+
     while ( size-- > 0 )
     {
 	const int val = TableHighest1Bit[*ptr++];
@@ -273,8 +411,7 @@ void SetBits ( void *addr, uint beg_bitnum, uint end_bitnum )
 	    uchar * end = (uchar*)addr + hi8;
 	    *end |= tab2[ end_bitnum & 7 ];
 
-	    while ( dest < end )
-		*dest++ = 0xff;
+	    memset(dest,0xff,end-dest);
 	}
 	else
 	{
@@ -305,8 +442,7 @@ void ClearBits ( void *addr, uint beg_bitnum, uint end_bitnum )
 	    uchar * end = (uchar*)addr + hi8;
 	    *end &= tab2[ end_bitnum & 7 ];
 
-	    while ( dest < end )
-		*dest++ = 0;
+	    memset(dest,0,end-dest);
 	}
 	else
 	{
@@ -338,6 +474,13 @@ void InvertBits ( void *addr, uint beg_bitnum, uint end_bitnum )
 	    uchar * end = (uchar*)addr + hi8;
 	    *end ^= tab2[ end_bitnum & 7 ];
 
+	    for ( ; dest + 8 <= end; dest += 8 )
+	    {
+		u64 data;
+		memcpy(&data,dest,sizeof(data));
+		data = ~data;
+		memcpy(dest,&data,sizeof(data));
+	    }
 	    while ( dest < end )
 		*dest++ ^= 0xff;
 	}
@@ -460,6 +603,240 @@ int PrintBitfieldEx
 }
 
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			    Bitmap_t			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+#define BITMAP_BLOCK_SIZE ( BITMAP_BLOCK_BITS / 8 )
+
+///////////////////////////////////////////////////////////////////////////////
+
+void InitializeBitmap ( Bitmap_t *bm, uint n_bits )
+{
+    DASSERT(bm);
+    memset(bm,0,sizeof(*bm));
+    bm->n_bits  = n_bits;
+    bm->n_block = ( n_bits + BITMAP_BLOCK_BITS - 1 ) / BITMAP_BLOCK_BITS;
+    if (bm->n_block)
+    {
+	bm->field = CALLOC(bm->n_block,BITMAP_BLOCK_SIZE);
+	bm->tree  = CALLOC(bm->n_block+1,sizeof(*bm->tree));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetBitmap ( Bitmap_t *bm )
+{
+    if (bm)
+    {
+	FREE(bm->field);
+	FREE(bm->tree);
+	memset(bm,0,sizeof(*bm));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ClearAllBitmap ( Bitmap_t *bm )
+{
+    DASSERT(bm);
+    if (bm->n_block)
+    {
+	memset(bm->field,0,bm->n_block*BITMAP_BLOCK_SIZE);
+	memset(bm->tree,0,(bm->n_block+1)*sizeof(*bm->tree));
+    }
+    bm->n_set = 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void AddTreeBitmap ( Bitmap_t *bm, uint bit_num, int add )
+{
+    DASSERT(bm);
+    bm->n_set += add;
+    for ( uint idx = bit_num / BITMAP_BLOCK_BITS + 1;
+		idx <= bm->n_block; idx += idx & -idx )
+	bm->tree[idx] += add;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SetBitmap ( Bitmap_t *bm, uint bit_num )
+{
+    DASSERT(bm);
+    if ( bit_num >= bm->n_bits )
+	return false;
+
+    const bool result = TestSetBit(bm->field,bit_num);
+    if (!result)
+	AddTreeBitmap(bm,bit_num,1);
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ClearBitmap ( Bitmap_t *bm, uint bit_num )
+{
+    DASSERT(bm);
+    if ( bit_num >= bm->n_bits )
+	return false;
+
+    const bool result = TestClearBit(bm->field,bit_num);
+    if (result)
+	AddTreeBitmap(bm,bit_num,-1);
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint RankBitmap ( const Bitmap_t *bm, uint bit_num )
+{
+    DASSERT(bm);
+    if ( bit_num >= bm->n_bits )
+	return bm->n_set;
+
+    uint block = bit_num / BITMAP_BLOCK_BITS, count = 0;
+    for ( uint idx = block; idx > 0; idx -= idx & -idx )
+	count += bm->tree[idx];
+
+    const u8 *ptr = bm->field + block * BITMAP_BLOCK_SIZE;
+    const uint n_bytes = bit_num / 8 % BITMAP_BLOCK_SIZE;
+    count += Count1Bits(ptr,n_bytes);
+
+    const uint n_bits = bit_num & 7;
+    if (n_bits)
+	count += Count1Bits8( ptr[n_bytes] & ( 1 << n_bits ) - 1 );
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static int SelectHelperBitmap ( const Bitmap_t *bm, uint rank, bool zero )
+{
+    // find block by descending the Fenwick tree
+
+    DASSERT(bm);
+    uint block = 0, step = 1;
+    while ( 2*step <= bm->n_block )
+	step *= 2;
+
+    for ( ; step; step /= 2 )
+    {
+	const uint next = block + step;
+	if ( next > bm->n_block )
+	    continue;
+
+	uint count = bm->tree[next];
+	if (zero)
+	{
+	    const uint end_bit = next * BITMAP_BLOCK_BITS;
+	    count = step * BITMAP_BLOCK_BITS - count
+		  - ( end_bit > bm->n_bits ? end_bit - bm->n_bits : 0 );
+	}
+
+	if ( rank >= count )
+	{
+	    block = next;
+	    rank -= count;
+	}
+    }
+
+    // scan the bytes of the block
+
+    const u8 *ptr = bm->field + block * BITMAP_BLOCK_SIZE;
+    const u8 *end = ptr + BITMAP_BLOCK_SIZE;
+    for ( ; ptr < end; ptr++ )
+    {
+	const u8 data = zero ? ~*ptr : *ptr;
+	const uint count = Count1Bits8(data);
+	if ( rank < count )
+	{
+	    uint mask = data;
+	    while ( rank-- > 0 )
+		mask &= mask - 1;
+	    const int bit_num = 8 * ( ptr - bm->field ) + TableLowest1Bit[mask];
+	    return bit_num < bm->n_bits ? bit_num : -1;
+	}
+	rank -= count;
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+
+int SelectBitmap ( const Bitmap_t *bm, uint rank )
+{
+    DASSERT(bm);
+    return rank < bm->n_set ? SelectHelperBitmap(bm,rank,false) : -1;
+}
+
+//-----------------------------------------------------------------------------
+
+int Select0Bitmap ( const Bitmap_t *bm, uint rank )
+{
+    DASSERT(bm);
+    return rank < bm->n_bits - bm->n_set ? SelectHelperBitmap(bm,rank,true) : -1;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+int FindNextSetBitmap ( const Bitmap_t *bm, uint bit_num )
+{
+    DASSERT(bm);
+    if ( bit_num >= bm->n_bits )
+	return -1;
+
+    // check the current block first
+
+    const u8 *ptr = bm->field + bit_num / 8;
+    const u8 data = *ptr & ~( ( 1 << ( bit_num & 7 )) - 1 );
+    if (data)
+	return ( bit_num & ~7 ) + TableLowest1Bit[data];
+
+    const uint end_bit = ( bit_num / BITMAP_BLOCK_BITS + 1 ) * BITMAP_BLOCK_BITS;
+    const int idx = FindLowest1BitLE( ptr+1, end_bit/8 - bit_num/8 - 1 );
+    if ( idx >= 0 )
+	return ( bit_num & ~7 ) + 8 + idx;
+
+    // use the summary
+
+    return SelectBitmap(bm,RankBitmap(bm,end_bit));
+}
+
+//-----------------------------------------------------------------------------
+
+int FindNextClearBitmap ( const Bitmap_t *bm, uint bit_num )
+{
+    DASSERT(bm);
+    if ( bit_num >= bm->n_bits )
+	return -1;
+
+    // check the current block first, padding bits are never set
+
+    const u8 *ptr = bm->field + bit_num / 8;
+    const u8 data = ~*ptr & ~( ( 1 << ( bit_num & 7 )) - 1 );
+    if (data)
+    {
+	const int res = ( bit_num & ~7 ) + TableLowest1Bit[data];
+	return res < bm->n_bits ? res : -1;
+    }
+
+    const uint end_bit = ( bit_num / BITMAP_BLOCK_BITS + 1 ) * BITMAP_BLOCK_BITS;
+    const int idx = FindLowest0BitLE( ptr+1, end_bit/8 - bit_num/8 - 1 );
+    if ( idx >= 0 )
+    {
+	const int res = ( bit_num & ~7 ) + 8 + idx;
+	return res < bm->n_bits ? res : -1;
+    }
+
+    // use the summary
+
+    return Select0Bitmap(bm,Rank0Bitmap(bm,end_bit));
+}
+
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////		low level endian conversions		///////////////
@@ -606,130 +983,186 @@ void write_lef8 ( void * le_data_ptr, double data )
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-// convert lists
-
-void be16n ( u16 * dest, const u16 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+// convert lists: byte swap kernels
 
-    while ( n-- > 0 )
-	*dest++ = be16(src++);
-}
+#if HAVE_X86_SIMD
 
-void be32n ( u32 * dest, const u32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+ // shuffle masks for elements of 2, 4 and 8 bytes, same for both lanes
+ static const u8 swap_mask[3][32] __attribute__((aligned(32))) =
+ {
+    {  1, 0, 3, 2, 5, 4, 7, 6, 9, 8,11,10,13,12,15,14,
+       1, 0, 3, 2, 5, 4, 7, 6, 9, 8,11,10,13,12,15,14 },
+    {  3, 2, 1, 0, 7, 6, 5, 4,11,10, 9, 8,15,14,13,12,
+       3, 2, 1, 0, 7, 6, 5, 4,11,10, 9, 8,15,14,13,12 },
+    {  7, 6, 5, 4, 3, 2, 1, 0,15,14,13,12,11,10, 9, 8,
+       7, 6, 5, 4, 3, 2, 1, 0,15,14,13,12,11,10, 9, 8 },
+ };
+
+ __attribute__((target("ssse3")))
+ static uint SwapBytesSSSE3 ( u8 *dest, const u8 *src, uint n_bytes, const u8 *mask )
+ {
+    // returns the number of processed bytes
 
-    while ( n-- > 0 )
-	*dest++ = be32(src++);
-}
+    const __m128i m = _mm_load_si128((const __m128i*)mask);
+    uint done;
+    for ( done = 0; done + 16 <= n_bytes; done += 16 )
+    {
+	const __m128i v = _mm_loadu_si128((const __m128i*)(src+done));
+	_mm_storeu_si128((__m128i*)(dest+done),_mm_shuffle_epi8(v,m));
+    }
+    return done;
+ }
 
-void bef4n ( float32 * dest, const float32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+ __attribute__((target("avx2")))
+ static uint SwapBytesAVX2 ( u8 *dest, const u8 *src, uint n_bytes, const u8 *mask )
+ {
+    // returns the number of processed bytes
 
-    while ( n-- > 0 )
-	*dest++ = bef4(src++);
-}
+    const __m256i m = _mm256_load_si256((const __m256i*)mask);
+    uint done;
+    for ( done = 0; done + 32 <= n_bytes; done += 32 )
+    {
+	const __m256i v = _mm256_loadu_si256((const __m256i*)(src+done));
+	_mm256_storeu_si256((__m256i*)(dest+done),_mm256_shuffle_epi8(v,m));
+    }
+    if ( done + 16 <= n_bytes )
+    {
+	const __m128i v = _mm_loadu_si128((const __m128i*)(src+done));
+	_mm_storeu_si128((__m128i*)(dest+done),
+			_mm_shuffle_epi8(v,_mm_load_si128((const __m128i*)mask)));
+	done += 16;
+    }
+    return done;
+ }
 
-void write_be16n ( u16 * dest, const u16 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+#endif // HAVE_X86_SIMD
 
-    while ( n-- > 0 )
-	write_be16(dest++,*src++);
-}
+//-----------------------------------------------------------------------------
 
-void write_be32n ( u32 * dest, const u32 * src, int n )
+static void SwapBytesN ( void *dest, const void *src, int n_elem, uint size )
 {
+    // Reverse the byte order of 'n_elem' elements of 'size' (2|4|8) bytes.
+    // Unaligned data and dest==src are allowed.
+
     DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+    DASSERT( n_elem >= 0 );
+    DASSERT( src || !n_elem );
+    DASSERT( size == 2 || size == 4 || size == 8 );
+
+    u8 *d = dest;
+    const u8 *s = src;
+    uint n_bytes = n_elem > 0 ? n_elem * size : 0;
+
+ #if HAVE_X86_SIMD
+    if ( n_bytes >= 16 )
+    {
+	const u8 *mask = swap_mask[size/4];
+	const uint done = __builtin_cpu_supports("avx2")
+			? SwapBytesAVX2(d,s,n_bytes,mask)
+			: __builtin_cpu_supports("ssse3")
+			? SwapBytesSSSE3(d,s,n_bytes,mask)
+			: 0;
+	d += done;
+	s += done;
+	n_bytes -= done;
+    }
+ #endif
 
-    while ( n-- > 0 )
-	write_be32(dest++,*src++);
-}
+    switch (size)
+    {
+      case 2:
+	for ( ; n_bytes >= 2; n_bytes -= 2, d += 2, s += 2 )
+	{
+	    const u16 data = swap16(s);
+	    memcpy(d,&data,2);
+	}
+	break;
 
-void write_bef4n ( float32 * dest, const float32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+      case 4:
+	for ( ; n_bytes >= 4; n_bytes -= 4, d += 4, s += 4 )
+	{
+	    const u32 data = swap32(s);
+	    memcpy(d,&data,4);
+	}
+	break;
 
-    while ( n-- > 0 )
-	write_bef4(dest++,*src++);
+      case 8:
+	for ( ; n_bytes >= 8; n_bytes -= 8, d += 8, s += 8 )
+	{
+	    const u64 data = swap64(s);
+	    memcpy(d,&data,8);
+	}
+	break;
+    }
 }
 
-///////////////////////////////////////////////////////////////////////////////
-// convert lists
+//-----------------------------------------------------------------------------
 
-void le16n ( u16 * dest, const u16 * src, int n )
+static inline void CopyBytesN ( void *dest, const void *src, int n_elem, uint size )
 {
     DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+    DASSERT( n_elem >= 0 );
+    DASSERT( src || !n_elem );
 
-    while ( n-- > 0 )
-	*dest++ = le16(src++);
+    if ( n_elem > 0 && dest != src )
+	memmove(dest,src,n_elem*size);
 }
 
-void le32n ( u32 * dest, const u32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+//-----------------------------------------------------------------------------
 
-    while ( n-- > 0 )
-	*dest++ = le32(src++);
-}
+#if IS_BIG_ENDIAN
+  #define ConvertBE CopyBytesN
+  #define ConvertLE SwapBytesN
+#else
+  #define ConvertBE SwapBytesN
+  #define ConvertLE CopyBytesN
+#endif
 
-void lef4n ( float32 * dest, const float32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+void dswap16n ( void * data, int n ) { SwapBytesN(data,data,n,2); }
+void dswap32n ( void * data, int n ) { SwapBytesN(data,data,n,4); }
+void dswap64n ( void * data, int n ) { SwapBytesN(data,data,n,8); }
 
-    while ( n-- > 0 )
-	*dest++ = lef4(src++);
-}
+///////////////////////////////////////////////////////////////////////////////
+// convert lists
 
-void write_le16n ( u16 * dest, const u16 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+void be16n ( u16 * dest, const u16 * src, int n )
+	{ ConvertBE(dest,src,n,sizeof(*dest)); }
 
-    while ( n-- > 0 )
-	write_le16(dest++,*src++);
-}
+void be32n ( u32 * dest, const u32 * src, int n )
+	{ ConvertBE(dest,src,n,sizeof(*dest)); }
 
-void write_le32n ( u32 * dest, const u32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+void bef4n ( float32 * dest, const float32 * src, int n )
+	{ ConvertBE(dest,src,n,sizeof(*dest)); }
 
-    while ( n-- > 0 )
-	write_le32(dest++,*src++);
-}
+void write_be16n ( u16 * dest, const u16 * src, int n )
+	{ ConvertBE(dest,src,n,sizeof(*dest)); }
 
-void write_lef4n ( float32 * dest, const float32 * src, int n )
-{
-    DASSERT( dest );
-    DASSERT( n >= 0 );
-    DASSERT( src || !n );
+void write_be32n ( u32 * dest, const u32 * src, int n )
+	{ ConvertBE(dest,src,n,sizeof(*dest)); }
 
-    while ( n-- > 0 )
-	write_lef4(dest++,*src++);
-}
+void write_bef4n ( float32 * dest, const float32 * src, int n )
+	{ ConvertBE(dest,src,n,sizeof(*dest)); }
+
+///////////////////////////////////////////////////////////////////////////////
+// convert lists
+
+void le16n ( u16 * dest, const u16 * src, int n )
+	{ ConvertLE(dest,src,n,sizeof(*dest)); }
+
+void le32n ( u32 * dest, const u32 * src, int n )
+	{ ConvertLE(dest,src,n,sizeof(*dest)); }
+
+void lef4n ( float32 * dest, const float32 * src, int n )
+	{ ConvertLE(dest,src,n,sizeof(*dest)); }
+
+void write_le16n ( u16 * dest, const u16 * src, int n )
+	{ ConvertLE(dest,src,n,sizeof(*dest)); }
+
+void write_le32n ( u32 * dest, const u32 * src, int n )
+	{ ConvertLE(dest,src,n,sizeof(*dest)); }
+
+void write_lef4n ( float32 * dest, const float32 * src, int n )
+	{ ConvertLE(dest,src,n,sizeof(*dest)); }
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -1197,6 +1630,182 @@ ccp GetEncodingName ( EncodeMode_t em )
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Escaped strings and JSON: find the next byte that needs special
+// handling and copy the clean run in front of it by one memcpy().
+
+#define ESC_STOP_CTRL	0x01	// stop at bytes < 0x20
+#define ESC_STOP_HIGH	0x02	// stop at bytes >= 0x80
+#define ESC_STOP_DEL	0x04	// stop at 0x7f and 0xff
+#define ESC_STOP_C1	0x08	// stop at bytes 0x80..0x9f
+
+static inline ccp FindEscapeStop
+(
+    // returns a pointer to the first byte of [src,end) that is 'c1', 'c2',
+    // 'c3' or matches 'mode', or 'end' if none is found
+
+    ccp		src,		// begin of data
+    ccp		end,		// end of data
+    char	c1,		// first stop char
+    char	c2,		// second stop char, set it to 'c1' if not needed
+    char	c3,		// third stop char, set it to 'c1' if not needed
+    uint	mode		// bit field: ESC_STOP_*
+)
+{
+ #if HAVE_X86_SIMD
+    const __m128i v1  = _mm_set1_epi8(c1);
+    const __m128i v2  = _mm_set1_epi8(c2);
+    const __m128i v3  = _mm_set1_epi8(c3);
+    const __m128i v1f = _mm_set1_epi8(0x1f);
+    const __m128i v80 = _mm_set1_epi8(0x80);
+    const __m128i vff = _mm_set1_epi8(0xff);
+    while ( src + 16 <= end )
+    {
+	const __m128i v = _mm_loadu_si128((const __m128i*)src);
+	__m128i hit = _mm_or_si128( _mm_cmpeq_epi8(v,v1), _mm_cmpeq_epi8(v,v2) );
+	hit = _mm_or_si128( hit, _mm_cmpeq_epi8(v,v3) );
+	if ( mode & ESC_STOP_CTRL )
+	    hit = _mm_or_si128( hit, _mm_cmpeq_epi8(_mm_min_epu8(v,v1f),v) );
+	if ( mode & ESC_STOP_DEL )
+	    hit = _mm_or_si128( hit, _mm_cmpeq_epi8(_mm_or_si128(v,v80),vff) );
+	if ( mode & ESC_STOP_C1 )
+	{
+	    const __m128i x = _mm_xor_si128(v,v80);
+	    hit = _mm_or_si128( hit, _mm_cmpeq_epi8(_mm_min_epu8(x,v1f),x) );
+	}
+	uint mask = _mm_movemask_epi8(hit);
+	if ( mode & ESC_STOP_HIGH )
+	    mask |= _mm_movemask_epi8(v);
+	if (mask)
+	    return src + __builtin_ctz(mask);
+	src += 16;
+    }
+ #endif
+
+    for ( ; src < end; src++ )
+    {
+	const u8 ch = *src;
+	if (   ch == (u8)c1 || ch == (u8)c2 || ch == (u8)c3
+	    || mode & ESC_STOP_CTRL && ch < ' '
+	    || mode & ESC_STOP_HIGH && ch >= 0x80
+	    || mode & ESC_STOP_DEL  && ( ch & 0x7f ) == 0x7f
+	    || mode & ESC_STOP_C1   && ( ch & 0xe0 ) == 0x80 )
+	{
+	    break;
+	}
+    }
+    return src;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static char * PrintEscapedCore
+(
+    // Escape [*p_str,end) until 'dest_end' is reached. 'dest_end' must
+    // be 4 bytes below the real end. Returns the new 'dest'; '*p_str'
+    // is updated. All bytes that are not copied 1:1 are stop chars of
+    // FindEscapeStop(), so runs of safe bytes are copied by memcpy().
+
+    char	*dest,		// destination
+    char	*dest_end,	// end of destination - 4
+    ccp		*p_str,		// pointer to source pointer
+    ccp		end,		// end of source
+    CharMode_t	char_mode,	// modes, bit field (CHMD_*)
+    char	quote		// NULL or quotation char, that must be quoted
+)
+{
+    ///////////////////////////////////////////////////////
+    /////  Update GetEscapeLen() on modifications!!   /////
+    ///////////////////////////////////////////////////////
+
+    const CharMode_t utf8	= char_mode & CHMD_UTF8;
+    const CharMode_t allow_e	= char_mode & CHMD_ESC;
+    const CharMode_t esc_pipe	= char_mode & CHMD_PIPE;
+
+    const char stop_quote	= quote > 0 ? quote : '\\';
+    const char stop_pipe	= esc_pipe ? '|' : '\\';
+    const uint stop_mode	= ESC_STOP_CTRL | ESC_STOP_DEL | ( utf8 ? 0 : ESC_STOP_C1 );
+
+    ccp str = *p_str;
+    while ( dest < dest_end && str < end )
+    {
+	//--- copy the clean run
+
+	ccp stop = FindEscapeStop(str,end,'\\',stop_quote,stop_pipe,stop_mode);
+	uint len = stop - str;
+	if ( len > dest_end - dest )
+	    len = dest_end - dest;
+	memcpy(dest,str,len);
+	dest += len;
+	str  += len;
+	if ( dest >= dest_end || str == end )
+	    break;
+
+	//--- escape the stop char
+
+	const u8 ch = (u8)*str++;
+	switch (ch)
+	{
+	    case 0:
+		*dest++ = '\\';
+		*dest++ = 'x';
+		*dest++ = '0';
+		*dest++ = '0';
+		break;
+
+	    case '\\': *dest++ = '\\'; *dest++ = '\\'; break;
+	    case '\a': *dest++ = '\\'; *dest++ = 'a'; break;
+	    case '\b': *dest++ = '\\'; *dest++ = 'b'; break;
+	    case '\f': *dest++ = '\\'; *dest++ = 'f'; break;
+	    case '\n': *dest++ = '\\'; *dest++ = 'n'; break;
+	    case '\r': *dest++ = '\\'; *dest++ = 'r'; break;
+	    case '\t': *dest++ = '\\'; *dest++ = 't'; break;
+	    case '\v': *dest++ = '\\'; *dest++ = 'v'; break;
+
+	    case '\033':
+		*dest++ = '\\';
+		if (allow_e)
+		    *dest++ = 'e';
+		else
+		{
+		    *dest++ = 'x';
+		    *dest++ = '1';
+		    *dest++ = 'B';
+		}
+		break;
+
+	    case '|':
+		if (esc_pipe)
+		{
+		    *dest++ = '\\';
+		    *dest++ = '!';
+		}
+		else
+		    *dest++ = '|'; // only a stop char if it is the quote
+		break;
+
+	    default:
+		if ( ch == quote )
+		{
+		    *dest++ = '\\';
+		    *dest++ = quote;
+		}
+		else
+		{
+		    // control chars and DEL
+		    *dest++ = '\\';
+		    *dest++ = 'x';
+		    *dest++ = HiDigits[ch>>4];
+		    *dest++ = HiDigits[ch&15];
+		}
+	}
+    }
+
+    *p_str = str;
+    return dest;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 uint GetEscapeLen
 (
     // returns the extra size needed for escapes.
@@ -1218,15 +1827,24 @@ uint GetEscapeLen
     ccp str = source;
     ccp end = src_len < 0 ? 0 : str + src_len;
 
+    if (!end)
+	end = str + strlen(str);
+
+    const char stop_quote	= quote > 0 ? quote : '\\';
+    const char stop_pipe	= pipe_size ? '|' : '\\';
+    const uint stop_mode	= ESC_STOP_CTRL | ESC_STOP_DEL | ( utf8 ? 0 : ESC_STOP_C1 );
+
     uint size = 0;
-    while ( !end || str < end )
+    while ( str < end )
     {
+	str = FindEscapeStop(str,end,'\\',stop_quote,stop_pipe,stop_mode);
+	if ( str == end )
+	    break;
+
 	const u8 ch = (u8)*str++;
 	switch (ch)
 	{
 	    case 0:
-		if (!end)
-		    return size;
 		size += 3;
 		break;
 
@@ -1274,95 +1892,56 @@ char * PrintEscapedString
     uint	*dest_len	// not NULL: Store length of result here
 )
 {
-    ///////////////////////////////////////////////////////
-    /////  Update GetEscapeLen() on modifications!!   /////
-    ///////////////////////////////////////////////////////
-
     DASSERT(buf);
     DASSERT(buf_size>=10);
 
-    const CharMode_t utf8	= char_mode & CHMD_UTF8;
-    const CharMode_t allow_e	= char_mode & CHMD_ESC;
-    const CharMode_t esc_pipe	= char_mode & CHMD_PIPE;
-
-    char *dest = buf;
-    char *dest_end = dest + buf_size - 4;
-
     if (!source)
 	source = "";
     ccp str = source;
-    ccp end = len < 0 ? 0 : str + len;
+    ccp end = str + ( len < 0 ? strlen(str) : len );
 
-    while ( dest < dest_end && ( !end || str < end ) )
-    {
-	const u8 ch = (u8)*str++;
-	switch (ch)
-	{
-	    case 0:
-		if (!end)
-		{
-		    str--;
-		    goto eos;
-		}
-		*dest++ = '\\';
-		*dest++ = 'x';
-		*dest++ = '0';
-		*dest++ = '0';
-		break;
+    char *dest = PrintEscapedCore(buf,buf+buf_size-4,&str,end,char_mode,quote);
+    *dest = 0;
+    if (dest_len)
+	*dest_len = dest - buf;
+    return buf;
+}
 
-	    case '\\': *dest++ = '\\'; *dest++ = '\\'; break;
-	    case '\a': *dest++ = '\\'; *dest++ = 'a'; break;
-	    case '\b': *dest++ = '\\'; *dest++ = 'b'; break;
-	    case '\f': *dest++ = '\\'; *dest++ = 'f'; break;
-	    case '\n': *dest++ = '\\'; *dest++ = 'n'; break;
-	    case '\r': *dest++ = '\\'; *dest++ = 'r'; break;
-	    case '\t': *dest++ = '\\'; *dest++ = 't'; break;
-	    case '\v': *dest++ = '\\'; *dest++ = 'v'; break;
+///////////////////////////////////////////////////////////////////////////////
 
-	    case '\033':
-		*dest++ = '\\';
-		if (allow_e)
-		    *dest++ = 'e';
-		else
-		{
-		    *dest++ = 'x';
-		    *dest++ = '1';
-		    *dest++ = 'B';
-		}
-		break;
+uint PrintEscapedFastBuf
+(
+    // Append the escaped string to 'fb' without size limit.
+    // Returns the number of appended bytes.
 
-	    case '|':
-		if (esc_pipe)
-		{
-		    *dest++ = '\\';
-		    *dest++ = '!';
-		}
-		else
-		    *dest++ = '|';
-		break;
+    FastBuf_t	*fb,		// valid destination buffer
+    ccp		source,		// NULL or string to print
+    int		len,		// length of string. if -1, str is null terminated
+    CharMode_t	char_mode,	// modes, bit field (CHMD_*)
+    char	quote		// NULL or quotation char, that must be quoted
+)
+{
+    DASSERT(fb);
+    const uint start = GetFastBufLen(fb);
 
-	    default:
-		if ( ch == quote )
-		{
-		    *dest++ = '\\';
-		    *dest++ = quote;
-		}
-		else if ( ch < ' ' || !utf8 && (ch&0x7f) < ' ' || (ch&0x7f) == 0x7f )
-		{
-		    *dest++ = '\\';
-		    *dest++ = 'x';
-		    *dest++ = HiDigits[ch>>4];
-		    *dest++ = HiDigits[ch&15];
-		}
-		else
-		    *dest++ = ch;
-	}
+    if (!source)
+	source = "";
+    ccp str = source;
+    ccp end = str + ( len < 0 ? strlen(str) : len );
+
+    while ( str < end )
+    {
+	// an escape needs at most 4 bytes
+	uint space = end - str;
+	if ( space > 0x1000 )
+	    space = 0x1000;
+	space = 4 * space + 4;
+
+	char *dest = GetSpaceFastBuf(fb,space);
+	fb->ptr = PrintEscapedCore(dest,dest+space-4,&str,end,char_mode,quote);
     }
- eos:
-    *dest = 0;
-    if (dest_len)
-	*dest_len = dest - buf;
-    return buf;
+
+    return GetFastBufLen(fb) - start;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1399,8 +1978,24 @@ uint ScanEscapedString
     else if ( have_quote && *src == quote )
 	src++;
 
+    // plain ASCII (or any byte if !utf8) is copied unchanged
+    const char stop2 = have_quote && quote < 0x80 ? quote : '\\';
+    const uint stop_mode = utf8 ? ESC_STOP_HIGH : 0;
+
     while ( dest < dest_end && src < src_end )
     {
+	ccp stop = FindEscapeStop(src,src_end,'\\',stop2,stop2,stop_mode);
+	if ( stop > src )
+	{
+	    uint len = stop - src;
+	    if ( len > dest_end - dest )
+		len = dest_end - dest;
+	    memcpy(dest,src,len);
+	    dest += len;
+	    src  += len;
+	    continue;
+	}
+
 	uint code;
 	if ( *src == '\\' )
 	    src = ScanEscape(&code,src+1,src_end);
@@ -1429,6 +2024,98 @@ uint ScanEscapedString
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// CRC32: slicing-by-8 and carry-less multiplication (PCLMULQDQ)
+
+static u32 CalcCRC32Slice8 ( u32 crc, const u8 *p, uint size )
+{
+    // 'crc' is the raw CRC register (not inverted)
+
+    for ( ; size >= 8; size -= 8, p += 8 )
+    {
+	const u32 one = le32(p) ^ crc;
+	const u32 two = le32(p+4);
+	crc = TableCRC32Slice8[7][  one	       & 0xff ]
+	    ^ TableCRC32Slice8[6][ (one >>  8) & 0xff ]
+	    ^ TableCRC32Slice8[5][ (one >> 16) & 0xff ]
+	    ^ TableCRC32Slice8[4][  one >> 24	      ]
+	    ^ TableCRC32Slice8[3][  two	       & 0xff ]
+	    ^ TableCRC32Slice8[2][ (two >>  8) & 0xff ]
+	    ^ TableCRC32Slice8[1][ (two >> 16) & 0xff ]
+	    ^ TableCRC32Slice8[0][  two >> 24	      ];
+    }
+
+    while ( size-- )
+	crc = TableCRC32[ (crc ^ *p++) & 0xff ] ^ crc >> 8;
+    return crc;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+#if HAVE_X86_SIMD
+
+ // Fold a 128-bit block over a distance of N bits: the low 64 bits are
+ // multiplied by x^(N+63) mod P, the high 64 bits by x^(N-1) mod P.
+ // Both constants are bit reflected into the upper half of a u64.
+
+ #define CRC32_FOLD_512 _mm_set_epi64x(0xcad38e8f00000000ull,0x653d982200000000ull)
+ #define CRC32_FOLD_384 _mm_set_epi64x(0x2a28386200000000ull,0x69ccfc0d00000000ull)
+ #define CRC32_FOLD_256 _mm_set_epi64x(0x01b5fd1d00000000ull,0x9570d49500000000ull)
+ #define CRC32_FOLD_128 _mm_set_epi64x(0x9ba54c6f00000000ull,0x65673b4600000000ull)
+
+ __attribute__((target("pclmul,sse2")))
+ static inline __m128i FoldCRC32 ( __m128i x, __m128i k )
+ {
+    return _mm_xor_si128( _mm_clmulepi64_si128(x,k,0x00),
+			  _mm_clmulepi64_si128(x,k,0x11) );
+ }
+
+ __attribute__((target("pclmul,sse2")))
+ static u32 CalcCRC32Clmul ( u32 crc, const u8 *p, uint size )
+ {
+    // 'crc' is the raw CRC register (not inverted), size >= 64
+
+    DASSERT( size >= 64 );
+
+    __m128i x0 = _mm_loadu_si128((const __m128i*)(p+ 0));
+    __m128i x1 = _mm_loadu_si128((const __m128i*)(p+16));
+    __m128i x2 = _mm_loadu_si128((const __m128i*)(p+32));
+    __m128i x3 = _mm_loadu_si128((const __m128i*)(p+48));
+    x0 = _mm_xor_si128(x0,_mm_cvtsi32_si128(crc));
+    p += 64;
+    size -= 64;
+
+    //--- fold 4 lanes in parallel
+
+    const __m128i k4 = CRC32_FOLD_512;
+    for ( ; size >= 64; size -= 64, p += 64 )
+    {
+	x0 = _mm_xor_si128( FoldCRC32(x0,k4), _mm_loadu_si128((const __m128i*)(p+ 0)) );
+	x1 = _mm_xor_si128( FoldCRC32(x1,k4), _mm_loadu_si128((const __m128i*)(p+16)) );
+	x2 = _mm_xor_si128( FoldCRC32(x2,k4), _mm_loadu_si128((const __m128i*)(p+32)) );
+	x3 = _mm_xor_si128( FoldCRC32(x3,k4), _mm_loadu_si128((const __m128i*)(p+48)) );
+    }
+
+    //--- reduce to 1 lane
+
+    const __m128i k1 = CRC32_FOLD_128;
+    x3 = _mm_xor_si128( x3, FoldCRC32(x2,k1) );
+    x3 = _mm_xor_si128( x3, FoldCRC32(x1,CRC32_FOLD_256) );
+    x3 = _mm_xor_si128( x3, FoldCRC32(x0,CRC32_FOLD_384) );
+
+    for ( ; size >= 16; size -= 16, p += 16 )
+	x3 = _mm_xor_si128( FoldCRC32(x3,k1), _mm_loadu_si128((const __m128i*)p) );
+
+    //--- finish by tables
+
+    u8 buf[16];
+    _mm_storeu_si128((__m128i*)buf,x3);
+    crc = CalcCRC32Slice8(0,buf,sizeof(buf));
+    return CalcCRC32Slice8(crc,p,size);
+ }
+
+#endif // HAVE_X86_SIMD
+
 ///////////////////////////////////////////////////////////////////////////////
 
 u32 CalcCRC32 ( u32 crc, cvp buf, uint size )
@@ -1454,12 +2141,48 @@ u32 CalcCRC32 ( u32 crc, cvp buf, uint size )
     }
  #endif
 
-    crc = ~crc;
-    const u8 *p = buf;
-    while ( size-- )
-	crc = TableCRC32[ (crc ^ *p++) & 0xff ] ^ crc >> 8;
-
-    return ~crc;
+ #if HAVE_X86_SIMD
+    if ( size >= 256 && __builtin_cpu_supports("pclmul") )
+	return ~CalcCRC32Clmul(~crc,buf,size);
+ #endif
+    return ~CalcCRC32Slice8(~crc,buf,size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static u32 MultModCRC32 ( u32 a, u32 b )
+{
+    // multiply a(x) by b(x) modulo the CRC32 polynomial, both bit reflected
+
+    u32 mask = 1u << 31, prod = 0;
+    for (;;)
+    {
+	if ( a & mask )
+	{
+	    prod ^= b;
+	    if ( !( a & mask - 1 ) )
+		break;
+	}
+	mask >>= 1;
+	b = b & 1 ? b >> 1 ^ 0xedb88320 : b >> 1;
+    }
+    return prod;
+}
+
+//-----------------------------------------------------------------------------
+
+u32 CombineCRC32 ( u32 crc1, u32 crc2, u64 len2 )
+{
+    // x^(8*len2) mod P by square and multiply, 'power' is x^(2^k) mod P
+
+    u32 power = 1u << 30, factor = 1u << 31;
+    for ( len2 *= 8; len2; len2 >>= 1 )
+    {
+	if ( len2 & 1 )
+	    factor = MultModCRC32(power,factor);
+	power = MultModCRC32(power,power);
+    }
+    return MultModCRC32(factor,crc1) ^ crc2;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1567,6 +2290,24 @@ uint DecodeBase64
 
     while ( dest < dest_end && src < end )
     {
+	// fast path: 4 valid chars
+	while ( src + 4 <= end && dest + 3 <= dest_end )
+	{
+	    const int c0 = decode64[(u8)src[0]];
+	    const int c1 = decode64[(u8)src[1]];
+	    const int c2 = decode64[(u8)src[2]];
+	    const int c3 = decode64[(u8)src[3]];
+	    if ( ( c0 | c1 | c2 | c3 ) < 0 )
+		break;
+	    const u32 val = c0 << 18 | c1 << 12 | c2 << 6 | c3;
+	    *dest++ = val >> 16;
+	    *dest++ = val >> 8;
+	    *dest++ = val;
+	    src += 4;
+	}
+	if ( dest == dest_end || src == end )
+	    break;
+
 	ch1 = decode64[(u8)*src++];
 	if (allow_white_spaces)
 	    while ( ch1 == DECODE_SPACE && src < end )
@@ -1657,6 +2398,86 @@ mem_t DecodeBase64Circ
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+#if HAVE_X86_SIMD
+
+ __attribute__((target("ssse3")))
+ static uint EncodeBase64SSSE3
+ (
+    // encode blocks of 4 tupels, returns the number of encoded tupels
+
+    char	*dest,		// destination, 4 bytes per tupel
+    const u8	*src,		// source, 3 bytes per tupel
+    uint	n_tupel,	// number of available tupels
+    char	ch62,		// encoding of 62
+    char	ch63		// encoding of 63
+ )
+ {
+    // each step loads 16 bytes but uses only 12
+    //  => keep at least 2 tupels for the scalar code
+
+    const __m128i shuf = _mm_set_epi8(10,11,9,10,7,8,6,7,4,5,3,4,1,2,0,1);
+    const __m128i lut  = _mm_setr_epi8( 'a'-26, '0'-52, '0'-52, '0'-52,
+					'0'-52, '0'-52, '0'-52, '0'-52,
+					'0'-52, '0'-52, '0'-52, ch62-62,
+					ch63-63, 'A', 0, 0 );
+    uint done;
+    for ( done = 0; done + 6 <= n_tupel; done += 4, src += 12, dest += 16 )
+    {
+	__m128i in = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)src),shuf);
+	const __m128i t0 = _mm_and_si128(in,_mm_set1_epi32(0x0fc0fc00));
+	const __m128i t1 = _mm_mulhi_epu16(t0,_mm_set1_epi32(0x04000040));
+	const __m128i t2 = _mm_and_si128(in,_mm_set1_epi32(0x003f03f0));
+	const __m128i t3 = _mm_mullo_epi16(t2,_mm_set1_epi32(0x01000010));
+	const __m128i idx = _mm_or_si128(t1,t3);
+
+	__m128i red = _mm_subs_epu8(idx,_mm_set1_epi8(51));
+	const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26),idx);
+	red = _mm_or_si128(red,_mm_and_si128(less,_mm_set1_epi8(13)));
+	const __m128i res = _mm_add_epi8(_mm_shuffle_epi8(lut,red),idx);
+	_mm_storeu_si128((__m128i*)dest,res);
+    }
+    return done;
+ }
+
+#endif // HAVE_X86_SIMD
+
+//-----------------------------------------------------------------------------
+
+static char * EncodeBase64Tupels
+(
+    // encode complete tupels without line breaks, returns end of 'dest'
+
+    char	*dest,		// destination, 4 bytes per tupel
+    const u8	*src,		// source, 3 bytes per tupel
+    uint	n_tupel,	// number of tupels
+    const char	encode64[64+1]	// valid encoding table
+)
+{
+ #if HAVE_X86_SIMD
+    if ( n_tupel >= 6
+	&& !memcmp(encode64,TableEncode64,62)
+	&& __builtin_cpu_supports("ssse3") )
+    {
+	const uint done = EncodeBase64SSSE3(dest,src,n_tupel,encode64[62],encode64[63]);
+	dest	+= 4 * done;
+	src	+= 3 * done;
+	n_tupel	-= done;
+    }
+ #endif
+
+    for ( ; n_tupel > 0; n_tupel--, src += 3 )
+    {
+	const u32 val = be24(src);
+	*dest++ = encode64[ val >> 18	     ];
+	*dest++ = encode64[ val >> 12 & 0x3f ];
+	*dest++ = encode64[ val >>  6 & 0x3f ];
+	*dest++ = encode64[ val	      & 0x3f ];
+    }
+    return dest;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 uint EncodeBase64
 (
     // returns the number of scanned bytes of 'source'
@@ -1710,6 +2531,22 @@ uint EncodeBase64
 	    n_tupel = 1;
 	}
 
+	//----- fast run of complete tupels until next line break
+
+	uint n_run = ( src_end - src ) / 3;
+	const uint max_dest = ( dest_end - dest + 3 ) / 4;
+	if ( n_run > max_dest )
+	    n_run = max_dest;
+	if ( n_run > bytes_per_line - n_tupel + 1 )
+	    n_run = bytes_per_line - n_tupel + 1;
+	if ( n_run > 0 )
+	{
+	    dest = EncodeBase64Tupels(dest,src,n_run,encode64);
+	    src += 3 * n_run;
+	    n_tupel += n_run - 1;
+	    continue;
+	}
+
 	//----- start: no pending bits
 
 	u8 ch1 = *src++;
@@ -1827,6 +2664,267 @@ uint EncodeBase64ml // ml: multi line
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// Base64Stream_t
+
+void InitializeEncodeBase64Stream
+(
+    Base64Stream_t	*bs,		// valid stream to initialize
+    const char		encode64[64+1],	// encoding table; if NULL: use TableEncode64default
+    bool		use_filler	// use filler for aligned output
+)
+{
+    DASSERT(bs);
+    memset(bs,0,sizeof(*bs));
+    bs->table	   = encode64 ? encode64 : TableEncode64default;
+    bs->use_filler = use_filler;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void InitializeDecodeBase64Stream
+(
+    Base64Stream_t	*bs,		// valid stream to initialize
+    const char		decode64[256],	// decoding table; if NULL: use TableDecode64default
+    bool		allow_white_spaces // true: skip white spaces
+)
+{
+    DASSERT(bs);
+    memset(bs,0,sizeof(*bs));
+    bs->table		   = decode64 ? decode64 : TableDecode64default;
+    bs->decode		   = true;
+    bs->allow_white_spaces = allow_white_spaces;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static uint PutEncodeBase64Stream
+	( Base64Stream_t *bs, FastBuf_t *fb, const u8 *src, uint size )
+{
+    DASSERT(bs);
+    DASSERT(fb);
+    DASSERT(src||!size);
+
+    bs->total_in += size;
+    char *start = GetSpaceFastBuf(fb,( bs->n_pending + size ) / 3 * 4 );
+    char *dest = start;
+
+    //--- complete pending tupel
+
+    if (bs->n_pending)
+    {
+	while ( bs->n_pending < 3 && size > 0 )
+	{
+	    bs->pending[bs->n_pending++] = *src++;
+	    size--;
+	}
+	if ( bs->n_pending < 3 )
+	    return 0;
+
+	dest = EncodeBase64Tupels(dest,bs->pending,1,bs->table);
+	bs->n_pending = 0;
+    }
+
+    //--- encode complete tupels and save the rest
+
+    const uint n_tupel = size / 3;
+    dest = EncodeBase64Tupels(dest,src,n_tupel,bs->table);
+    src  += 3 * n_tupel;
+    size -= 3 * n_tupel;
+
+    memcpy(bs->pending,src,size);
+    bs->n_pending = size;
+
+    DASSERT( dest == fb->ptr );
+    bs->total_out += dest - start;
+    return dest - start;
+}
+
+//-----------------------------------------------------------------------------
+
+static uint PutDecodeBase64Stream
+	( Base64Stream_t *bs, FastBuf_t *fb, const u8 *src, uint size )
+{
+    DASSERT(bs);
+    DASSERT(fb);
+    DASSERT(src||!size);
+
+    if (bs->stopped)
+	return 0;
+
+    char *start = GetSpaceFastBuf(fb,( bs->n_pending + size ) / 4 * 3 );
+    u8 *dest = (u8*)start;
+    const u8 *src_beg = src, *src_end = src + size;
+    const char *decode64 = bs->table;
+    u32 acc = bs->acc;
+    uint n_pending = bs->n_pending;
+
+    while ( src < src_end )
+    {
+	if (!n_pending)
+	{
+	    // fast path: 4 valid chars
+	    while ( src + 4 <= src_end )
+	    {
+		const int c0 = decode64[src[0]];
+		const int c1 = decode64[src[1]];
+		const int c2 = decode64[src[2]];
+		const int c3 = decode64[src[3]];
+		if ( ( c0 | c1 | c2 | c3 ) < 0 )
+		    break;
+		const u32 val = c0 << 18 | c1 << 12 | c2 << 6 | c3;
+		*dest++ = val >> 16;
+		*dest++ = val >> 8;
+		*dest++ = val;
+		src += 4;
+	    }
+	    if ( src == src_end )
+		break;
+	}
+
+	const int ch = decode64[*src];
+	if ( ch < 0 )
+	{
+	    if ( ch == DECODE_SPACE && bs->allow_white_spaces )
+	    {
+		src++;
+		continue;
+	    }
+	    bs->stopped = true;
+	    break;
+	}
+
+	src++;
+	acc = acc << 6 | ch;
+	if ( ++n_pending == 4 )
+	{
+	    *dest++ = acc >> 16;
+	    *dest++ = acc >> 8;
+	    *dest++ = acc;
+	    n_pending = 0;
+	}
+    }
+
+    bs->acc = acc;
+    bs->n_pending = n_pending;
+    bs->total_in += src - src_beg;
+
+    fb->ptr = (char*)dest;
+    bs->total_out += dest - (u8*)start;
+    return dest - (u8*)start;
+}
+
+//-----------------------------------------------------------------------------
+
+uint PutBase64Stream
+(
+    // returns the number of bytes appended to 'fb'
+
+    Base64Stream_t	*bs,		// valid stream
+    FastBuf_t		*fb,		// valid destination buffer
+    cvp			data,		// NULL or data to encode|decode
+    int			size		// size of 'data'; if <0: use strlen(data)
+)
+{
+    DASSERT(bs);
+    DASSERT(fb);
+
+    if (!data)
+	return 0;
+    if ( size < 0 )
+	size = strlen(data);
+
+    return bs->decode
+	? PutDecodeBase64Stream(bs,fb,data,size)
+	: PutEncodeBase64Stream(bs,fb,data,size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint CloseBase64Stream
+(
+    // flush pending data, returns the number of bytes appended to 'fb'
+
+    Base64Stream_t	*bs,		// valid stream
+    FastBuf_t		*fb		// valid destination buffer
+)
+{
+    DASSERT(bs);
+    DASSERT(fb);
+
+    char buf[4], *dest = buf;
+    if (bs->decode)
+    {
+	// same as DecodeBase64(): 2 chars => 1 byte, 3 chars => 2 bytes
+	if ( bs->n_pending == 2 )
+	    *dest++ = bs->acc >> 4;
+	else if ( bs->n_pending == 3 )
+	{
+	    *dest++ = bs->acc >> 10;
+	    *dest++ = bs->acc >> 2;
+	}
+	bs->stopped = true;
+    }
+    else if (bs->n_pending)
+    {
+	const u8 *src = bs->pending;
+	ccp encode64 = bs->table;
+	*dest++ = encode64[ src[0] >> 2 ];
+	if ( bs->n_pending == 1 )
+	{
+	    *dest++ = encode64[ ( src[0] & 0x03 ) << 4 ];
+	    if (bs->use_filler)
+	    {
+		*dest++ = encode64[64];
+		*dest++ = encode64[64];
+	    }
+	}
+	else
+	{
+	    *dest++ = encode64[ ( src[0] & 0x03 ) << 4 | src[1] >> 4 ];
+	    *dest++ = encode64[ ( src[1] & 0x0f ) << 2 ];
+	    if (bs->use_filler)
+		*dest++ = encode64[64];
+	}
+    }
+
+    bs->n_pending = 0;
+    bs->acc = 0;
+    const uint len = dest - buf;
+    AppendFastBuf(fb,buf,len);
+    bs->total_out += len;
+    return len;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static inline char * EncodeJSONChar ( char *dest, u8 ch )
+{
+    // 'ch' is a quote, a backslash or a control char; 'dest' has space for 6 bytes
+
+    *dest++ = '\\';
+    switch (ch)
+    {
+	case '"':  *dest++ = '"'; break;
+	case '\\': *dest++ = '\\'; break;
+	case '\b': *dest++ = 'b'; break;
+	case '\f': *dest++ = 'f'; break;
+	case '\n': *dest++ = 'n'; break;
+	case '\r': *dest++ = 'r'; break;
+	case '\t': *dest++ = 't'; break;
+
+	default:
+	    *dest++ = 'u';
+	    *dest++ = '0';
+	    *dest++ = '0';
+	    *dest++ = HiDigits[ch>>4];
+	    *dest++ = HiDigits[ch&15];
+	    break;
+    }
+    return dest;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 uint EncodeJSON
@@ -1852,36 +2950,29 @@ uint EncodeJSON
 
     while ( dest < dest_end && str < end )
     {
+	//--- copy the clean run
+
+	ccp stop = FindEscapeStop(str,end,'"','\\','\\',ESC_STOP_CTRL);
+	uint len = stop - str;
+	if ( len > dest_end - dest )
+	    len = dest_end - dest;
+	memcpy(dest,str,len);
+	dest += len;
+	str  += len;
+	if ( dest >= dest_end || str == end )
+	    break;
+
+	//--- escape the stop char, \uXXXX for all controls except \b\t\n\f\r
+
 	const u8 ch = (u8)*str++;
-	switch (ch)
+	if (   ch < ' ' && ( ch < '\b' || ch > '\r' || ch == '\v' )
+	    && dest + 5 > dest_end )
 	{
-	    case '"':  *dest++ = '\\'; *dest++ = '"'; break;
-	    case '\\': *dest++ = '\\'; *dest++ = '\\'; break;
-	    case '\b': *dest++ = '\\'; *dest++ = 'b'; break;
-	    case '\f': *dest++ = '\\'; *dest++ = 'f'; break;
-	    case '\n': *dest++ = '\\'; *dest++ = 'n'; break;
-	    case '\r': *dest++ = '\\'; *dest++ = 'r'; break;
-	    case '\t': *dest++ = '\\'; *dest++ = 't'; break;
-
-	    default:
-		if ( ch >= ' ' )
-		    *dest++ = ch;
-		else if ( dest + 5 > dest_end )
-		    goto eos;
-		else
-		{
-		    *dest++ = '\\';
-		    *dest++ = 'u';
-		    *dest++ = '0';
-		    *dest++ = '0';
-		    *dest++ = HiDigits[ch>>4];
-		    *dest++ = HiDigits[ch&15];
-		}
-		break;
+	    break;
 	}
+	dest = EncodeJSONChar(dest,ch);
     }
 
- eos:
     *dest = 0;
     return dest - buf;
 }
@@ -1913,75 +3004,528 @@ mem_t EncodeJSONCirc
 
 //-----------------------------------------------------------------------------
 
-mem_t QuoteJSONCirc
+mem_t QuoteJSONCirc
+(
+    // Returns a buffer alloced by GetCircBuf()
+    // with valid pointer and null terminated.
+    // If result is too large (>CIRC_BUF_MAX_ALLOC) then (0,0) is returned.
+
+    const void	*source,		// NULL or data to encode
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		null_if			// return 'null' without quotes ...
+					//	<=0: never
+					//	>=1: if source == NULL
+					//	>=2: if source_len == 0
+)
+{
+    if ( source_len < 0 )
+	source_len = source ? strlen(source) : 0;
+
+    mem_t mem;
+    if ( null_if > 0 && !source || null_if > 1 && !source_len )
+    {
+	mem.ptr = "null";
+	mem.len = 4;
+    }
+    else
+    {
+	char buf[CIRC_BUF_MAX_ALLOC+10];
+	mem.len = EncodeJSON(buf+1,sizeof(buf)-2,source,source_len) + 2;
+	if ( mem.len < CIRC_BUF_MAX_ALLOC - 2 )
+	{
+	    buf[0] = buf[mem.len-1] = '"';
+	    buf[mem.len] = 0;
+	    mem.ptr = CopyCircBuf(buf,mem.len+1);
+	}
+	else
+	{
+	    mem.ptr = 0;
+	    mem.len = 0;
+	}
+    }
+    return mem;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint EncodeJSONFastBuf
+(
+    // Append the JSON encoded 'source' to 'fb' without size limit.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    const void	*source,		// NULL or data to encode
+    int		source_len		// length of 'source'; if <0: use strlen(source)
+)
+{
+    DASSERT(fb);
+    const uint start = GetFastBufLen(fb);
+
+    if (!source)
+	source = "";
+    ccp str = source;
+    ccp end = str + ( source_len < 0 ? strlen(str) : source_len );
+
+    while ( str < end )
+    {
+	ccp stop = FindEscapeStop(str,end,'"','\\','\\',ESC_STOP_CTRL);
+	if ( stop > str )
+	{
+	    AppendFastBuf(fb,str,stop-str);
+	    str = stop;
+	    if ( str == end )
+		break;
+	}
+
+	char *dest = GetSpaceFastBuf(fb,6);
+	fb->ptr = EncodeJSONChar(dest,*str++);
+    }
+
+    return GetFastBufLen(fb) - start;
+}
+
+//-----------------------------------------------------------------------------
+
+uint QuoteJSONFastBuf
+(
+    // Append the JSON encoded and quoted 'source' to 'fb' without size limit.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    const void	*source,		// NULL or data to encode
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		null_if			// append 'null' without quotes ...
+					//	<=0: never
+					//	>=1: if source == NULL
+					//	>=2: if source_len == 0
+)
+{
+    DASSERT(fb);
+
+    if ( source_len < 0 )
+	source_len = source ? strlen(source) : 0;
+
+    if ( null_if > 0 && !source || null_if > 1 && !source_len )
+    {
+	AppendFastBuf(fb,"null",4);
+	return 4;
+    }
+
+    AppendCharFastBuf(fb,'"');
+    const uint len = EncodeJSONFastBuf(fb,source,source_len);
+    AppendCharFastBuf(fb,'"');
+    return len + 2;
+}
+
+//-----------------------------------------------------------------------------
+
+mem_t DecodeJSONCirc
+(
+    // Returns a buffer alloced by GetCircBuf()
+    // with valid pointer and null terminated.
+    // If result is too large (>CIRC_BUF_MAX_ALLOC) then (0,0) is returned.
+
+    ccp		source,		// NULL or string to decode
+    int		source_len,	// length of 'source'. If -1, str is NULL terminated
+    int		quote		// -1:auto, 0:none, >0: quotation char
+)
+{
+    char buf[CIRC_BUF_MAX_ALLOC+10];
+    mem_t mem;
+    mem.len = DecodeJSON(buf,sizeof(buf),source,source_len,quote,0);
+    if ( mem.len < CIRC_BUF_MAX_ALLOC )
+	mem.ptr = CopyCircBuf(buf,mem.len+1);
+    else
+    {
+	mem.ptr = 0;
+	mem.len = 0;
+    }
+    return mem;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// [[hex]]
+// Hex core, shared by EncodeHex(), DecodeHex() and XDump. The SSE2 kernels
+// handle 16 bytes per step; for encoding they are used only for the
+// standard digit sets LoDigits[] and HiDigits[].
+
+#if HAVE_X86_SIMD
+
+ static char * EncodeHexSSE2 ( char *dest, const u8 *src, uint n_blocks, bool upper )
+ {
+    const __m128i mask	= _mm_set1_epi8(0x0f);
+    const __m128i zero	= _mm_set1_epi8('0');
+    const __m128i nine	= _mm_set1_epi8(9);
+    const __m128i alpha	= _mm_set1_epi8( upper ? 'A'-'0'-10 : 'a'-'0'-10 );
+
+    while ( n_blocks-- > 0 )
+    {
+	const __m128i v  = _mm_loadu_si128((const __m128i*)src);
+	const __m128i hi = _mm_and_si128(_mm_srli_epi16(v,4),mask);
+	const __m128i lo = _mm_and_si128(v,mask);
+
+	__m128i x0 = _mm_unpacklo_epi8(hi,lo);
+	__m128i x1 = _mm_unpackhi_epi8(hi,lo);
+	x0 = _mm_add_epi8( _mm_add_epi8(x0,zero),
+			   _mm_and_si128(_mm_cmpgt_epi8(x0,nine),alpha) );
+	x1 = _mm_add_epi8( _mm_add_epi8(x1,zero),
+			   _mm_and_si128(_mm_cmpgt_epi8(x1,nine),alpha) );
+	_mm_storeu_si128((__m128i*)dest,x0);
+	_mm_storeu_si128((__m128i*)(dest+16),x1);
+	src  += 16;
+	dest += 32;
+    }
+    return dest;
+ }
+
+ //----------------------------------------------------------------------------
+
+ static char * DecodeHexSSE2 ( char *dest, ccp *p_src, uint n_blocks )
+ {
+    // decode blocks of 32 hex digits into 16 bytes,
+    // stop before the first block with an invalid char
+
+    const __m128i n_0	= _mm_set1_epi8('0');
+    const __m128i n_a	= _mm_set1_epi8('a');
+    const __m128i lcase	= _mm_set1_epi8(0x20);
+    const __m128i nine	= _mm_set1_epi8(9);
+    const __m128i five	= _mm_set1_epi8(5);
+    const __m128i ten	= _mm_set1_epi8(10);
+    const __m128i low	= _mm_set1_epi16(0xff);
+
+    ccp src = *p_src;
+    for ( ; n_blocks > 0; n_blocks--, src += 32, dest += 16 )
+    {
+	__m128i val[2];
+	uint i, valid = 0xffffffff;
+	for ( i = 0; i < 2; i++ )
+	{
+	    const __m128i v = _mm_loadu_si128((const __m128i*)(src+16*i));
+	    const __m128i d = _mm_sub_epi8(v,n_0);
+	    const __m128i l = _mm_sub_epi8(_mm_or_si128(v,lcase),n_a);
+	    const __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(d,nine),d);
+	    const __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(l,five),l);
+	    valid &= ( _mm_movemask_epi8(_mm_or_si128(is_d,is_l)) | 0xffff0000 );
+
+	    const __m128i x = _mm_or_si128( _mm_and_si128(is_d,d),
+				_mm_and_si128(is_l,_mm_add_epi8(l,ten)) );
+	    val[i] = _mm_and_si128( _mm_or_si128( _mm_slli_epi16(x,4),
+						  _mm_srli_epi16(x,8) ), low );
+	}
+	if ( valid != 0xffffffff )
+	    break;
+	_mm_storeu_si128((__m128i*)dest,_mm_packus_epi16(val[0],val[1]));
+    }
+
+    *p_src = src;
+    return dest;
+ }
+
+#endif // HAVE_X86_SIMD
+
+///////////////////////////////////////////////////////////////////////////////
+
+static char * EncodeHexBytes ( char *dest, const u8 *src, uint size, ccp digits )
+{
+    // write 2*size hex digits, no NULL termination
+
+ #if HAVE_X86_SIMD
+    if ( size >= 16 && ( digits == LoDigits || digits == HiDigits ) )
+    {
+	const uint n_blocks = size / 16;
+	dest  = EncodeHexSSE2(dest,src,n_blocks,digits==HiDigits);
+	src  += 16 * n_blocks;
+	size -= 16 * n_blocks;
+    }
+ #endif
+
+    while ( size-- > 0 )
+    {
+	const u8 ch = *src++;
+	*dest++ = digits[ch>>4];
+	*dest++ = digits[ch&15];
+    }
+    return dest;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// [[hex]]
+
+char * PrintHexNumber
+(
+    // Print 'num' in hex, right aligned in a field of at least 'min_digits'
+    // chars and filled with 'fill' (' ' or '0'). No NULL termination.
+    // Returns a pointer to the end of the printed number.
+
+    char	*dest,			// valid destination, >= 16 or 'min_digits' bytes
+    u64		num,			// number to print
+    uint	min_digits,		// minimal field width
+    char	fill,			// fill char, usually ' ' or '0'
+    ccp		digits			// digits to use, eg. LoDigits[] (=fallback) or HiDigits[]
+)
+{
+    DASSERT(dest);
+    if (!digits)
+	digits = LoDigits;
+
+    const uint n_digits = num ? ( 67 - __builtin_clzll(num) ) / 4 : 1;
+    if ( min_digits > n_digits )
+    {
+	memset(dest,fill,min_digits-n_digits);
+	dest += min_digits - n_digits;
+    }
+
+    char *end = dest + n_digits;
+    for ( dest = end; num >= 0x10; num >>= 8 )
+    {
+	*--dest = digits[num&15];
+	*--dest = digits[num>>4&15];
+    }
+    if ( dest > end - n_digits )
+	*--dest = digits[num];
+    return end;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static const char DecimalPairs[201] =
+	"00010203040506070809" "10111213141516171819"
+	"20212223242526272829" "30313233343536373839"
+	"40414243444546474849" "50515253545556575859"
+	"60616263646566676869" "70717273747576777879"
+	"80818283848586878889" "90919293949596979899";
+
+//-----------------------------------------------------------------------------
+
+char * PrintFixedDecimal
+(
+    // Print the lowest 'n_digits' decimal digits of 'num' with leading
+    // zeros. No NULL termination.
+    // Returns a pointer to the end of the printed number.
+
+    char	*dest,			// valid destination, >= 'n_digits' bytes
+    u32		num,			// number to print
+    uint	n_digits		// number of digits to print
+)
+{
+    DASSERT(dest);
+
+    char *end = dest + n_digits;
+    for ( dest = end; n_digits >= 2; n_digits -= 2, num /= 100 )
+    {
+	dest -= 2;
+	memcpy(dest,DecimalPairs+2*(num%100),2);
+    }
+    if (n_digits)
+	*--dest = '0' + num % 10;
+    return end;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Helpers for the PrintNumber*(), PrintSize*() and PrintTimer*() functions.
+// A field is composed by PutDecimal*() in a small local buffer and then
+// stored by StoreField() with the truncation rules of snprintf().
+
+static const u64 DecimalPow10[20] =
+{
+			   1ull,		    10ull,
+			 100ull,		  1000ull,
+		       10000ull,		100000ull,
+		     1000000ull,	      10000000ull,
+		   100000000ull,	    1000000000ull,
+		 10000000000ull,	  100000000000ull,
+	       1000000000000ull,	10000000000000ull,
+	     100000000000000ull,      1000000000000000ull,
+	   10000000000000000ull,    100000000000000000ull,
+	 1000000000000000000ull, 10000000000000000000ull,
+};
+
+//-----------------------------------------------------------------------------
+
+static inline uint CountDecimalDigits ( u64 num )
+{
+    // log10(2) ~= 1233/4096; 'num|1' => 1 digit for 0
+    num |= 1;
+    const uint t = ( 64 - __builtin_clzll(num) ) * 1233 >> 12;
+    return t + 1 - ( num < DecimalPow10[t] );
+}
+
+//-----------------------------------------------------------------------------
+
+static char * PutDecimal0
+(
+    // like sprintf("%0*llu"): print at least 'n_digits' digits
+    // Returns a pointer to the end of the printed number.
+
+    char	*dest,			// valid destination
+    u64		num,			// number to print
+    uint	n_digits		// minimal number of digits
+)
+{
+    const uint n = CountDecimalDigits(num);
+    if ( n_digits < n )
+	n_digits = n;
+
+    char *end = dest + n_digits;
+    for ( dest = end; num >= 100; num /= 100 )
+    {
+	dest -= 2;
+	memcpy(dest,DecimalPairs+2*(num%100),2);
+    }
+    if ( num >= 10 )
+    {
+	dest -= 2;
+	memcpy(dest,DecimalPairs+2*num,2);
+    }
+    else
+	*--dest = '0' + num;
+
+    while ( dest > end - n_digits )
+	*--dest = '0';
+    return end;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline char * PutFixedDecimal2 ( char *dest, uint num )
+{
+    // like sprintf("%02u") for num < 100
+    DASSERT( num < 100 );
+    memcpy(dest,DecimalPairs+2*num,2);
+    return dest + 2;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline char * PutDecimal ( char *dest, u64 num )
+{
+    // like sprintf("%llu")
+    return PutDecimal0(dest,num,0);
+}
+
+//-----------------------------------------------------------------------------
+
+static char * PutDecimalFW
+(
+    // like sprintf("%*lld"): right aligned, padded by spaces
+    // Returns a pointer to the end of the printed number.
+
+    char	*dest,			// valid destination
+    u64		num,			// absolute value of the number to print
+    bool	minus,			// true: print a minus sign before 'num'
+    uint	fw			// minimal field width
+)
+{
+    const uint len = CountDecimalDigits(num) + minus;
+    if ( fw > len )
+    {
+	memset(dest,' ',fw-len);
+	dest += fw - len;
+    }
+    if (minus)
+	*dest++ = '-';
+    return PutDecimal(dest,num);
+}
+
+//-----------------------------------------------------------------------------
+
+static uint StoreField
 (
-    // Returns a buffer alloced by GetCircBuf()
-    // with valid pointer and null terminated.
-    // If result is too large (>CIRC_BUF_MAX_ALLOC) then (0,0) is returned.
+    // Store a composed field with the semantics of snprintf().
+    // Returns the length of the complete field.
 
-    const void	*source,		// NULL or data to encode
-    int		source_len,		// length of 'source'; if <0: use strlen(source)
-    int		null_if			// return 'null' without quotes ...
-					//	<=0: never
-					//	>=1: if source == NULL
-					//	>=2: if source_len == 0
+    char	*buf,			// result buffer
+    size_t	buf_size,		// size of 'buf'
+    ccp		src,			// source of the field
+    uint	len			// length of the field
 )
 {
-    if ( source_len < 0 )
-	source_len = source ? strlen(source) : 0;
-
-    mem_t mem;
-    if ( null_if > 0 && !source || null_if > 1 && !source_len )
+    if (buf_size)
     {
-	mem.ptr = "null";
-	mem.len = 4;
-    }
-    else
-    {
-	char buf[CIRC_BUF_MAX_ALLOC+10];
-	mem.len = EncodeJSON(buf+1,sizeof(buf)-2,source,source_len) + 2;
-	if ( mem.len < CIRC_BUF_MAX_ALLOC - 2 )
-	{
-	    buf[0] = buf[mem.len-1] = '"';
-	    buf[mem.len] = 0;
-	    mem.ptr = CopyCircBuf(buf,mem.len+1);
-	}
-	else
-	{
-	    mem.ptr = 0;
-	    mem.len = 0;
-	}
+	const uint copy_len = len < buf_size ? len : buf_size - 1;
+	memcpy(buf,src,copy_len);
+	buf[copy_len] = 0;
     }
-    return mem;
+    return len;
 }
 
 //-----------------------------------------------------------------------------
 
-mem_t DecodeJSONCirc
+static char * StoreNumberUnit
 (
-    // Returns a buffer alloced by GetCircBuf()
-    // with valid pointer and null terminated.
-    // If result is too large (>CIRC_BUF_MAX_ALLOC) then (0,0) is returned.
+    // like snprintf("%*lld%c") with optional unit char
+    // Returns 'buf'.
+
+    char	*buf,			// result buffer
+    size_t	buf_size,		// size of 'buf'
+    u64		num,			// absolute value of the number to print
+    bool	minus,			// true: print a minus sign before 'num'
+    uint	fw,			// minimal field width of the number
+    char	unit			// NULL or unit char to append
+)
+{
+    char temp[32];
+    char *dest = PutDecimalFW(temp,num,minus,fw);
+    if (unit)
+	*dest++ = unit;
+    StoreField(buf,buf_size,temp,dest-temp);
+    return buf;
+}
 
-    ccp		source,		// NULL or string to decode
-    int		source_len,	// length of 'source'. If -1, str is NULL terminated
-    int		quote		// -1:auto, 0:none, >0: quotation char
+//-----------------------------------------------------------------------------
+
+static char * StoreNumberUnit2
+(
+    // like snprintf("%*llu%c%0*u%c"), used for combined units like "12m34s"
+    // Returns 'buf'.
+
+    char	*buf,			// result buffer
+    size_t	buf_size,		// size of 'buf'
+    u64		num1,			// first number to print
+    uint	fw1,			// minimal field width of 'num1'
+    char	unit1,			// unit char after 'num1'
+    uint	num2,			// second number to print
+    uint	n_digits2,		// minimal number of digits of 'num2'
+					// 0: don't print 'num2'
+    char	unit2			// unit char after 'num2'
 )
 {
-    char buf[CIRC_BUF_MAX_ALLOC+10];
-    mem_t mem;
-    mem.len = DecodeJSON(buf,sizeof(buf),source,source_len,quote,0);
-    if ( mem.len < CIRC_BUF_MAX_ALLOC )
-	mem.ptr = CopyCircBuf(buf,mem.len+1);
-    else
-    {
-	mem.ptr = 0;
-	mem.len = 0;
-    }
-    return mem;
+    char temp[40];
+    char *dest = PutDecimalFW(temp,num1,false,fw1);
+    *dest++ = unit1;
+    if (n_digits2)
+	dest = PutDecimal0(dest,num2,n_digits2);
+    *dest++ = unit2;
+    StoreField(buf,buf_size,temp,dest-temp);
+    return buf;
+}
+
+//-----------------------------------------------------------------------------
+
+static char * StoreNumberDot1
+(
+    // like snprintf("%llu.%u%c",num10/10,num10%10,unit) with optional minus
+    // Returns 'buf'.
+
+    char	*buf,			// result buffer
+    size_t	buf_size,		// size of 'buf'
+    u64		num10,			// absolute value of the number *10
+    bool	minus,			// true: print a minus sign before 'num'
+    char	unit			// unit char to append
+)
+{
+    char temp[32], *dest = temp;
+    if (minus)
+	*dest++ = '-';
+    dest = PutDecimal(dest,num10/10);
+    dest[0] = '.';
+    dest[1] = '0' + num10 % 10;
+    dest[2] = unit;
+    StoreField(buf,buf_size,temp,dest+3-temp);
+    return buf;
 }
 
-///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 // [[hex]]
 
@@ -2002,20 +3546,13 @@ uint EncodeHex
     if (!digits)
 	digits = LoDigits;
 
-    char *dest = buf;
-    char *dest_end = dest + buf_size - 1;
-
     if (!source)
 	source = "";
-    ccp str = source;
-    ccp end = str + ( source_len < 0 ? strlen(str) : source_len );
+    uint size = source_len < 0 ? strlen(source) : source_len;
+    if ( size > buf_size/2 )
+	size = buf_size/2;
 
-    while ( dest < dest_end && str < end )
-    {
-	const u8 ch = (u8)*str++;
-	*dest++ = digits[ch>>4];
-	*dest++ = digits[ch&15];
-    }
+    char *dest = EncodeHexBytes(buf,source,size,digits);
     *dest = 0;
     return dest - buf;
 }
@@ -2079,6 +3616,17 @@ uint DecodeHex
 	have_quote = true;
     }
 
+ #if HAVE_X86_SIMD
+    {
+	uint n_blocks = ( src_end - src ) / 32;
+	const uint max_blocks = ( dest_end - dest ) / 16;
+	if ( n_blocks > max_blocks )
+	    n_blocks = max_blocks;
+	if ( n_blocks > 0 )
+	    dest = DecodeHexSSE2(dest,&src,n_blocks);
+    }
+ #endif
+
     while ( dest < dest_end && src < src_end )
     {
 	u8 hi = TableNumbers[(u8)*src];
@@ -2572,34 +4120,43 @@ exmem_t EscapeStringEx
 	quote_char = '"';
     }
 
-    uint size = GetEscapeLen(src,src_len,char_mode,quote_char);
-    if ( !size && char_mode & CHMD_IF_REQUIRED )
-	return ExMemByS(src,src_len);
+    //--- escape in a single pass into a local buffer
 
-    size += quote_mode + src_len + 4;
-    const bool use_circ = try_circ && size <= CIRC_BUF_MAX_ALLOC;
-    char *buf = use_circ ? GetCircBuf(size) : MALLOC(size);
+    // clear the header only: InitializeFastBuf() takes a const pointer,
+    // so the compiler assumes that it reads the uninitialized struct
+    struct { FastBuf_t b; char space[CIRC_BUF_MAX_ALLOC]; } fb;
+    memset(&fb.b,0,sizeof(fb.b));
+    InitializeFastBuf(&fb,sizeof(fb));
 
-    uint len;
     if ( quote_mode == 3 )
-    {
-	PrintEscapedString(buf+2,size-3,src,src_len,char_mode,quote_char,&len);
-	buf[0] = '$';
-	buf[1] = buf[len+2] = quote_char;
-	buf[len+3] = 0;
+	AppendCharFastBuf(&fb.b,'$');
+    if (quote_mode)
+	AppendCharFastBuf(&fb.b,quote_char);
 
+    const uint esc_len = PrintEscapedFastBuf(&fb.b,src,src_len,char_mode,quote_char);
+    if ( esc_len == src_len && char_mode & CHMD_IF_REQUIRED )
+    {
+	// nothing escaped
+	ResetFastBuf(&fb.b);
+	return ExMemByS(src,src_len);
     }
-    else if ( quote_mode == 2 )
+
+    if (quote_mode)
+	AppendCharFastBuf(&fb.b,quote_char);
+
+    exmem_t res = {{0}};
+    res.data.len = GetFastBufLen(&fb.b);
+    if ( try_circ && res.data.len + 4 <= CIRC_BUF_MAX_ALLOC )
     {
-	PrintEscapedString(buf+1,size-2,src,src_len,char_mode,quote_char,&len);
-	buf[0] = buf[len+1] = quote_char;
-	buf[len+2] = 0;
+	res.data.ptr = CopyCircBuf(GetFastBufString(&fb.b),res.data.len+1);
+	res.is_circ_buf = true;
+	ResetFastBuf(&fb.b);
     }
     else
-	PrintEscapedString(buf,size,src,src_len,char_mode,quote_char,&len);
-
-    exmem_t res = { .data={ buf, len+quote_mode },
-			.is_circ_buf = use_circ, .is_alloced = !use_circ };
+    {
+	res.data.ptr = MoveFromFastBufString(&fb.b);
+	res.is_alloced = true;
+    }
     return res;
 };
 
@@ -2879,12 +4436,162 @@ static u_sec_t AdjustLocalTime ( u_sec_t sec )
     return sec - timezone_adjust_sec;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+#if HAVE_CLOCK_GETTIME && defined(CLOCK_REALTIME_COARSE) && defined(CLOCK_MONOTONIC_COARSE)
+  #define HAVE_COARSE_CLOCK 1
+  #define DC_CLOCK_CHECK CLOCK_MONOTONIC_COARSE
+#else
+  #define HAVE_COARSE_CLOCK 0
+  #define DC_CLOCK_CHECK CLOCK_MONOTONIC
+#endif
+
+ClockCache_t clock_cache = {0};
+
+// Statistics are per thread to keep the hot path free of shared writes.
+// CLKM_EXACT is not counted.
+static __thread u64 clock_n_system = 0;	// number of system clock reads
+static __thread u64 clock_n_cached = 0;	// number of reads served by the cache
+
+//-----------------------------------------------------------------------------
+
+void SetClockMode ( ClockMode_t mode, u_nsec_t max_stale_nsec )
+{
+ #if !HAVE_COARSE_CLOCK
+    if ( mode == CLKM_COARSE )
+	mode = CLKM_EXACT;
+ #endif
+ #if !HAVE_CLOCK_GETTIME
+    mode = CLKM_EXACT;
+ #endif
+
+    clock_cache.mode		= mode;
+    clock_cache.max_stale_nsec	= max_stale_nsec;
+    clock_n_system		= 0;
+    clock_n_cached		= 0;
+    UpdateClockCache();
+}
+
+//-----------------------------------------------------------------------------
+
+void UpdateClockCache(void)
+{
+ #if HAVE_CLOCK_GETTIME
+    if ( clock_cache.mode == CLKM_CACHED )
+    {
+	struct timespec ts;
+	if (!clock_gettime(CLOCK_REALTIME,&ts))
+	    __atomic_store_n( &clock_cache.real_nsec,
+			ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec, __ATOMIC_RELAXED );
+
+	if (!clock_gettime(CLOCK_MONOTONIC,&ts))
+	{
+	    // a concurrent update may have stored a newer value
+	    const u_nsec_t nsec = ts.tv_sec * NSEC_PER_SEC + ts.tv_nsec;
+	    u_nsec_t old = __atomic_load_n(&clock_cache.mono_nsec,__ATOMIC_RELAXED);
+	    while ( old < nsec
+		&& !__atomic_compare_exchange_n(&clock_cache.mono_nsec,&old,nsec,
+				true,__ATOMIC_RELAXED,__ATOMIC_RELAXED) )
+		;
+	}
+	clock_n_system += 2;
+    }
+ #endif
+}
+
+//-----------------------------------------------------------------------------
+
+#if HAVE_CLOCK_GETTIME
+
+static bool GetModeClock ( struct timespec *ts, bool monotonic )
+{
+    // returns false for CLKM_EXACT, otherwise store time in 'ts'
+    DASSERT(ts);
+
+    switch (clock_cache.mode)
+    {
+     #if HAVE_COARSE_CLOCK
+      case CLKM_COARSE:
+	// on error, the caller reads the exact clock
+	if (clock_gettime( monotonic ? CLOCK_MONOTONIC_COARSE
+				     : CLOCK_REALTIME_COARSE, ts ))
+	    return false;
+	clock_n_system++;
+	return true;
+     #endif
+
+      case CLKM_CACHED:
+	{
+	    u_nsec_t mono = __atomic_load_n(&clock_cache.mono_nsec,__ATOMIC_RELAXED);
+	    if ( clock_cache.max_stale_nsec )
+	    {
+		// the coarse clock is cheap and good enough to check the age
+		struct timespec now;
+		if ( clock_gettime(DC_CLOCK_CHECK,&now)
+		    || now.tv_sec * NSEC_PER_SEC + now.tv_nsec
+				> mono + clock_cache.max_stale_nsec )
+		{
+		    UpdateClockCache();
+		    mono = __atomic_load_n(&clock_cache.mono_nsec,__ATOMIC_RELAXED);
+		}
+		else
+		    clock_n_cached++;
+	    }
+	    else
+		clock_n_cached++;
+
+	    const u_nsec_t nsec = monotonic ? mono
+			: __atomic_load_n(&clock_cache.real_nsec,__ATOMIC_RELAXED);
+	    if (!nsec)
+		return false; // never updated or clock failed
+	    ts->tv_sec  = nsec / NSEC_PER_SEC;
+	    ts->tv_nsec = nsec % NSEC_PER_SEC;
+	}
+	return true;
+
+      default:
+	return false;
+    }
+}
+
+#endif // HAVE_CLOCK_GETTIME
+
 //-----------------------------------------------------------------------------
 
+ccp GetClockCacheStatistics(void)
+{
+    static const ccp mode_name[] = { "exact", "coarse", "cached" };
+    const u64 total = clock_n_system + clock_n_cached;
+
+    char buf[150];
+    const uint len = snprintf(buf,sizeof(buf),
+		"mode=%s, max-stale=%s, %llu system reads, %llu cached (%.1f%%)",
+		(uint)clock_cache.mode < sizeof(mode_name)/sizeof(*mode_name)
+			? mode_name[clock_cache.mode] : "?",
+		clock_cache.max_stale_nsec
+			? PrintTimerNSec6(0,0,clock_cache.max_stale_nsec,0) : "-",
+		clock_n_system, clock_n_cached,
+		total ? 100.0 * clock_n_cached / total : 0.0 );
+    return CopyCircBuf(buf,len+1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 struct timeval GetTimeOfDay ( bool localtime )
 {
     struct timeval tval;
-    gettimeofday(&tval,NULL);
+
+ #if HAVE_CLOCK_GETTIME
+    struct timespec ts;
+    if (GetModeClock(&ts,false))
+    {
+	tval.tv_sec  = ts.tv_sec;
+	tval.tv_usec = ts.tv_nsec / NSEC_PER_USEC;
+    }
+    else
+ #endif
+	gettimeofday(&tval,NULL);
+
     if (localtime)
 	tval.tv_sec = AdjustLocalTime(tval.tv_sec);
     return tval;
@@ -2897,7 +4604,7 @@ struct timespec GetClockTime ( bool localtime )
     struct timespec ts;
 
  #if HAVE_CLOCK_GETTIME
-    if (!clock_gettime(CLOCK_REALTIME,&ts))
+    if ( GetModeClock(&ts,false) || !clock_gettime(CLOCK_REALTIME,&ts) )
     {
 	if (localtime)
 	    ts.tv_sec = AdjustLocalTime(ts.tv_sec);
@@ -2919,7 +4626,7 @@ struct timespec GetClockTimer(void)
     struct timespec ts;
 
  #if HAVE_CLOCK_GETTIME
-    if (!clock_gettime(CLOCK_MONOTONIC,&ts))
+    if ( GetModeClock(&ts,true) || !clock_gettime(CLOCK_MONOTONIC,&ts) )
 	return ts;
  #endif
 
@@ -3099,6 +4806,126 @@ ccp PrintRefTimeUTC
     return PrintTimeByFormatUTC(format,tim);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// strftime() is expensive. So the results are cached for the last second
+// of some formats. Local times are cached with the timezone adjustment.
+// Each thread has its own cache.
+
+#define TIME_FORMAT_CACHE_N	8	// number of cached formats
+#define TIME_FORMAT_MAX_LEN	40	// max length of cached formats
+
+typedef struct time_format_t
+{
+    time_t	tim;				// cached second
+    s64		tz_adjust;			// 'timezone_adjust_sec' or 0 for UTC
+    bool	utc;				// true: gmtime(), false: localtime()
+    s8		at;				// index of first '@' in 'text', -1: none
+    u8		len;				// length of 'text'
+    char	format[TIME_FORMAT_MAX_LEN];	// the format
+    char	text[100];			// result of strftime()
+}
+time_format_t;
+
+static __thread time_format_t time_format_cache[TIME_FORMAT_CACHE_N] = {{0}};
+static __thread uint time_format_next = 0;
+
+//-----------------------------------------------------------------------------
+
+static const time_format_t * GetTimeFormat ( ccp format, time_t tim, bool utc )
+{
+    // returns NULL if 'format' is too long to be cached
+
+    DASSERT(format);
+    const uint flen = strlen(format);
+    if ( flen >= TIME_FORMAT_MAX_LEN )
+	return 0;
+
+    const s64 tz_adjust = utc ? 0 : timezone_adjust_sec;
+
+    time_format_t *tf = time_format_cache, *slot = 0;
+    time_format_t *end = tf + TIME_FORMAT_CACHE_N;
+    for ( ; tf < end; tf++ )
+	if ( tf->utc == utc && !memcmp(tf->format,format,flen+1) )
+	{
+	    if ( tf->tim == tim && tf->tz_adjust == tz_adjust )
+		return tf;
+	    slot = tf;
+	    break;
+	}
+
+    if (!slot)
+    {
+	slot = time_format_cache + time_format_next;
+	time_format_next = ( time_format_next + 1 ) % TIME_FORMAT_CACHE_N;
+	memcpy(slot->format,format,flen+1);
+	slot->utc = utc;
+    }
+
+    struct tm *tm = utc ? gmtime(&tim) : localtime(&tim);
+    const uint len = strftime(slot->text,sizeof(slot->text),format,tm);
+    slot->text[len] = 0;
+    slot->len = len;
+
+    ccp at = memchr(slot->text,'@',len);
+    slot->at = at ? at - slot->text : -1;
+    slot->tim = tim;
+    slot->tz_adjust = tz_adjust;
+    return slot;
+}
+
+//-----------------------------------------------------------------------------
+
+static ccp PrintTimeByFormatHelper ( ccp format, u_sec_t tim, bool utc )
+{
+    const time_t reftime = tim ? tim : time(0);
+    const time_format_t *tf = GetTimeFormat(format,reftime,utc);
+    if (tf)
+	return CopyCircBuf(tf->text,tf->len+1);
+
+    char buf[100];
+    struct tm *tm = utc ? gmtime(&reftime) : localtime(&reftime);
+    const uint len = strftime(buf,sizeof(buf),format,tm);
+    return CopyCircBuf(buf,len+1);
+}
+
+//-----------------------------------------------------------------------------
+
+static ccp PrintNSecByFormatHelper ( ccp format, time_t tim, uint nsec, bool utc )
+{
+    char nbuf[11];
+    if ( nsec < NSEC_PER_SEC )
+	PrintFixedDecimal(nbuf,nsec,9);
+    else
+	snprintf(nbuf,sizeof(nbuf),"%09u",nsec);
+
+    char *buf;
+    uint len;
+    const time_format_t *tf = GetTimeFormat(format,tim,utc);
+    if (tf)
+    {
+	len = tf->len;
+	buf = CopyCircBuf(tf->text,len+1);
+	if ( tf->at < 0 )
+	    return buf;
+    }
+    else
+    {
+	char temp[100];
+	struct tm *tm = utc ? gmtime(&tim) : localtime(&tim);
+	len = strftime(temp,sizeof(temp),format,tm);
+	buf = CopyCircBuf(temp,len+1);
+    }
+
+    char *at = strchr(buf,'@');
+    if (at)
+    {
+	ccp src = nbuf;
+	while ( *at == '@' && src < nbuf + 9 && *src )
+	    *at++ = *src++;
+    }
+    return buf;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 ccp PrintTimeByFormat
@@ -3109,11 +4936,7 @@ ccp PrintTimeByFormat
     u_sec_t		tim		// seconds since epoch; 0 is replaced by time()
 )
 {
-    char buf[100];
-    const time_t reftime = tim ? tim : time(0);
-    struct tm *tm = localtime(&reftime);
-    const uint len = strftime(buf,sizeof(buf),format,tm);
-    return CopyCircBuf(buf,len+1);
+    return PrintTimeByFormatHelper(format,tim,false);
 }
 
 //-----------------------------------------------------------------------------
@@ -3126,39 +4949,22 @@ ccp PrintTimeByFormatUTC
     u_sec_t		tim		// seconds since epoch; 0 is replaced by time()
 )
 {
-    char buf[100];
-    const time_t reftime = tim ? tim : time(0);
-    struct tm *tm = gmtime(&reftime);
-    const uint len = strftime(buf,sizeof(buf),format,tm);
-    return CopyCircBuf(buf,len+1);
+    return PrintTimeByFormatHelper(format,tim,true);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 ccp PrintNSecByFormat
 (
-    // returns temporary buffer by GetCircBuf();
-
-    ccp			format,		// format string for strftime()
-					// 1-9 '@' in row replaced by digits of 'nsec'
-    time_t		tim,		// seconds since epoch
-    uint		nsec		// nanosecond of second
-)
-{
-    char buf[100];
-    struct tm *tm = localtime(&tim);
-    const uint len = strftime(buf,sizeof(buf),format,tm);
-    char *at = strchr(buf,'@');
-    if (at)
-    {
-	char nbuf[10];
-	snprintf(nbuf,sizeof(nbuf),"%09u",nsec);
-	ccp src = nbuf;
-	while ( *at == '@' && *src )
-	    *at++ = *src++;
-    }
+    // returns temporary buffer by GetCircBuf();
 
-    return CopyCircBuf(buf,len+1);
+    ccp			format,		// format string for strftime()
+					// 1-9 '@' in row replaced by digits of 'nsec'
+    time_t		tim,		// seconds since epoch
+    uint		nsec		// nanosecond of second
+)
+{
+    return PrintNSecByFormatHelper(format,tim,nsec,false);
 }
 
 //-----------------------------------------------------------------------------
@@ -3173,20 +4979,7 @@ ccp PrintNSecByFormatUTC
     uint		nsec		// nanosecond of second
 )
 {
-    char buf[100];
-    struct tm *tm = gmtime(&tim);
-    const uint len = strftime(buf,sizeof(buf),format,tm);
-    char *at = strchr(buf,'@');
-    if (at)
-    {
-	char nbuf[10];
-	snprintf(nbuf,sizeof(nbuf),"%09u",nsec);
-	ccp src = nbuf;
-	while ( *at == '@' && *src )
-	    *at++ = *src++;
-    }
-
-    return CopyCircBuf(buf,len+1);
+    return PrintNSecByFormatHelper(format,tim,nsec,true);
 }
 
 //-----------------------------------------------------------------------------
@@ -3475,10 +5268,17 @@ ccp PrintTimerMSec
     if (!buf)
 	buf = GetCircBuf( buf_size = 16 );
 
+    char temp[24], *dest = PutDecimal0(temp,msec/3600000,2);
+    *dest++ = ':';
+    dest = PutFixedDecimal2(dest,msec/60000%60);
+    *dest++ = ':';
+    dest = PutFixedDecimal2(dest,msec/1000%60);
+
     if (fraction)
     {
-	const uint len = snprintf(buf,buf_size,"%02d:%02d:%02d.%03d",
-		msec/3600000, msec/60000%60, msec/1000%60, msec%1000 );
+	*dest++ = '.';
+	dest = PrintFixedDecimal(dest,msec%1000,3);
+	const uint len = StoreField(buf,buf_size,temp,dest-temp);
 	if ( len > 3 && fraction < 3 )
 	{
 	    const uint pos = len - 3 + fraction;
@@ -3487,8 +5287,7 @@ ccp PrintTimerMSec
 	}
     }
     else
-	snprintf(buf,buf_size,"%02d:%02d:%02d",
-	    msec/3600000, msec/60000%60, msec/1000%60 );
+	StoreField(buf,buf_size,temp,dest-temp);
 
     ccp ptr = buf;
     int colon_counter = 0;
@@ -3517,10 +5316,17 @@ ccp PrintTimerUSec
 
     u32 sec = usec / USEC_PER_SEC;
 
+    char temp[32], *dest = PutDecimal0(temp,sec/3600,2);
+    *dest++ = ':';
+    dest = PutFixedDecimal2(dest,sec/60%60);
+    *dest++ = ':';
+    dest = PutFixedDecimal2(dest,sec%60);
+
     if (fraction)
     {
-	const uint len = snprintf(buf+1,buf_size-1,"%02d:%02d:%02d.%06lld",
-	    sec/3600, sec/60%60, sec%60, (u64)usec%USEC_PER_SEC );
+	*dest++ = '.';
+	dest = PrintFixedDecimal(dest,(u64)usec%USEC_PER_SEC,6);
+	const uint len = StoreField(buf+1,buf_size-1,temp,dest-temp);
 	if ( len > 6 && fraction < 6 )
 	{
 	    const uint pos = len - 6 + fraction;
@@ -3529,8 +5335,7 @@ ccp PrintTimerUSec
 	}
     }
     else
-	snprintf(buf+1,buf_size-1,"%02d:%02d:%02d",
-	    sec/3600, sec/60%60, sec%60 );
+	StoreField(buf+1,buf_size-1,temp,dest-temp);
 
     char *ptr = buf+1;
     while ( *ptr == '0' || *ptr == ':' )
@@ -3562,10 +5367,17 @@ ccp PrintTimerNSec
 
     u32 sec = nsec / NSEC_PER_SEC;
 
+    char temp[32], *dest = PutDecimal0(temp,sec/3600,2);
+    *dest++ = ':';
+    dest = PutFixedDecimal2(dest,sec/60%60);
+    *dest++ = ':';
+    dest = PutFixedDecimal2(dest,sec%60);
+
     if (fraction)
     {
-	const uint len = snprintf(buf+1,buf_size-1,"%02d:%02d:%02d.%09lld",
-	    sec/3600, sec/60%60, sec%60, (u64)nsec%NSEC_PER_SEC );
+	*dest++ = '.';
+	dest = PrintFixedDecimal(dest,(u64)nsec%NSEC_PER_SEC,9);
+	const uint len = StoreField(buf+1,buf_size-1,temp,dest-temp);
 	if ( len > 9 && fraction < 9 )
 	{
 	    const uint pos = len - 9 + fraction;
@@ -3574,8 +5386,7 @@ ccp PrintTimerNSec
 	}
     }
     else
-	snprintf(buf+1,buf_size-1,"%02d:%02d:%02d",
-	    sec/3600, sec/60%60, sec%60 );
+	StoreField(buf+1,buf_size-1,temp,dest-temp);
 
     char *ptr = buf+1;
     while ( *ptr == '0' || *ptr == ':' )
@@ -3614,32 +5425,32 @@ ccp PrintTimer3
 	if (!usec)
 	    StringCopyS(buf,buf_size,aligned?"  0":"0");
 	else if ( usec < 100 )
-	    snprintf(buf,buf_size,aligned?"%2uu":"%uu",usec);
+	    StoreNumberUnit(buf,buf_size,usec,false,aligned?2:0,'u');
 	else if ( usec < 1000 )
-	    snprintf(buf,buf_size,".%ui",usec/100);
+	    StoreField(buf,buf_size,(char[]){'.','0'+usec/100,'i'},3);
 	else if ( usec < 100000 )
-	    snprintf(buf,buf_size,aligned?"%2ui":"%ui",usec/1000);
+	    StoreNumberUnit(buf,buf_size,usec/1000,false,aligned?2:0,'i');
 	else
-	    snprintf(buf,buf_size,".%us",usec/100000);
+	    StoreField(buf,buf_size,(char[]){'.','0'+usec/100000,'s'},3);
     }
     else if ( sec < 100 )
-	snprintf(buf,buf_size,aligned?"%2llus":"%llus",sec);
+	StoreNumberUnit(buf,buf_size,sec,false,aligned?2:0,'s');
     else if ( sec < 6000 )
-	snprintf(buf,buf_size,aligned?"%2llum":"%llum",sec/60);
+	StoreNumberUnit(buf,buf_size,sec/60,false,aligned?2:0,'m');
     else if ( sec < 360000 )
-	snprintf(buf,buf_size,aligned?"%2lluh":"%lluh",sec/3600);
+	StoreNumberUnit(buf,buf_size,sec/3600,false,aligned?2:0,'h');
     else
     {
 	const u64 days = sec / (24*3600);
 	if ( days < 100 )
-	    snprintf(buf,buf_size,aligned?"%2llud":"%llud",days);
+	    StoreNumberUnit(buf,buf_size,days,false,aligned?2:0,'d');
 	else if ( days < 700 )
-	    snprintf(buf,buf_size,aligned?"%2lluw":"%lluw",days/7);
+	    StoreNumberUnit(buf,buf_size,days/7,false,aligned?2:0,'w');
 	else
 	{
 	    const u32 years = days / 365;
 	    if ( years < 100 )
-		snprintf(buf,buf_size,aligned?"%2uy":"%uy",years);
+		StoreNumberUnit(buf,buf_size,years,false,aligned?2:0,'y');
 	    else
 		buf = "***";
 	}
@@ -3672,34 +5483,34 @@ ccp PrintTimer4
     else if ( sec < 10 && usec >= 0 && usec <= 999999 )
     {
 	if (sec)
-	    snprintf(buf,buf_size,"%llu.%us",sec,usec/100000);
+	    StoreNumberDot1(buf,buf_size,sec*10+usec/100000,false,'s');
 	else if (!usec)
 	    StringCopyS(buf,buf_size,aligned?"   0":"0");
 	else if ( usec < 1000 )
-	    snprintf(buf,buf_size,aligned?"%3uu":"%uu",usec);
+	    StoreNumberUnit(buf,buf_size,usec,false,aligned?3:0,'u');
 	else if ( usec < 10000 )
-	    snprintf(buf,buf_size,"%u.%ui",usec/1000,usec/100%10);
+	    StoreNumberDot1(buf,buf_size,usec/100,false,'i');
 	else
-	    snprintf(buf,buf_size,aligned?"%3ui":"%ui",usec/1000);
+	    StoreNumberUnit(buf,buf_size,usec/1000,false,aligned?3:0,'i');
     }
     else if ( sec < 600 )
-	snprintf(buf,buf_size,aligned?"%3llus":"%llus",sec);
+	StoreNumberUnit(buf,buf_size,sec,false,aligned?3:0,'s');
     else if ( sec < 36000 )
-	snprintf(buf,buf_size,aligned?"%3llum":"%llum",sec/60);
+	StoreNumberUnit(buf,buf_size,sec/60,false,aligned?3:0,'m');
     else if ( sec < 168*3600 )
-	snprintf(buf,buf_size,aligned?"%3lluh":"%lluh",sec/3600);
+	StoreNumberUnit(buf,buf_size,sec/3600,false,aligned?3:0,'h');
     else
     {
 	const u64 days = sec / (24*3600);
 	if ( days < 365 )
-	    snprintf(buf,buf_size,aligned?"%3llud":"%llud",days);
+	    StoreNumberUnit(buf,buf_size,days,false,aligned?3:0,'d');
 	else if ( days < 10*365 )
-	    snprintf(buf,buf_size,aligned?"%3lluw":"%lluw",days/7);
+	    StoreNumberUnit(buf,buf_size,days/7,false,aligned?3:0,'w');
 	else
 	{
 	    const u32 years = days / 365;
 	    if ( years < 1000 )
-		snprintf(buf,buf_size,aligned?"%3uy":"%uy",years);
+		StoreNumberUnit(buf,buf_size,years,false,aligned?3:0,'y');
 	    else
 		buf = "****";
 	}
@@ -3724,8 +5535,8 @@ ccp PrintTimer6N
     if ( mode & DC_SFORM_CENTER )
     {
 	char buf2[20];
-	PrintTimer6N(buf2,sizeof(buf2),sec,nsec,mode&~(DC_SFORM_CENTER|DC_SFORM_ALIGN));
-	return StringCenterS(buf,buf_size,buf2,6);
+	ccp res = PrintTimer6N(buf2,sizeof(buf2),sec,nsec,mode&~(DC_SFORM_CENTER|DC_SFORM_ALIGN));
+	return StringCenterS(buf,buf_size,res,6);
     }
 
     char temp[20];
@@ -3747,37 +5558,37 @@ ccp PrintTimer6N
 	    if (!sum)
 		StringCopyS(buf,buf_size,"     0");
 	    else if ( sum < 10000 )
-		snprintf(buf,buf_size,"%4lluns",sum);
+		StoreNumberUnit2(buf,buf_size,sum,4,'n',0,0,'s');
 	    else if ( sum < 10000000 )
-		snprintf(buf,buf_size,"%4lluus",sum/1000);
+		StoreNumberUnit2(buf,buf_size,sum/1000,4,'u',0,0,'s');
 	    else
-		snprintf(buf,buf_size,"%4llums",sum/1000000);
+		StoreNumberUnit2(buf,buf_size,sum/1000000,4,'m',0,0,'s');
 	}
 	else if ( sec < 100 )
 	{
 	    if (nsec_valid )
-		snprintf(buf,buf_size,"%2llu.%02us",sec,nsec/10000000);
+		StoreNumberUnit2(buf,buf_size,sec,2,'.',nsec/10000000,2,'s');
 	    else
-		snprintf(buf,buf_size,"%5llus",sec);
+		StoreNumberUnit(buf,buf_size,sec,false,5,'s');
 	}
 	else if ( sec < 100*60 )
-	    snprintf(buf,buf_size,"%2llum%02llus",sec/60,sec%60);
+	    StoreNumberUnit2(buf,buf_size,sec/60,2,'m',sec%60,2,'s');
 	else if ( sec < 100*3600 )
-	    snprintf(buf,buf_size,"%2lluh%02llum",sec/3600,sec/60%60);
+	    StoreNumberUnit2(buf,buf_size,sec/3600,2,'h',sec/60%60,2,'m');
 	else
 	{
 	    const u64 days = sec / (24*3600);
 	    if ( days < 100 )
-		snprintf(buf,buf_size,"%2llud%02lluh",days,sec/3600%24);
+		StoreNumberUnit2(buf,buf_size,days,2,'d',sec/3600%24,2,'h');
 	    else if ( days < 7000 )
-		snprintf(buf,buf_size,"%3lluw%llud",days/7,days%7);
+		StoreNumberUnit2(buf,buf_size,days/7,3,'w',days%7,1,'d');
 	    else
 	    {
 		const u32 years = days / 365;
 		if ( years < 100 )
-		    snprintf(buf,buf_size,"%2uy%02lluw",years,days%365/7);
+		    StoreNumberUnit2(buf,buf_size,years,2,'y',days%365/7,2,'w');
 		else if ( years < 100000 )
-		    snprintf(buf,buf_size,"%5uy",years);
+		    StoreNumberUnit(buf,buf_size,years,false,5,'y');
 		else
 		    buf = "******";
 	    }
@@ -3793,11 +5604,11 @@ ccp PrintTimer6N
 	    if (!sum)
 		StringCopyS(buf,buf_size,"0");
 	    else if ( sum < 10000 )
-		snprintf(buf,buf_size,"%lluns",sum);
+		StoreNumberUnit2(buf,buf_size,sum,0,'n',0,0,'s');
 	    else if ( sum < 10000000 )
-		snprintf(buf,buf_size,"%lluus",sum/1000);
+		StoreNumberUnit2(buf,buf_size,sum/1000,0,'u',0,0,'s');
 	    else
-		snprintf(buf,buf_size,"%llums",sum/1000000);
+		StoreNumberUnit2(buf,buf_size,sum/1000000,0,'m',0,0,'s');
 	}
 	else if ( sec < 100 )
 	{
@@ -3805,28 +5616,28 @@ ccp PrintTimer6N
 	    {
 		const uint val2 = nsec/10000000;
 		if (val2)
-		    snprintf(buf,buf_size,"%llu.%02us",sec,val2);
+		    StoreNumberUnit2(buf,buf_size,sec,0,'.',val2,2,'s');
 		else
-		    snprintf(buf,buf_size,"%llus",sec);
+		    StoreNumberUnit(buf,buf_size,sec,false,0,'s');
 	    }
 	    else
-		snprintf(buf,buf_size,"%llus",sec);
+		StoreNumberUnit(buf,buf_size,sec,false,0,'s');
 	}
 	else if ( sec < 100*60 )
 	{
 	    const uint val2 = sec%60;
 	    if (val2)
-		snprintf(buf,buf_size,"%llum%02us",sec/60,val2);
+		StoreNumberUnit2(buf,buf_size,sec/60,0,'m',val2,2,'s');
 	    else
-		snprintf(buf,buf_size,"%llum",sec/60);
+		StoreNumberUnit(buf,buf_size,sec/60,false,0,'m');
 	}
 	else if ( sec < 100*3600 )
 	{
 	    const uint val2 = sec/60%60;
 	    if (val2)
-		snprintf(buf,buf_size,"%lluh%02um",sec/3600,val2);
+		StoreNumberUnit2(buf,buf_size,sec/3600,0,'h',val2,2,'m');
 	    else
-		snprintf(buf,buf_size,"%lluh",sec/3600);
+		StoreNumberUnit(buf,buf_size,sec/3600,false,0,'h');
 	}
 	else
 	{
@@ -3835,17 +5646,17 @@ ccp PrintTimer6N
 	    {
 		const uint val2 = sec/3600%24;
 		if (val2)
-		    snprintf(buf,buf_size,"%llud%02uh",days,val2);
+		    StoreNumberUnit2(buf,buf_size,days,0,'d',val2,2,'h');
 		else
-		    snprintf(buf,buf_size,"%llud",days);
+		    StoreNumberUnit(buf,buf_size,days,false,0,'d');
 	    }
 	    else if ( days < 7000 )
 	    {
 		const uint val2 = days%7;
 		if (val2)
-		    snprintf(buf,buf_size,"%lluw%ud",days/7,val2);
+		    StoreNumberUnit2(buf,buf_size,days/7,0,'w',val2,1,'d');
 		else
-		    snprintf(buf,buf_size,"%lluw",days/7);
+		    StoreNumberUnit(buf,buf_size,days/7,false,0,'w');
 	    }
 	    else
 	    {
@@ -3854,12 +5665,12 @@ ccp PrintTimer6N
 		{
 		    const uint val2 = days%365/7;
 		    if (val2)
-			snprintf(buf,buf_size,"%uy%02uw",years,val2);
+			StoreNumberUnit2(buf,buf_size,years,0,'y',val2,2,'w');
 		    else
-			snprintf(buf,buf_size,"%uy",years);
+			StoreNumberUnit(buf,buf_size,years,false,0,'y');
 		}
 		else if ( years < 100000 )
-		    snprintf(buf,buf_size,"%uy",years);
+		    StoreNumberUnit(buf,buf_size,years,false,0,'y');
 		else
 		    buf = "******";
 	    }
@@ -4507,104 +6318,552 @@ ccp month2text
 		month%12 + 1 );
 }
 
-///////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////
-// quarter support
+///////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////
+// quarter support
+
+int time2quarter ( time_t tim )
+{
+    struct tm tm;
+    gmtime_r(&tim,&tm);
+    return ( tm.tm_mon/3 + 4 * tm.tm_year ) - 101*4;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+time_t quarter2time ( int quarter )
+{
+    SetupTimezone(false);
+    struct tm tm = {0};
+
+    tm.tm_isdst	= -1;
+    tm.tm_year	= quarter / 4 + 101;
+    tm.tm_mon	= quarter % 4 * 3;
+    tm.tm_mday	= 1;
+
+    int delta = 43200-timezone_adjust_sec;
+    if ( delta < 0 )
+    {
+	delta += 86400;
+	tm.tm_mday++;
+    }
+
+    tm.tm_hour	= delta / 3600;
+    tm.tm_min	= delta / 60 % 60;
+    return mktime(&tm) / 86400 * 86400;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+ccp quarter2text
+(
+	int quarter,	// quarter to print
+	int fw,		// wanted field width assuming separators are 1 char
+	ccp sep_date,	// NULL or separator within date
+			// if NULL: use 'q'
+	ccp sep_dt	// ignored
+)
+{
+    quarter += 2001*4;
+    return PrintCircBuf("%4d%s%u",
+		quarter/4,
+		sep_date ? sep_date : "q",
+		quarter%4 + 1 );
+}
+
+///////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////
+// year support
+
+int time2year ( time_t tim )
+{
+    struct tm tm;
+    gmtime_r(&tim,&tm);
+    return tm.tm_year + 1900;
+}
+
+///////////////////////////////////////////////////////////////////////////
+
+time_t year2time ( int year )
+{
+    SetupTimezone(false);
+    struct tm tm = {0};
+
+    tm.tm_isdst	= -1;
+    tm.tm_year	= year - 1900;
+    tm.tm_mday	= 1;
+
+    int delta = 43200-timezone_adjust_sec;
+    if ( delta < 0 )
+    {
+	delta += 86400;
+	tm.tm_mday++;
+    }
+
+    tm.tm_hour	= delta / 3600;
+    tm.tm_min	= delta / 60 % 60;
+    return mktime(&tm) / 86400 * 86400;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			usage counter			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+int usage_count_enabled = 0;
+
+void EnableUsageCount()
+{
+    usage_count_enabled++;
+    UpdateUsageByMgr(0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// [[UsageShard_t]]
+// Each thread records into its own shard of a counter, so the hot path
+// is lock-free and doesn't share cache lines with other threads. The
+// shards are aggregated by UpdateUsageCount() and UpdateUsageDuration().
+// Shards are assigned to thread slots instead of threads. The slot of a
+// terminated thread and its shards are reused by the next new thread.
+
+typedef struct UsageShard_t
+{
+    struct UsageShard_t	*next;		// next shard of the same counter
+    u32			thread_slot;	// owner thread, see GetUsageThreadSlot()
+
+    //--- written by the owner thread
+
+    u64			count;		// number of events, only increasing
+    u_nsec_t		total_nsec;	// total waiting time, only increasing
+    u_nsec_t		top_nsec;	// top waiting time, reset by aggregation
+    u64			*histo;		// NULL or 2*USAGE_HISTO_BUCKETS elements:
+					// counters and their aggregated parts
+
+    //--- written by the aggregation
+
+    u64			done_count;	// already aggregated part of 'count'
+    u_nsec_t		done_nsec;	// already aggregated part of 'total_nsec'
+}
+UsageShard_t;
+
+//-----------------------------------------------------------------------------
+// [[UsageShardList_t]]
+// The shard list of a counter. A new list is fully set up and then
+// published by a single CAS of 'UsageParam_t.shard_list'. The heads are
+// never freed, but reused by a pool, so that a copy of a counter can
+// always check 'owner', even if the original was released. The list
+// owns the histograms of a UsageDuration_t too, see DetachUsageHisto().
+
+typedef struct UsageShardList_t
+{
+    const UsageParam_t		*owner;		// NULL or counter of this list
+    u32				id;		// unique ID, never reused
+    UsageShard_t		*first;		// NULL or first shard
+    UsageHisto_t		*histo;		// NULL or 'UsageDuration_t.histo'
+    struct UsageShardList_t	*next_free;	// next head of the pool
+}
+UsageShardList_t;
+
+static pthread_mutex_t usage_list_mutex = PTHREAD_MUTEX_INITIALIZER;
+static UsageShardList_t *usage_list_pool = 0;
+static u32 usage_list_id = 0;
+
+//-----------------------------------------------------------------------------
+
+static UsageShardList_t * NewUsageShardList ( const UsageParam_t *par )
+{
+    pthread_mutex_lock(&usage_list_mutex);
+    UsageShardList_t *list = usage_list_pool;
+    if (list)
+	usage_list_pool = list->next_free;
+    pthread_mutex_unlock(&usage_list_mutex);
+
+    if (!list)
+	list = CALLOC(1,sizeof(*list));
+    list->first = 0;
+    list->histo = 0;
+    list->next_free = 0;
+
+    u32 id;
+    do
+	id = __atomic_add_fetch(&usage_list_id,1,__ATOMIC_RELAXED);
+    while (!id);
+    __atomic_store_n(&list->id,id,__ATOMIC_RELAXED);
+    __atomic_store_n(&list->owner,par,__ATOMIC_RELEASE);
+    return list;
+}
+
+//-----------------------------------------------------------------------------
+
+static void FreeUsageShardList ( UsageShardList_t *list )
+{
+    DASSERT(list);
+
+    __atomic_store_n(&list->owner,0,__ATOMIC_RELEASE);
+    pthread_mutex_lock(&usage_list_mutex);
+    list->next_free = usage_list_pool;
+    usage_list_pool = list;
+    pthread_mutex_unlock(&usage_list_mutex);
+}
+
+//-----------------------------------------------------------------------------
+
+static inline UsageShardList_t * GetOwnUsageShardList ( const UsageParam_t *par )
+{
+    // returns NULL, if 'par' has no list of its own (new, cleared or a copy)
+
+    DASSERT(par);
+    UsageShardList_t *list = __atomic_load_n(&par->shard_list,__ATOMIC_ACQUIRE);
+    return list && __atomic_load_n(&list->owner,__ATOMIC_ACQUIRE) == par ? list : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static UsageShardList_t * GetUsageShardList ( UsageParam_t *par )
+{
+    // Returns the shard list of 'par' and creates a new list, if 'par' is
+    // new, was cleared by memset() or is a copy of another counter.
+    // No thread waits: if another thread publishes first, its list is used.
+
+    DASSERT(par);
+
+    UsageShardList_t *list = __atomic_load_n(&par->shard_list,__ATOMIC_ACQUIRE);
+    for(;;)
+    {
+	if ( list && __atomic_load_n(&list->owner,__ATOMIC_ACQUIRE) == par )
+	    return list;
+
+	// a copy shares the list of the original => replace it only
+	UsageShardList_t *new_list = NewUsageShardList(par);
+	if (__atomic_compare_exchange_n(&par->shard_list,&list,new_list,
+				false,__ATOMIC_ACQ_REL,__ATOMIC_ACQUIRE) )
+	    return new_list;
+	FreeUsageShardList(new_list);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Thread slots: 0 = not assigned, else slot+1. Slots below
+// USAGE_THREAD_SLOTS are released by a TLS destructor on thread exit.
+
+#define USAGE_THREAD_SLOTS 4096	// number of reusable thread slots
+
+static u64 usage_thread_used[USAGE_THREAD_SLOTS/64];
+static u32 usage_thread_extra = USAGE_THREAD_SLOTS;
+static pthread_key_t usage_thread_key;
+static pthread_once_t usage_thread_once = PTHREAD_ONCE_INIT;
+static __thread u32 usage_thread_slot;
+
+//-----------------------------------------------------------------------------
+
+#define USAGE_SHARD_CACHE 16	// number of cached shards per thread, power of 2
+
+typedef struct UsageShardCache_t
+{
+    const UsageParam_t	*par;		// key
+    u32			list_id;	// valid, if equal to the ID of the list
+    UsageShard_t	*shard;		// shard of 'par' for the current thread
+}
+UsageShardCache_t;
+
+static __thread UsageShardCache_t usage_shard_cache[USAGE_SHARD_CACHE];
+
+//-----------------------------------------------------------------------------
+
+static void ReleaseUsageThreadSlot ( void *arg )
+{
+    // TLS destructor: the next new thread takes over the slot and its shards
+
+    const u32 slot = (uintptr_t)arg - 1;
+    memset(usage_shard_cache,0,sizeof(usage_shard_cache));
+    usage_thread_slot = 0;
+    if ( slot < USAGE_THREAD_SLOTS )
+	__atomic_fetch_and( usage_thread_used + slot/64,
+				~( 1ull << slot%64 ), __ATOMIC_RELEASE );
+}
+
+//-----------------------------------------------------------------------------
+
+static void CreateUsageThreadKey(void)
+{
+    pthread_key_create(&usage_thread_key,ReleaseUsageThreadSlot);
+}
+
+//-----------------------------------------------------------------------------
+
+static u32 GetUsageThreadSlot(void)
+{
+    // returns the slot of the current thread +1
+
+    if (usage_thread_slot)
+	return usage_thread_slot;
+
+    pthread_once(&usage_thread_once,CreateUsageThreadKey);
+
+    u32 slot;
+    for ( uint i = 0; i < USAGE_THREAD_SLOTS/64; i++ )
+    {
+	u64 used = __atomic_load_n(usage_thread_used+i,__ATOMIC_RELAXED);
+	while ( ~used )
+	{
+	    const u64 bit = ~used & ( used + 1 );
+	    if (__atomic_compare_exchange_n(usage_thread_used+i,&used,used|bit,
+				true,__ATOMIC_ACQUIRE,__ATOMIC_RELAXED) )
+	    {
+		slot = i*64 + __builtin_ctzll(bit);
+		goto found;
+	    }
+	}
+    }
+
+    // all slots used => use a slot, that is never reused
+    slot = __atomic_fetch_add(&usage_thread_extra,1,__ATOMIC_RELAXED);
+
+ found:
+    usage_thread_slot = slot + 1;
+    pthread_setspecific(usage_thread_key,(void*)(uintptr_t)usage_thread_slot);
+    return usage_thread_slot;
+}
+
+//-----------------------------------------------------------------------------
+
+static UsageShard_t * GetUsageShard ( UsageParam_t *par )
+{
+    DASSERT(par);
+
+    UsageShardCache_t *cache = usage_shard_cache
+	+ ( ( (uintptr_t)par >> 4 ) * 0x9e3779b1u >> 24 & USAGE_SHARD_CACHE-1 );
+    const UsageShardList_t *cur = __atomic_load_n(&par->shard_list,__ATOMIC_ACQUIRE);
+    if ( cache->par == par && cur
+	&& cache->list_id == __atomic_load_n(&cur->id,__ATOMIC_RELAXED) )
+    {
+	return cache->shard;
+    }
+
+    UsageShardList_t *list = GetUsageShardList(par);
+    const u32 thread_slot = GetUsageThreadSlot();
+    UsageShard_t *shard = __atomic_load_n(&list->first,__ATOMIC_ACQUIRE);
+    while ( shard && shard->thread_slot != thread_slot )
+	shard = shard->next;
+
+    if (!shard)
+    {
+	// first event of this slot => insert a new shard
+	shard = CALLOC(1,sizeof(*shard));
+	shard->thread_slot = thread_slot;
+	shard->next = __atomic_load_n(&list->first,__ATOMIC_ACQUIRE);
+	while (!__atomic_compare_exchange_n(&list->first,&shard->next,shard,
+				true,__ATOMIC_RELEASE,__ATOMIC_ACQUIRE) )
+	    ;
+    }
+
+    cache->par		= par;
+    cache->list_id	= list->id;
+    cache->shard	= shard;
+    return shard;
+}
+
+//-----------------------------------------------------------------------------
+
+static UsageShard_t * RecordUsage
+	( UsageParam_t *par, u64 add, u_nsec_t wait_nsec, u_nsec_t top_nsec )
+{
+    // returns the shard of the current thread
+
+    DASSERT(par);
+
+    UsageShard_t *shard = GetUsageShard(par);
+    __atomic_store_n( &shard->count, shard->count + add, __ATOMIC_RELAXED );
+    if (wait_nsec)
+	__atomic_store_n( &shard->total_nsec, shard->total_nsec + wait_nsec,
+				__ATOMIC_RELAXED );
+    if ( top_nsec > __atomic_load_n(&shard->top_nsec,__ATOMIC_RELAXED) )
+	__atomic_store_n( &shard->top_nsec, top_nsec, __ATOMIC_RELAXED );
+
+    // Read before write to keep the shared cache line clean. 'par->dirty'
+    // is not touched: it is written only by the updating thread, and
+    // not yet aggregated events are found by IsUsageDirty().
+    if (!__atomic_load_n(&par->is_active,__ATOMIC_RELAXED))
+	__atomic_store_n(&par->is_active,true,__ATOMIC_RELAXED);
+    return shard;
+}
+
+//-----------------------------------------------------------------------------
+
+static void RecordUsageHisto ( UsageShard_t *shard, u_nsec_t nsec, u64 count )
+{
+    DASSERT(shard);
+
+    u64 *histo = shard->histo;
+    if (!histo)
+    {
+	histo = CALLOC(2*USAGE_HISTO_BUCKETS,sizeof(*histo));
+	__atomic_store_n(&shard->histo,histo,__ATOMIC_RELEASE);
+    }
+
+    histo += GetUsageHistoIndex(nsec);
+    __atomic_store_n( histo, *histo + count, __ATOMIC_RELAXED );
+}
+
+//-----------------------------------------------------------------------------
+
+static void AggregateUsageShards
+(
+    // add the not yet aggregated values of all shards
+
+    UsageParam_t	*par,		// valid parameters
+    u64			*count,		// valid pointer: add count
+    u_nsec_t		*total_nsec,	// NULL or add total waiting time
+    u_nsec_t		*top_nsec,	// NULL or update top waiting time
+    UsageHisto_t	*histo		// NULL or add histogram
+)
+{
+    DASSERT(par);
+    DASSERT(count);
+
+    const UsageShardList_t *list = GetOwnUsageShardList(par);
+    if (!list)
+	return;
+
+    UsageShard_t *shard = __atomic_load_n(&list->first,__ATOMIC_ACQUIRE);
+    for ( ; shard; shard = shard->next )
+    {
+	const u64 cnt = __atomic_load_n(&shard->count,__ATOMIC_RELAXED);
+	*count += cnt - shard->done_count;
+	__atomic_store_n(&shard->done_count,cnt,__ATOMIC_RELAXED);
+
+	const u_nsec_t total = __atomic_load_n(&shard->total_nsec,__ATOMIC_RELAXED);
+	if (total_nsec)
+	    *total_nsec += total - shard->done_nsec;
+	shard->done_nsec = total;
+
+	if (top_nsec)
+	{
+	    const u_nsec_t top = __atomic_exchange_n(&shard->top_nsec,0,__ATOMIC_RELAXED);
+	    if ( *top_nsec < top )
+		 *top_nsec = top;
+	}
+
+	u64 *sh = __atomic_load_n(&shard->histo,__ATOMIC_ACQUIRE);
+	if (sh)
+	{
+	    u64 *done = sh + USAGE_HISTO_BUCKETS;
+	    for ( uint i = 0; i < USAGE_HISTO_BUCKETS; i++ )
+	    {
+		const u64 cnt = __atomic_load_n(sh+i,__ATOMIC_RELAXED);
+		if (histo)
+		    histo->count[i] += cnt - done[i];
+		done[i] = cnt;
+	    }
+	}
+    }
+}
+
+//-----------------------------------------------------------------------------
 
-int time2quarter ( time_t tim )
+static inline void DiscardUsageShards ( UsageParam_t *par )
 {
-    struct tm tm;
-    gmtime_r(&tim,&tm);
-    return ( tm.tm_mon/3 + 4 * tm.tm_year ) - 101*4;
+    u64 count = 0;
+    u_nsec_t top_nsec = 0;
+    AggregateUsageShards(par,&count,0,&top_nsec,0);
 }
 
-///////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
 
-time_t quarter2time ( int quarter )
+static inline void KeepUsageShards ( UsageParam_t *dest, const UsageParam_t *src )
 {
-    SetupTimezone(false);
-    struct tm tm = {0};
+    // restore the shard list after a memset()
+    dest->shard_list = src->shard_list;
+}
 
-    tm.tm_isdst	= -1;
-    tm.tm_year	= quarter / 4 + 101;
-    tm.tm_mon	= quarter % 4 * 3;
-    tm.tm_mday	= 1;
+//-----------------------------------------------------------------------------
 
-    int delta = 43200-timezone_adjust_sec;
-    if ( delta < 0 )
+void ReleaseUsageShards ( UsageParam_t *par )
+{
+    DASSERT(par);
+
+    // the list of a copy belongs to the original => don't free it
+    UsageShardList_t *list = GetOwnUsageShardList(par);
+    __atomic_store_n(&par->shard_list,0,__ATOMIC_RELEASE);
+    if (list)
     {
-	delta += 86400;
-	tm.tm_mday++;
+	UsageShard_t *shard = list->first;
+	while (shard)
+	{
+	    UsageShard_t *next = shard->next;
+	    FREE(shard->histo);
+	    FREE(shard);
+	    shard = next;
+	}
+	FREE(list->histo);
+	list->histo = 0;
+	FreeUsageShardList(list);
     }
-
-    tm.tm_hour	= delta / 3600;
-    tm.tm_min	= delta / 60 % 60;
-    return mktime(&tm) / 86400 * 86400;
 }
 
-///////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
 
-ccp quarter2text
-(
-	int quarter,	// quarter to print
-	int fw,		// wanted field width assuming separators are 1 char
-	ccp sep_date,	// NULL or separator within date
-			// if NULL: use 'q'
-	ccp sep_dt	// ignored
-)
+static void DetachUsageHisto ( UsageDuration_t *ud )
 {
-    quarter += 2001*4;
-    return PrintCircBuf("%4d%s%u",
-		quarter/4,
-		sep_date ? sep_date : "q",
-		quarter%4 + 1 );
+    // A copy of a counter shares 'histo' with the original, but not the
+    // shard list. It is detected like in GetUsageShardList() and gets new
+    // empty histograms, so that the histograms of the original are never
+    // written or freed twice. Only the pointer of the original is compared.
+
+    DASSERT(ud);
+    if (ud->histo)
+    {
+	const UsageShardList_t *list = GetOwnUsageShardList(&ud->par);
+	if ( !list || list->histo != ud->histo )
+	{
+	    ud->histo = 0;
+	    EnableUsageDurationHisto(ud);
+	}
+    }
 }
 
-///////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////
-// year support
+//-----------------------------------------------------------------------------
 
-int time2year ( time_t tim )
+static inline bool LockUsage ( UsageParam_t *par )
 {
-    struct tm tm;
-    gmtime_r(&tim,&tm);
-    return tm.tm_year + 1900;
+    // returns false, if another thread is updating => don't wait
+    return !__atomic_exchange_n(&par->busy,true,__ATOMIC_ACQUIRE);
 }
 
-///////////////////////////////////////////////////////////////////////////
-
-time_t year2time ( int year )
+static inline void UnlockUsage ( UsageParam_t *par )
 {
-    SetupTimezone(false);
-    struct tm tm = {0};
-
-    tm.tm_isdst	= -1;
-    tm.tm_year	= year - 1900;
-    tm.tm_mday	= 1;
+    __atomic_store_n(&par->busy,false,__ATOMIC_RELEASE);
+}
 
-    int delta = 43200-timezone_adjust_sec;
-    if ( delta < 0 )
-    {
-	delta += 86400;
-	tm.tm_mday++;
-    }
+//-----------------------------------------------------------------------------
 
-    tm.tm_hour	= delta / 3600;
-    tm.tm_min	= delta / 60 % 60;
-    return mktime(&tm) / 86400 * 86400;
+static inline bool IsUsageUpdateDue ( const UsageParam_t *par, u_nsec_t now_nsec )
+{
+    return now_nsec >= __atomic_load_n(&par->update_nsec,__ATOMIC_RELAXED);
 }
 
-//
-///////////////////////////////////////////////////////////////////////////////
-///////////////			usage counter			///////////////
-///////////////////////////////////////////////////////////////////////////////
-
-int usage_count_enabled = 0;
+//-----------------------------------------------------------------------------
 
-void EnableUsageCount()
+static bool IsUsageDirty ( const UsageParam_t *par )
 {
-    usage_count_enabled++;
-    UpdateUsageByMgr(0);
+    // true, if the record or a shard has values, that are not yet updated
+
+    DASSERT(par);
+    if (par->dirty)
+	return true;
+
+    const UsageShardList_t *list = GetOwnUsageShardList(par);
+    if (!list)
+	return false;
+
+    const UsageShard_t *shard = __atomic_load_n(&list->first,__ATOMIC_ACQUIRE);
+    for ( ; shard; shard = shard->next )
+	if (  __atomic_load_n(&shard->count,__ATOMIC_RELAXED)
+	   != __atomic_load_n(&shard->done_count,__ATOMIC_RELAXED) )
+	{
+	    return true;
+	}
+    return false;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4642,9 +6901,11 @@ void ClearUsageCount ( UsageCount_t *uc, int count )
     uc->par.used = index;
     if (!index)
     {
-	const bool enabled = uc->par.enabled;
+	DiscardUsageShards(&uc->par);
+	const UsageParam_t par = uc->par;
 	memset( uc, 0, sizeof(*uc) );
-	uc->par.enabled = enabled;
+	uc->par.enabled = par.enabled;
+	KeepUsageShards(&uc->par,&par);
     }
     else
     {
@@ -4656,19 +6917,21 @@ void ClearUsageCount ( UsageCount_t *uc, int count )
 ///////////////////////////////////////////////////////////////////////////////
 // [[UpdateUsageCount]]
 
-void UpdateUsageCount ( UsageCount_t *uc, u_nsec_t timer_nsec )
+static void UpdateUsageCountLocked ( UsageCount_t *uc, u_nsec_t timer_nsec )
 {
-    if (!uc)
-	return;
+    DASSERT(uc);
 
     if ( !uc->par.enabled || usage_count_enabled <= 0 )
     {
+	DiscardUsageShards(&uc->par);
 	uc->ref.elapsed_nsec = 0;
 	uc->ref.count = 0;
 	uc->par.dirty = false;
 	return;
     }
 
+    AggregateUsageShards(&uc->par,&uc->ref.count,0,0,0);
+
     if ( !uc->par.is_active )
     {
 	if ( !uc->par.used && !uc->ref.count )
@@ -4752,6 +7015,11 @@ void UpdateUsageCount ( UsageCount_t *uc, u_nsec_t timer_nsec )
 		e->top5s = (double)( NSEC_PER_SEC * count5 ) / elapsed5;
 	    }
 	}
+	else
+	{
+	    // first record: keep the events of the shards
+	    cur.count = uc->ref.count;
+	}
 
 	uc->ref = cur;
 	uc->par.update_nsec = uc->ref.elapsed_nsec + NSEC_PER_SEC;
@@ -4761,34 +7029,37 @@ void UpdateUsageCount ( UsageCount_t *uc, u_nsec_t timer_nsec )
     uc->par.dirty = uc->ref.count > 0;
 }
 
-///////////////////////////////////////////////////////////////////////////////
+//-----------------------------------------------------------------------------
 
-void UpdateUsageCountIncrement ( UsageCount_t *uc )
+void UpdateUsageCount ( UsageCount_t *uc, u_nsec_t timer_nsec )
 {
-    DASSERT(uc);
-    uc->par.is_active = true;
-    UpdateUsageCount(uc,0);
-    if ( usage_count_enabled > 0 )
+    if ( uc && LockUsage(&uc->par) )
     {
-	uc->ref.count++;
-	uc->par.dirty = true;
+	UpdateUsageCountLocked(uc,timer_nsec);
+	UnlockUsage(&uc->par);
     }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void UpdateUsageCountIncrement ( UsageCount_t *uc )
+{
+    UpdateUsageCountAdd(uc,1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void UpdateUsageCountAdd ( UsageCount_t *uc, int add )
 {
     DASSERT(uc);
     if ( add > 0 )
     {
-	uc->par.is_active = true;
-	UpdateUsageCount(uc,0);
 	if ( usage_count_enabled > 0 )
-	{
-	    uc->ref.count += add;
-	    uc->par.dirty = true;
-	}
+	    RecordUsage(&uc->par,add,0,0);
+
+	const u_nsec_t now_nsec = GetTimerNSec();
+	if (IsUsageUpdateDue(&uc->par,now_nsec))
+	    UpdateUsageCount(uc,now_nsec);
     }
 }
 
@@ -4849,12 +7120,12 @@ u_nsec_t MaintainUsageByMgr ( u_nsec_t now_nsec )
 	const UsageParam_t *par = GetUsageParam(uci);
 	if (par)
 	{
-	    if ( par->dirty && par->update_nsec && par->update_nsec <= now_nsec
+	    if ( par->update_nsec && par->update_nsec <= now_nsec && IsUsageDirty(par)
 		|| par->force_update_nsec && par->force_update_nsec <= now_nsec )
 	    {
 		UpdateByUCI(uci,now_nsec);
 	    }
-	    if ( par->dirty && par->update_nsec && next_nsec > par->update_nsec )
+	    if ( par->update_nsec && next_nsec > par->update_nsec && IsUsageDirty(par) )
 		next_nsec = par->update_nsec;
 	}
     }
@@ -4930,6 +7201,42 @@ void AddToUsageMgr ( const UsageCtrl_t *uci )
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// The histograms of the entries are stored as '<prefix>h<index>-histo'.
+// Only used entries are saved, missing records restore as empty.
+
+static void SaveUsageHisto
+	( FILE *f, const UsageDuration_t *ud, ccp prefix, uint fw_name )
+{
+    DASSERT(f);
+    DASSERT(ud);
+    DASSERT(prefix);
+
+    char name[100];
+    for ( int i = 0; i < ud->par.used; i++ )
+    {
+	snprintf(name,sizeof(name),"%sh%02u-",prefix,i);
+	SaveCurrentStateByTable(f,ud->histo+1+i,SRT_UsageHisto,name,fw_name);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void RestoreUsageHisto
+	( RestoreState_t *rs, UsageDuration_t *ud, ccp prefix )
+{
+    DASSERT(rs);
+    DASSERT(ud);
+    DASSERT(prefix);
+
+    char name[100];
+    for ( int i = 0; i < ud->par.used; i++ )
+    {
+	snprintf(name,sizeof(name),"%sh%02u-",prefix,i);
+	RestoreStateByTable(rs,ud->histo+1+i,SRT_UsageHisto,name);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void SaveCurrentStateByUsageCountMgr ( FILE *f, uint fw_name )
@@ -4948,7 +7255,11 @@ void SaveCurrentStateByUsageCountMgr ( FILE *f, uint fw_name )
 		if (uci->uc)
 		    SaveCurrentStateByTable(f,uci->uc,SRT_UsageCount,uci->srt_prefix,fw_name);
 		else if (uci->ud)
+		{
 		    SaveCurrentStateByTable(f,uci->ud,SRT_UsageDuration,uci->srt_prefix,fw_name);
+		    if (uci->ud->histo)
+			SaveUsageHisto(f,uci->ud,uci->srt_prefix,fw_name);
+		}
 	    }
 	}
     }
@@ -4988,6 +7299,15 @@ void RestoreStateByUsageCountMgr ( RestoreState_t *rs )
 		// needed for the case that USAGE_COUNT_ENTRIES was reduced after restart!
 		if ( ud->par.used > USAGE_COUNT_ENTRIES )
 		     ud->par.used = USAGE_COUNT_ENTRIES;
+
+		DetachUsageHisto(ud);
+		if (ud->histo)
+		{
+		    if (uci->srt_load)
+			RestoreUsageHisto(rs,ud,uci->srt_load);
+		    if (uci->srt_prefix)
+			RestoreUsageHisto(rs,ud,uci->srt_prefix);
+		}
 	    }
 	}
     }
@@ -4998,6 +7318,112 @@ void RestoreStateByUsageCountMgr ( RestoreState_t *rs )
 ///////////////			wait counter			///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////////////////
+// [[UsageHisto_t]]
+
+#define HISTO_LINEAR ( 2u << USAGE_HISTO_SUB_BITS ) // values with exact buckets
+
+uint GetUsageHistoIndex ( u_nsec_t nsec )
+{
+    if ( nsec < HISTO_LINEAR )
+	return nsec;
+    if ( nsec >> USAGE_HISTO_MAX_BITS )
+	return USAGE_HISTO_BUCKETS - 1;
+
+    // EXP >= SUB_BITS+1, the top SUB_BITS+1 bits select the bucket
+    const uint exp = 63 - __builtin_clzll(nsec);
+    return ( exp - USAGE_HISTO_SUB_BITS << USAGE_HISTO_SUB_BITS )
+		+ ( nsec >> exp - USAGE_HISTO_SUB_BITS );
+}
+
+//-----------------------------------------------------------------------------
+
+u_nsec_t GetUsageHistoMaxValue ( uint index )
+{
+    if ( index < HISTO_LINEAR )
+	return index;
+    if ( index >= USAGE_HISTO_BUCKETS )
+	index = USAGE_HISTO_BUCKETS - 1;
+
+    const uint shift = ( index >> USAGE_HISTO_SUB_BITS ) - 1;
+    const u_nsec_t mant = index & ( HISTO_LINEAR/2 - 1 ) | HISTO_LINEAR/2;
+    return ( mant + 1 << shift ) - 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void AddUsageHistoValue ( UsageHisto_t *uh, u_nsec_t nsec, u64 count )
+{
+    DASSERT(uh);
+    uh->count[GetUsageHistoIndex(nsec)] += count;
+}
+
+//-----------------------------------------------------------------------------
+
+void AddUsageHisto ( UsageHisto_t *dest, const UsageHisto_t *add )
+{
+    DASSERT(dest);
+    DASSERT(add);
+    for ( uint i = 0; i < USAGE_HISTO_BUCKETS; i++ )
+	dest->count[i] += add->count[i];
+}
+
+//-----------------------------------------------------------------------------
+
+u64 GetUsageHistoCount ( const UsageHisto_t *uh )
+{
+    DASSERT(uh);
+    u64 sum = 0;
+    for ( uint i = 0; i < USAGE_HISTO_BUCKETS; i++ )
+	sum += uh->count[i];
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+
+u_nsec_t GetUsageHistoPercentile ( const UsageHisto_t *uh, double percent )
+{
+    DASSERT(uh);
+
+    const u64 total = GetUsageHistoCount(uh);
+    if (!total)
+	return 0;
+
+    // RANK is the 1-based rank of the requested event, rounded up
+    const double exact = total * percent / 100.0;
+    u64 rank = total;
+    if ( exact < total )
+    {
+	rank = exact > 0.0 ? (u64)exact : 0;
+	if ( rank < exact || !rank )
+	    rank++;
+    }
+
+    for ( uint i = 0; i < USAGE_HISTO_BUCKETS; i++ )
+    {
+	if ( uh->count[i] >= rank )
+	    return GetUsageHistoMaxValue(i);
+	rank -= uh->count[i];
+    }
+    return GetUsageHistoMaxValue(USAGE_HISTO_BUCKETS-1); // never reached
+}
+
+//-----------------------------------------------------------------------------
+
+const SaveRestoreTab_t SRT_UsageHisto[] =
+{
+    #undef SRT_NAME
+    #define SRT_NAME UsageHisto_t
+
+    DEF_SRT_UINT_A(	count,			"histo" ),
+
+    DEF_SRT_TERM()
+};
+
+#undef HISTO_LINEAR
+
+///////////////////////////////////////////////////////////////////////////////
+
 const SaveRestoreTab_t SRT_UsageDuration[] =
 {
     #undef SRT_NAME
@@ -5021,6 +7447,11 @@ const SaveRestoreTab_t SRT_UsageDuration[] =
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// number of histograms of 'ud': 'ref' + entries
+#define USAGE_HISTO_N(ud) ( 1 + sizeof((ud)->entry) / sizeof(*(ud)->entry) )
+
+//-----------------------------------------------------------------------------
+
 // n_rec<0: clear from end, n_rec>=0: clear from index
 void ClearUsageDuration ( UsageDuration_t *ud, int count )
 {
@@ -5031,17 +7462,27 @@ void ClearUsageDuration ( UsageDuration_t *ud, int count )
     if ( index >= ud->par.used - 1 )
 	return;
 
+    DetachUsageHisto(ud);
     ud->par.used = index;
     if (!index)
     {
-	const bool enabled = ud->par.enabled;
+	DiscardUsageShards(&ud->par);
+	const UsageParam_t par = ud->par;
+	UsageHisto_t *histo = ud->histo;
 	memset( ud, 0, sizeof(*ud) );
-	ud->par.enabled = enabled;
+	ud->par.enabled = par.enabled;
+	KeepUsageShards(&ud->par,&par);
+	ud->histo = histo;
+	if (histo)
+	    memset( histo, 0, USAGE_HISTO_N(ud) * sizeof(*histo) );
     }
     else
     {
 	UsageDurationEntry_t *e = ud->entry + index;
 	memset( e, 0, PTR_DISTANCE((u8*)ud->entry+sizeof(ud->entry),e) );
+	if (ud->histo)
+	    memset( ud->histo + 1 + index, 0,
+			( USAGE_HISTO_N(ud) - 1 - index ) * sizeof(*ud->histo) );
     }
 }
 
@@ -5049,19 +7490,25 @@ void ClearUsageDuration ( UsageDuration_t *ud, int count )
 // [[UpdateUsageDuration]]
 
 // TIMER_NSEC: 0 or GetTimerNSec(), but not GetTime*()
-void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
+static void UpdateUsageDurationLocked ( UsageDuration_t *ud, u_nsec_t timer_nsec )
 {
-    if (!ud)
-	return;
+    DASSERT(ud);
+    DetachUsageHisto(ud);
 
     if ( !ud->par.enabled || usage_count_enabled <= 0 )
     {
+	DiscardUsageShards(&ud->par);
+	if (ud->histo)
+	    memset(ud->histo,0,sizeof(*ud->histo));
 	ud->ref.elapsed_nsec = 0;
 	ud->ref.count = 0;
 	ud->par.dirty = false;
 	return;
     }
 
+    AggregateUsageShards(&ud->par,&ud->ref.count,&ud->ref.total_nsec,
+				&ud->ref.top_nsec,ud->histo);
+
     if ( !ud->par.is_active )
     {
 	if ( !ud->par.used && !ud->ref.count )
@@ -5100,6 +7547,8 @@ void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
 		    if ( e->elapsed_nsec < min )
 		    {
 			AddUsageDurationEntry(e,e-1);
+			if (ud->histo)
+			    AddUsageHisto(ud->histo+1+index,ud->histo+index);
 			index--;
 			break;
 		    }
@@ -5109,7 +7558,11 @@ void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
 	    }
 
 	    if ( index > 1 )
+	    {
 		memmove( ud->entry+1, ud->entry, (index-1) * sizeof(*ud->entry) );
+		if (ud->histo)
+		    memmove( ud->histo+2, ud->histo+1, (index-1) * sizeof(*ud->histo) );
+	    }
 
 	    if ( ud->par.used < index )
 		 ud->par.used = index;
@@ -5120,6 +7573,11 @@ void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
 	    UsageDurationEntry_t *e = ud->entry;
 	    *e = ud->ref;
 	    e->elapsed_nsec = cur.elapsed_nsec - e->elapsed_nsec;
+	    if (ud->histo)
+	    {
+		ud->histo[1] = ud->histo[0];
+		memset(ud->histo,0,sizeof(*ud->histo));
+	    }
 
 
 	    //--- update top value (1s)
@@ -5145,6 +7603,13 @@ void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
 		e->top_cnt_5s = (double)( NSEC_PER_SEC * count5 ) / elapsed5;
 	    }
 	}
+	else
+	{
+	    // first record: keep the events of the shards
+	    cur.count	   = ud->ref.count;
+	    cur.total_nsec = ud->ref.total_nsec;
+	    cur.top_nsec   = ud->ref.top_nsec;
+	}
 
 	ud->ref = cur;
 	ud->par.update_nsec = ud->ref.elapsed_nsec + NSEC_PER_SEC;
@@ -5154,71 +7619,110 @@ void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
     ud->par.dirty = ud->ref.count > 0;
 }
 
+//-----------------------------------------------------------------------------
+
+void UpdateUsageDuration ( UsageDuration_t *ud, u_nsec_t timer_nsec )
+{
+    if ( ud && LockUsage(&ud->par) )
+    {
+	UpdateUsageDurationLocked(ud,timer_nsec);
+	UnlockUsage(&ud->par);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void UpdateUsageDurationAdd
 	( UsageDuration_t *ud, int add, u_nsec_t wait_nsec, u_nsec_t top_nsec )
 {
     DASSERT(ud);
-    ud->par.is_active = true;
-    UpdateUsageDuration(ud,0);
-
     if ( add > 0 && usage_count_enabled > 0 )
     {
-	ud->par.dirty = true;
-	ud->ref.count += add;
-	ud->ref.total_nsec += wait_nsec;
-	if ( ud->ref.top_nsec < top_nsec )
-	     ud->ref.top_nsec = top_nsec;
+	UsageShard_t *shard = RecordUsage(&ud->par,add,wait_nsec,top_nsec);
+	if (ud->histo)
+	    RecordUsageHisto(shard,wait_nsec/add,add);
     }
+
+    const u_nsec_t now_nsec = GetTimerNSec();
+    if (IsUsageUpdateDue(&ud->par,now_nsec))
+	UpdateUsageDuration(ud,now_nsec);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void UpdateUsageDurationIncrement ( UsageDuration_t *ud, u_nsec_t wait_nsec )
+{
+    UpdateUsageDurationAdd(ud,1,wait_nsec,wait_nsec);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void UsageDurationIncrement ( UsageDuration_t *ud, u_nsec_t wait_nsec )
+{
+    DASSERT(ud);
+    if ( usage_count_enabled > 0 )
+    {
+	UsageShard_t *shard = RecordUsage(&ud->par,1,wait_nsec,wait_nsec);
+	if (ud->histo)
+	    RecordUsageHisto(shard,wait_nsec,1);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+UsageDurationEntry_t GetUsageDuration ( const UsageDuration_t *ud, s_nsec_t nsec )
+{
+    DASSERT(ud);
+    UsageDurationEntry_t res = {0};
+    const UsageDurationEntry_t *e = ud->entry;
+    for ( int i = 0; i < ud->par.used && nsec > 0; i++, e++ )
+    {
+	nsec -= e->elapsed_nsec;
+	AddUsageDurationEntry(&res,e);
+    }
+    return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void EnableUsageDurationHisto ( UsageDuration_t *ud )
 {
     DASSERT(ud);
-    ud->par.is_active = true;
-    UpdateUsageDuration(ud,0);
-    if ( usage_count_enabled > 0 )
-    {
-	ud->par.dirty = true;
-	ud->ref.count++;
-	ud->ref.total_nsec += wait_nsec;
-	if ( ud->ref.top_nsec < wait_nsec )
-	     ud->ref.top_nsec = wait_nsec;
-    }
+
+    // the histograms belong to the shard list => a copy gets its own
+    UsageShardList_t *list = GetUsageShardList(&ud->par);
+    if (!list->histo)
+	list->histo = CALLOC(USAGE_HISTO_N(ud),sizeof(*list->histo));
+    ud->histo = list->histo;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void UsageDurationIncrement ( UsageDuration_t *ud, u_nsec_t wait_nsec )
+void ReleaseUsageDuration ( UsageDuration_t *ud )
 {
     DASSERT(ud);
-    ud->par.is_active = true;
-    if ( usage_count_enabled > 0 )
-    {
-	ud->par.dirty = true;
-	ud->ref.count++;
-	ud->ref.total_nsec += wait_nsec;
-	if ( ud->ref.top_nsec < wait_nsec )
-	     ud->ref.top_nsec = wait_nsec;
-    }
+    ReleaseUsageShards(&ud->par);
+    ud->histo = 0;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
-UsageDurationEntry_t GetUsageDuration ( const UsageDuration_t *ud, s_nsec_t nsec )
+bool GetUsageDurationHisto
+	( UsageHisto_t *dest, const UsageDuration_t *ud, s_nsec_t nsec )
 {
+    DASSERT(dest);
     DASSERT(ud);
-    UsageDurationEntry_t res = {0};
+    memset(dest,0,sizeof(*dest));
+    if (!ud->histo)
+	return false;
+
     const UsageDurationEntry_t *e = ud->entry;
     for ( int i = 0; i < ud->par.used && nsec > 0; i++, e++ )
     {
 	nsec -= e->elapsed_nsec;
-	AddUsageDurationEntry(&res,e);
+	AddUsageHisto(dest,ud->histo+1+i);
     }
-    return res;
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5556,6 +8060,95 @@ void ListUsageCount
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+static void ListUsageHisto
+(
+    PrintMode_t		*pm,		// valid and setup print mode
+    const UsageCtrl_t	*uci,		// valid object to list
+    s_nsec_t		limit_nsec	// >0: limit output until # is reached
+)
+{
+    DASSERT(pm);
+    DASSERT(uci);
+    const UsageDuration_t *ud = uci->ud;
+    DASSERT(ud);
+    if ( !ud->histo || !ud->par.used )
+	return;
+
+    fprintf(pm->fout,
+	"%s%*s%s╔════════╦═════════╤════════╤════════╤════════╤════════╤════════╗%s"
+	"%s%*s%s║ range  ║ counter │  p50   │  p90   │  p99   │ p99.9  │  top   ║%s"
+	"%s%*s%s╠════════╬═════════╪════════╪════════╪════════╪════════╪════════╣%s%s"
+	,pm->prefix ,pm->indent,"" ,colout->heading ,pm->eol
+	,pm->prefix ,pm->indent,"" ,colout->heading ,pm->eol
+	,pm->prefix ,pm->indent,"" ,colout->heading ,colout->reset ,pm->eol
+	);
+
+    static const double percent[] = { 50.0, 90.0, 99.0, 99.9 };
+
+    UsageDurationEntry_t sum = {0};
+    UsageHisto_t sum_histo = {{0}};
+    const IntervalInfo_t *interval = interval_info;
+    const UsageDurationEntry_t *e = ud->entry;
+    for ( int i = 0; i < ud->par.used; i++, e++ )
+    {
+	AddUsageDurationEntry(&sum,e);
+	AddUsageHisto(&sum_histo,ud->histo+1+i);
+	bool is_last = false;
+	const bool is_limit = sum.elapsed_nsec >= limit_nsec;
+	if ( sum.elapsed_nsec < interval->nsec )
+	{
+	    is_last = i+1 == ud->par.used;
+	    if ( !is_last && !is_limit )
+		continue;
+	}
+
+	ccp name;
+	if ( is_last || sum.elapsed_nsec < interval->nsec )
+	    name = "*";
+	else
+	{
+	    while ( sum.elapsed_nsec > interval->nsec )
+		interval++;
+	    name = interval[-1].name;
+	}
+
+	fprintf(pm->fout,
+		"%s%*s%s║%s %-6.6s %s║%s %s %s│%s"
+		,pm->prefix ,pm->indent,""
+		,colout->heading, colout->reset
+		,name
+		,colout->heading, colout->reset
+		,PrintNumberU7(0,0,sum.count,DC_SFORM_ALIGN|DC_SFORM_DASH)
+		,colout->heading, colout->reset
+		);
+
+	for ( int p = 0; p < sizeof(percent)/sizeof(*percent); p++ )
+	{
+	    // the bucket maximum may exceed the real maximum
+	    u_nsec_t val = GetUsageHistoPercentile(&sum_histo,percent[p]);
+	    if ( val > sum.top_nsec )
+		val = sum.top_nsec;
+	    fprintf(pm->fout," %s %s│%s"
+		,print_usage_dur_val(val,uci->color_dur)
+		,colout->heading, colout->reset );
+	}
+
+	fprintf(pm->fout," %s %s║%s%s"
+		,print_usage_dur_val(sum.top_nsec,uci->color_dur)
+		,colout->heading, colout->reset, pm->eol );
+
+	if ( is_limit || !interval->name )
+	    break;
+    }
+
+    fprintf(pm->fout,
+	"%s%*s%s╚════════╩═════════╧════════╧════════╧════════╧════════╧════════╝%s%s"
+	,pm->prefix ,pm->indent,"" ,colout->heading ,colout->reset ,pm->eol );
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+
 void ListUsageDuration
 (
     PrintMode_t		*p_pm,		// NULL or print mode
@@ -5795,6 +8388,9 @@ void ListUsageDuration
 	"════════╧═════════╧═════════╧════════╝%s%s"
 	,colout->heading ,colout->reset ,pm.eol );
     }
+
+    if (ud->histo)
+	ListUsageHisto(&pm,uci,limit_nsec);
 }
 
 //
@@ -6458,30 +9054,109 @@ uint ReadFromUrandom ( void *dest, uint size )
     return buf - (u8*)dest;
 }
 
+//-----------------------------------------------------------------------------
+
+static size_t ReadFromUrandomLarge ( void *dest, size_t size )
+{
+    // like ReadFromUrandom(), but reads chunks of at most UINT_MAX bytes
+
+    u8 *buf = dest;
+    while ( size > 0 )
+    {
+	const uint chunk = size < UINT_MAX ? size : UINT_MAX;
+	const uint stat = ReadFromUrandom(buf,chunk);
+	buf  += stat;
+	size -= stat;
+	if ( stat < chunk )
+	    break;
+    }
+    return buf - (u8*)dest;
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			random numbers			///////////////
 ///////////////////////////////////////////////////////////////////////////////
+// Each thread has its own xoshiro256** generator (David Blackman and
+// Sebastiano Vigna, https://prng.di.unimi.it/). It is seeded on first use
+// from /dev/urandom (or by time, if not available) and by MySeed().
+// Bounded values are sampled without bias by Lemire's multiply-and-reject
+// method. Large fills run 4 independent generators in parallel, using
+// AVX2 if available. The output of all paths is the same.
 
-//------------------------------------------------------------------
-// Algorithm: The Art of Computer Programming, part II, section 3.6
-// by Donald E. Knuth
-//------------------------------------------------------------------
+typedef struct random_state_t
+{
+    u64  s[4];		// generator state, never all 0
+    bool seeded;	// true: state is initialized
+}
+random_state_t;
 
-const u32 RANDOM32_C_ADD = 2 * 197731421; // 2 Primzahlen
-const u32 RANDOM32_COUNT_BASE = 4294967; // Primzahl == ~UINT_MAX32/1000;
+static __thread random_state_t random_state;
 
-static int random32_a_index = -1;	// Index in die a-Tabelle
-static u32 random32_count = 1;		// Abwärts-Zähler bis zum Wechsel von a,c
-static u32 random32_a,
-	   random32_c,
-	   random32_X;			// Die letzten Werte
+///////////////////////////////////////////////////////////////////////////////
 
-static u32 random32_a_tab[] = // Init-Tabelle
+static inline u64 RotateLeft64 ( u64 val, uint shift )
 {
-    0xbb40e62d, 0x3dc8f2f5, 0xdc024635, 0x7a5b6c8d,
-    0x583feb95, 0x91e06dbd, 0xa7ec03f5, 0
-};
+    return val << shift | val >> ( 64 - shift );
+}
+
+//-----------------------------------------------------------------------------
+
+static inline u64 SplitMix64 ( u64 *state )
+{
+    // used to expand a single seed into a generator state
+    u64 z = ( *state += 0x9e3779b97f4a7c15ull );
+    z = ( z ^ z >> 30 ) * 0xbf58476d1ce4e5b9ull;
+    z = ( z ^ z >> 27 ) * 0x94d049bb133111ebull;
+    return z ^ z >> 31;
+}
+
+//-----------------------------------------------------------------------------
+
+static void SetRandomState ( u64 *s, u64 seed )
+{
+    DASSERT(s);
+    uint i;
+    for ( i = 0; i < 4; i++ )
+	s[i] = SplitMix64(&seed);
+    if ( !( s[0] | s[1] | s[2] | s[3] ) )
+	s[0] = 1;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline u64 NextRandom ( u64 *s )
+{
+    const u64 res = RotateLeft64( s[1] * 5, 7 ) * 9;
+    const u64 t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = RotateLeft64(s[3],45);
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+
+static u64 * GetRandomState(void)
+{
+    random_state_t *rs = &random_state;
+    if (!rs->seeded)
+    {
+	u64 seed;
+	if ( ReadFromUrandom(&seed,sizeof(seed)) != sizeof(seed) )
+	{
+	    struct timeval tval;
+	    gettimeofday(&tval,NULL);
+	    seed = (u64)tval.tv_sec << 20 ^ tval.tv_usec ^ (uintptr_t)rs;
+	}
+	SetRandomState(rs->s,seed);
+	rs->seeded = true;
+    }
+    return rs->s;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -6492,66 +9167,73 @@ u32 MyRandom ( u32 max )
     {
 	u32 res32;
 	if (ReadFromUrandom(&res32,sizeof(res32)))
-	{
-	    if (!max)
-		return res32;
-
-	    u64 res64 = (u64)max * res32;
-	    return res64 >> 32;
-	}
+	    return max ? (u64)max * res32 >> 32 : res32;
 	use_urandom_for_myrandom = false;
     }
 
-    if (!--random32_count)
+    u64 *s = GetRandomState();
+    const u32 res32 = NextRandom(s) >> 32;
+    if (!max)
+	return res32;
+
+    u64 prod = (u64)max * res32;
+    if ( (u32)prod < max )
     {
-	// Neue Berechnung von random32_a und random32_c fällig
+	const u32 limit = -max % max;
+	while ( (u32)prod < limit )
+	    prod = (u64)max * (u32)( NextRandom(s) >> 32 );
+    }
+    return prod >> 32;
+}
 
-	if ( random32_a_index < 0 )
-	{
-	    // allererste Initialisierung auf Zeitbasis
+///////////////////////////////////////////////////////////////////////////////
 
-	    MySeedByTime();
-	}
-	else
+u64 MyRandom64 ( u64 max )
+{
+    if (use_urandom_for_myrandom)
+    {
+	u64 res64;
+	if (ReadFromUrandom(&res64,sizeof(res64)))
 	{
-	    random32_c += RANDOM32_C_ADD;
-	    random32_a = random32_a_tab[++random32_a_index];
-	    if (!random32_a)
-	    {
-		random32_a_index = 0;
-		random32_a = random32_a_tab[0];
-	    }
-
-	    random32_count = RANDOM32_COUNT_BASE;
+	 #if HAVE_INT128
+	    return max ? (u128)max * res64 >> 64 : res64;
+	 #else
+	    return max ? res64 % max : res64;
+	 #endif
 	}
+	use_urandom_for_myrandom = false;
     }
 
-    // Jetzt erfolgt die eigentliche Berechnung
-
-    random32_X = random32_a * random32_X + random32_c;
-
+    u64 *s = GetRandomState();
     if (!max)
-	return random32_X;
+	return NextRandom(s);
 
-    u64 res = (u64)max * random32_X;
-    return res >> 32;
+ #if HAVE_INT128
+    u128 prod = (u128)max * NextRandom(s);
+    if ( (u64)prod < max )
+    {
+	const u64 limit = -max % max;
+	while ( (u64)prod < limit )
+	    prod = (u128)max * NextRandom(s);
+    }
+    return prod >> 64;
+ #else
+    const u64 limit = U64_MAX - U64_MAX % max;
+    u64 res64;
+    do
+	res64 = NextRandom(s);
+    while ( res64 >= limit );
+    return res64 % max;
+ #endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 u64 MySeed ( u64 base )
 {
-    uint a_tab_len = 0;
-    while (random32_a_tab[a_tab_len])
-	a_tab_len++;
-    const u32 base32 = base / a_tab_len;
-
-    random32_a_index	= (int)( base % a_tab_len );
-    random32_a		= random32_a_tab[random32_a_index];
-    random32_c		= ( base32 & 15 ) * RANDOM32_C_ADD + 1;
-    random32_X		= base32 ^ ( base >> 32 );
-    random32_count	= RANDOM32_COUNT_BASE;
-
+    random_state_t *rs = &random_state;
+    SetRandomState(rs->s,base);
+    rs->seeded = true;
     return base;
 }
 
@@ -6575,25 +9257,139 @@ u64 MySeedByTime()
 }
 
 ///////////////////////////////////////////////////////////////////////////////
+// random fill: 4 generators (lanes) in parallel, 32 bytes per round
+
+#define RANDOM_LANES 4
+
+#if HAVE_X86_SIMD
+
+ __attribute__((target("avx2")))
+ static size_t RandomFillAVX2 ( u8 *dest, size_t size, u64 lane[4][RANDOM_LANES] )
+ {
+    // returns the number of filled bytes
+
+    __m256i s0 = _mm256_loadu_si256((const __m256i*)lane[0]);
+    __m256i s1 = _mm256_loadu_si256((const __m256i*)lane[1]);
+    __m256i s2 = _mm256_loadu_si256((const __m256i*)lane[2]);
+    __m256i s3 = _mm256_loadu_si256((const __m256i*)lane[3]);
+
+    size_t done;
+    for ( done = 0; done + 32 <= size; done += 32 )
+    {
+	// res = rotl(s1*5,7)*9
+	__m256i r = _mm256_add_epi64(_mm256_slli_epi64(s1,2),s1);
+	r = _mm256_or_si256(_mm256_slli_epi64(r,7),_mm256_srli_epi64(r,57));
+	r = _mm256_add_epi64(_mm256_slli_epi64(r,3),r);
+	_mm256_storeu_si256((__m256i*)(dest+done),r);
+
+	const __m256i t = _mm256_slli_epi64(s1,17);
+	s2 = _mm256_xor_si256(s2,s0);
+	s3 = _mm256_xor_si256(s3,s1);
+	s1 = _mm256_xor_si256(s1,s2);
+	s0 = _mm256_xor_si256(s0,s3);
+	s2 = _mm256_xor_si256(s2,t);
+	s3 = _mm256_or_si256(_mm256_slli_epi64(s3,45),_mm256_srli_epi64(s3,19));
+    }
+
+    _mm256_storeu_si256((__m256i*)lane[0],s0);
+    _mm256_storeu_si256((__m256i*)lane[1],s1);
+    _mm256_storeu_si256((__m256i*)lane[2],s2);
+    _mm256_storeu_si256((__m256i*)lane[3],s3);
+    return done;
+ }
+
+#endif // HAVE_X86_SIMD
+
+//-----------------------------------------------------------------------------
+
+static size_t RandomFillLanes ( u8 *dest, size_t size, u64 lane[4][RANDOM_LANES] )
+{
+    // portable version of RandomFillAVX2() with identical output
+    // returns the number of filled bytes
+
+    size_t done;
+    for ( done = 0; done + 8*RANDOM_LANES <= size; done += 8*RANDOM_LANES )
+    {
+	uint i;
+	for ( i = 0; i < RANDOM_LANES; i++ )
+	{
+	    u64 s[4] = { lane[0][i], lane[1][i], lane[2][i], lane[3][i] };
+	    write_le64( dest + done + 8*i, NextRandom(s) );
+	    lane[0][i] = s[0];
+	    lane[1][i] = s[1];
+	    lane[2][i] = s[2];
+	    lane[3][i] = s[3];
+	}
+    }
+    return done;
+}
+
+//-----------------------------------------------------------------------------
 
 void MyRandomFill ( void * buf, size_t size )
 {
-    size_t xsize = size / sizeof(u32);
-    if (xsize)
+    DASSERT( buf || !size );
+    u8 *dest = buf;
+
+    if ( use_urandom_for_myrandom )
     {
-	size -= xsize * sizeof(u32);
-	u32 * ptr = buf;
-	while ( xsize-- > 0 )
-	    *ptr++ = MyRandom(0);
-	buf = ptr;
+	const size_t done = ReadFromUrandomLarge(dest,size);
+	if ( done == size )
+	    return;
+
+	// reading failed => fill the rest by the generator
+	use_urandom_for_myrandom = false;
+	dest += done;
+	size -= done;
     }
 
-    u8 * ptr = buf;
-    while ( size-- > 0 )
-	*ptr++ = MyRandom(0);
+    u64 *s = GetRandomState();
+
+    if ( size >= 256 )
+    {
+	// seed the lanes by the thread generator
+	u64 lane[4][RANDOM_LANES];
+	uint i, j;
+	for ( i = 0; i < RANDOM_LANES; i++ )
+	{
+	    u64 ls[4];
+	    SetRandomState(ls,NextRandom(s));
+	    for ( j = 0; j < 4; j++ )
+		lane[j][i] = ls[j];
+	}
+
+     #if HAVE_X86_SIMD
+	const size_t done = __builtin_cpu_supports("avx2")
+			? RandomFillAVX2(dest,size,lane)
+			: RandomFillLanes(dest,size,lane);
+     #else
+	const size_t done = RandomFillLanes(dest,size,lane);
+     #endif
+	dest += done;
+	size -= done;
+    }
+
+    while ( size >= 8 )
+    {
+	write_le64(dest,NextRandom(s));
+	dest += 8;
+	size -= 8;
+    }
+
+    if ( size > 0 )
+    {
+	u64 val = NextRandom(s);
+	while ( size-- > 0 )
+	{
+	    *dest++ = val;
+	    val >>= 8;
+	}
+    }
 }
 
-//
+#undef RANDOM_LANES
+
+//
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			UUID				///////////////
 ///////////////////////////////////////////////////////////////////////////////
@@ -6601,12 +9397,27 @@ void MyRandomFill ( void * buf, size_t size )
 void CreateUUID ( uuid_buf_t dest )
 {
     DASSERT(dest);
-    const uint stat = ReadFromUrandom(dest,sizeof(uuid_buf_t));
-    if (!stat)
-	MyRandomFill(dest,sizeof(uuid_buf_t));
+    CreateUUIDList((uuid_buf_t*)dest,1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void CreateUUIDList ( uuid_buf_t *dest, uint n )
+{
+    DASSERT( dest || !n );
+
+    const size_t size = (size_t)n * sizeof(uuid_buf_t);
+    if ( !size )
+	return;
+    const size_t done = ReadFromUrandomLarge(dest,size);
+    if ( done < size )
+	MyRandomFill((u8*)dest+done,size-done);
 
-    dest[6] = dest[6] & 0x0f | 0x40;
-    dest[8] = dest[8] & 0x3f | 0x80;
+    for ( ; n > 0; n--, dest++ )
+    {
+	(*dest)[6] = (*dest)[6] & 0x0f | 0x40;
+	(*dest)[8] = (*dest)[8] & 0x3f | 0x80;
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6798,36 +9609,155 @@ u64 lcm64 ( u64 n1, u64 n2 ) // lowest common multiple, german: kgv
 #define NP NUMBER_SEPARATE
 #define NX NUMBER_OTHER
 
-const char DigitTable[] =
-{
-    NN, NC, NC, NC,  NC, NC, NC, NC,  NC, NS, NL, NC,  NS, NL, NC, NC,
-    NC, NC, NC, NC,  NC, NC, NC, NC,  NC, NC, NC, NC,  NC, NC, NC, NC,
-    NS, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NP, NT, NT, NX,	//  !"#$%&' ()*+,-./
-     0,  1,  2,  3,   4,  5,  6,  7,   8,  9, NT, NP,  NX, NX, NX, NX,	// 01234567 89:;<=>?
+const char DigitTable[] =
+{
+    NN, NC, NC, NC,  NC, NC, NC, NC,  NC, NS, NL, NC,  NS, NL, NC, NC,
+    NC, NC, NC, NC,  NC, NC, NC, NC,  NC, NC, NC, NC,  NC, NC, NC, NC,
+    NS, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NP, NT, NT, NX,	//  !"#$%&' ()*+,-./
+     0,  1,  2,  3,   4,  5,  6,  7,   8,  9, NT, NP,  NX, NX, NX, NX,	// 01234567 89:;<=>?
+
+    NX, 10, 11, 12,  13, 14, 15, 16,  17, 18, 19, 20,  21, 22, 23, 24,	// @ABCDEFG HIJKLMNO
+    25, 26, 27, 28,  29, 30, 31, 32,  33, 34, 35, NX,  NX, NX, NX, NX,	// PQRSTUVW XYZ[\]^_
+    NX, 10, 11, 12,  13, 14, 15, 16,  17, 18, 19, 20,  21, 22, 23, 24,	// `abcdefg hijklmno
+    25, 26, 27, 28,  29, 30, 31, 32,  33, 34, 35, NX,  NX, NX, NX, NX,	// pqrstuvw xyz{|}~
+
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+};
+
+#undef NN
+#undef NC
+#undef NL
+#undef NS
+#undef NT
+#undef NP
+#undef NX
+
+///////////////////////////////////////////////////////////////////////////////
+// Decimal parsing core: If the end of the source is known, the digit run
+// is detected and converted 8 digits at once by SWAR (SIMD within a
+// register) arithmetic. NULL terminated sources must not be read ahead,
+// so they are scanned by a single fused loop. The result wraps modulo
+// 2^64 like the classic 'num = num*10 + digit'.
+
+static inline u64 NonDigitMask ( u64 val )
+{
+    // each byte of the result is 0, if the byte of 'val' is a decimal digit
+    return ( val & 0xf0f0f0f0f0f0f0f0ull
+	   | ( val + 0x0606060606060606ull & 0xf0f0f0f0f0f0f0f0ull ) >> 4 )
+	^ 0x3333333333333333ull;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline u32 ScanEightDigits ( u64 val )
+{
+    // 'val' is the little endian load of 8 decimal digits
+    val -= 0x3030303030303030ull;
+    val = val * 10 + ( val >> 8 ) & 0x00ff00ff00ff00ffull;
+    val = val * 100 + ( val >> 16 ) & 0x0000ffff0000ffffull;
+    return val * 10000 + ( val >> 32 );
+}
+
+//-----------------------------------------------------------------------------
+
+static ccp ScanDecimalCore
+(
+    // returns a pointer to the first not used character
+
+    u64		*res_num,		// not NULL: store result here
+    bool	*overflow,		// not NULL: store true, if result > U64_MAX
+    ccp		src,			// source, not NULL
+    ccp		src_end,		// NULL or end of 'src'
+    uint	max_digits		// max number of digits to read
+)
+{
+    DASSERT(src);
+
+    u64 num = 0;
+    uint len = 0;
+
+    if (!src_end)
+    {
+	//--- reading ahead is not allowed => scan and convert in one pass
+
+	for ( ; len < max_digits; len++ )
+	{
+	    const uint digit = (uchar)(src[len]-'0');
+	    if ( digit >= 10 )
+		break;
+	    num = num * 10 + digit;
+	}
+    }
+    else
+    {
+	//--- find the end of the digit run, 8 bytes at once
+
+	if ( src_end <= src )
+	    max_digits = 0;
+	else if ( max_digits > src_end - src )
+	    max_digits = src_end - src;
+
+	while ( len + 8 <= max_digits )
+	{
+	    const u64 mask = NonDigitMask(le64(src+len));
+	    if (mask)
+	    {
+		len += __builtin_ctzll(mask) / 8;
+		max_digits = len;
+		break;
+	    }
+	    len += 8;
+	}
+	while ( len < max_digits && (uchar)(src[len]-'0') < 10 )
+	    len++;
 
-    NX, 10, 11, 12,  13, 14, 15, 16,  17, 18, 19, 20,  21, 22, 23, 24,	// @ABCDEFG HIJKLMNO
-    25, 26, 27, 28,  29, 30, 31, 32,  33, 34, 35, NX,  NX, NX, NX, NX,	// PQRSTUVW XYZ[\]^_
-    NX, 10, 11, 12,  13, 14, 15, 16,  17, 18, 19, 20,  21, 22, 23, 24,	// `abcdefg hijklmno
-    25, 26, 27, 28,  29, 30, 31, 32,  33, 34, 35, NX,  NX, NX, NX, NX,	// pqrstuvw xyz{|}~
+	//--- convert the digits, 8 at once
 
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
+	ccp ptr = src, end = src + len;
+	for ( ; ptr + 8 <= end; ptr += 8 )
+	    num = num * 100000000 + ScanEightDigits(le64(ptr));
 
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-    NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,  NX, NX, NX, NX,
-};
+	const uint tail = end - ptr;
+	if ( len >= 8 )
+	{
+	    // reload the last 8 digits and replace the already used ones by '0'
+	    const u64 used = ~0ull >> 8*tail;
+	    num = num * DecimalPow10[tail]
+		+ ScanEightDigits( le64(end-8) & ~used | 0x3030303030303030ull & used );
+	}
+	else if ( len && src + 8 <= src_end )
+	{
+	    // short run: shift the digits up and fill the low bytes with '0'
+	    num = ScanEightDigits( le64(src) << 8*(8-len)
+				| 0x3030303030303030ull >> 8*len );
+	}
+	else
+	    while ( ptr < end )
+		num = num * 10 + ( *ptr++ - '0' );
+    }
 
-#undef NN
-#undef NC
-#undef NL
-#undef NS
-#undef NT
-#undef NP
-#undef NX
+    ccp end = src + len;
+    if (overflow)
+    {
+	ccp ptr = src;
+	while ( ptr < end && *ptr == '0' )
+	    ptr++;
+	*overflow = end - ptr > 20
+		|| end - ptr == 20 && memcmp(ptr,"18446744073709551615",20) > 0;
+    }
+
+    if (res_num)
+	*res_num = num;
+    return end;
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -6848,7 +9778,9 @@ u64 ScanDigits
 
     ccp src = *source;
     u64 num = 0;
-    while ( maxchar-- && ( !end_source || src < end_source ) )
+    if ( intbase == 10 )
+	src = ScanDecimalCore(&num,0,src,end_source,maxchar<0?~0u:maxchar);
+    else while ( maxchar-- && ( !end_source || src < end_source ) )
     {
 	const u8 digit = (u8)DigitTable[(u8)*src];
 	if ( digit >= intbase )
@@ -6878,7 +9810,13 @@ char * ScanNumber
 {
     DASSERT(dest_num);
     uint num = 0;
-    if (src)
+    if ( src && intbase == 10 )
+    {
+	u64 num64;
+	src = ScanDecimalCore(&num64,0,src,src_end,maxchar<0?~0u:maxchar);
+	num = num64;
+    }
+    else if (src)
     {
 	while ( maxchar-- && ( !src_end || src < src_end ) )
 	{
@@ -7067,8 +10005,22 @@ char * ScanS32
 			? 16 : default_base;
  #endif
 
-    char *end;
-    const s32 num = strtoul( src, &end, base );
+    char *end = 0;
+    s32 num = 0;
+    if ( ( base == 10 || !base && *src != '0' ) && (uchar)(*src-'0') < 10 )
+    {
+	// decimal fast path, overflows are handled by strtoul()
+	u64 num64;
+	bool overflow;
+	end = (char*)ScanDecimalCore(&num64,&overflow,src,0,~0u);
+	if ( overflow || num64 > ULONG_MAX )
+	    end = 0;
+	else
+	    num = num64;
+    }
+    if (!end)
+	num = strtoul( src, &end, base );
+
     if ( (ccp)end > src )
     {
 	if (res_num)
@@ -7109,8 +10061,19 @@ char * ScanS64
     }
     const uint base = src[0] == '0' && ( src[1] == 'x' || src[1] == 'X' )
 			? 16 : default_base;
-    char *end;
-    const s64 num = strtoull( src, &end, base );
+    char *end = 0;
+    s64 num = 0;
+    if ( ( base == 10 || !base && *src != '0' ) && (uchar)(*src-'0') < 10 )
+    {
+	// decimal fast path, overflows are handled by strtoull()
+	bool overflow;
+	end = (char*)ScanDecimalCore((u64*)&num,&overflow,src,0,~0u);
+	if (overflow)
+	    end = 0;
+    }
+    if (!end)
+	num = strtoull( src, &end, base );
+
     if ( (ccp)end > src )
     {
 	if (res_num)
@@ -7167,6 +10130,208 @@ unsigned long long int str2ull ( const char *nptr, char **endptr, int base )
     return res;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			  scan columns			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+typedef enum scan_column_t
+{
+    SCOL_U64,
+    SCOL_S64,
+    SCOL_DOUBLE,
+}
+scan_column_t;
+
+//-----------------------------------------------------------------------------
+
+static bool ScanColumnField
+(
+    // returns true, if the whole field is a valid number
+
+    void		*dest,		// store the number here
+    scan_column_t	type,		// type of 'dest'
+    ccp			src,		// first char of field, blanks removed
+    ccp			src_end		// end of field, blanks removed
+)
+{
+    DASSERT( src < src_end );
+
+    //--- fast path: decimal integers
+
+    const bool minus = *src == '-';
+    ccp ptr = src + ( minus || *src == '+' );
+    if ( ptr < src_end && (uchar)(*ptr-'0') < 10 )
+    {
+	u64 num;
+	bool overflow;
+	if ( ScanDecimalCore(&num,&overflow,ptr,src_end,~0u) != src_end )
+	    ; // not a plain integer
+	else if (overflow)
+	{
+	    if ( type != SCOL_DOUBLE )
+		return false;
+	    // too large for u64, but strtod() can handle it
+	}
+	else
+	{
+	    switch (type)
+	    {
+	     case SCOL_U64:
+		if (minus)
+		    return false;
+		*(u64*)dest = num;
+		return true;
+
+	     case SCOL_S64:
+		if ( num > (u64)S64_MAX + minus )
+		    return false;
+		*(s64*)dest = minus ? -num : num;
+		return true;
+
+	     case SCOL_DOUBLE:
+		*(double*)dest = minus ? -(double)num : (double)num;
+		return true;
+	    }
+	}
+    }
+
+    //--- other formats: use a NULL terminated copy
+
+    char temp[80];
+    const uint len = src_end - src;
+    if ( len >= sizeof(temp) || type == SCOL_U64 && minus )
+	return false;
+    memcpy(temp,src,len);
+    temp[len] = 0;
+
+    char *end;
+    switch (type)
+    {
+     case SCOL_U64:
+     case SCOL_S64:
+	end = ScanS64(dest,temp,10);
+	break;
+
+     case SCOL_DOUBLE:
+	*(double*)dest = strtod(temp,&end);
+	break;
+
+     default:
+	return false;
+    }
+    return end == temp + len;
+}
+
+//-----------------------------------------------------------------------------
+
+static uint ScanColumnHelper
+(
+    void		*dest,		// store values here
+    scan_column_t	type,		// type of 'dest'
+    uint		max_num,	// max number of values to store
+    mem_t		source,		// source text
+    char		sep,		// field separator
+    const void		*invalid,	// value for empty or invalid fields
+    uint		*n_invalid	// not NULL: store number of invalid fields
+)
+{
+    DASSERT( dest || !max_num );
+    DASSERT(invalid);
+
+    const uint item_size = type == SCOL_DOUBLE ? sizeof(double) : sizeof(u64);
+    u8 *dptr = dest;
+    uint count = 0, n_inval = 0;
+
+    if ( source.ptr && source.len > 0 )
+    {
+	ccp ptr = source.ptr, end = ptr + source.len;
+	while ( count < max_num )
+	{
+	    ccp fend = memchr(ptr,sep,end-ptr);
+	    ccp next = fend ? fend + 1 : end;
+	    if (!fend)
+		fend = end;
+
+	    ccp fptr = ptr;
+	    while ( fptr < fend && (uchar)*fptr <= ' ' )
+		fptr++;
+	    while ( fend > fptr && (uchar)fend[-1] <= ' ' )
+		fend--;
+
+	    if ( fptr == fend || !ScanColumnField(dptr,type,fptr,fend) )
+	    {
+		memcpy(dptr,invalid,item_size);
+		n_inval++;
+	    }
+	    dptr += item_size;
+	    count++;
+
+	    if ( next >= end )
+		break;
+	    ptr = next;
+	}
+    }
+
+    if (n_invalid)
+	*n_invalid = n_inval;
+    return count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint ScanColumnU64
+(
+    // Split 'source' into fields and scan one number per field.
+    // Returns the number of scanned fields.
+
+    u64		*dest,			// store values here
+    uint	max_num,		// max number of elements of 'dest'
+    mem_t	source,			// source text
+    char	sep,			// field separator, e.g. ',' or '\n'
+    u64		invalid,		// value for empty or invalid fields
+    uint	*n_invalid		// not NULL: store number of invalid fields
+)
+{
+    return ScanColumnHelper(dest,SCOL_U64,max_num,source,sep,&invalid,n_invalid);
+}
+
+//-----------------------------------------------------------------------------
+
+uint ScanColumnS64
+(
+    // Split 'source' into fields and scan one number per field.
+    // Returns the number of scanned fields.
+
+    s64		*dest,			// store values here
+    uint	max_num,		// max number of elements of 'dest'
+    mem_t	source,			// source text
+    char	sep,			// field separator, e.g. ',' or '\n'
+    s64		invalid,		// value for empty or invalid fields
+    uint	*n_invalid		// not NULL: store number of invalid fields
+)
+{
+    return ScanColumnHelper(dest,SCOL_S64,max_num,source,sep,&invalid,n_invalid);
+}
+
+//-----------------------------------------------------------------------------
+
+uint ScanColumnD
+(
+    // Split 'source' into fields and scan one number per field.
+    // Returns the number of scanned fields.
+
+    double	*dest,			// store values here
+    uint	max_num,		// max number of elements of 'dest'
+    mem_t	source,			// source text
+    char	sep,			// field separator, e.g. ',' or '\n'
+    double	invalid,		// value for empty or invalid fields
+    uint	*n_invalid		// not NULL: store number of invalid fields
+)
+{
+    return ScanColumnHelper(dest,SCOL_DOUBLE,max_num,source,sep,&invalid,n_invalid);
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////		round float/double (zero LSB)		///////////////
@@ -7266,16 +10431,13 @@ char * PrintNumberU4
 	if ( !n32 && mode & DC_SFORM_DASH )
 	    StringCopyS(buf,buf_size, aligned ? "   -" : "-" );
 	else if ( n32 < 10000 )
-	    snprintf(buf,buf_size, aligned ? "%4u" : "%u", n32 );
+	    StoreNumberUnit(buf,buf_size,n32,false,aligned?4:0,0);
 	else if ( n32 < 1000000 )
-	    snprintf(buf,buf_size, aligned ? "%3uk" : "%uk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000,false,aligned?3:0,'k');
 	else if ( n32 < 10000000 )
-	{
-	    n32 /= 100000;
-	    snprintf(buf,buf_size,"%u.%uM", n32/10, n32%10 );
-	}
+	    StoreNumberDot1(buf,buf_size,n32/100000,false,'M');
 	else
-	    snprintf(buf,buf_size, aligned ? "%3uM" : "%uM", n32/1000000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000000,false,aligned?3:0,'M');
     }
     else
     {
@@ -7293,12 +10455,12 @@ char * PrintNumberU4
 	{
 	    if ( n32 < 100 )
 	    {
-		snprintf(buf,buf_size,"%u.%u%c", n32/10, n32%10, *factor );
+		StoreNumberDot1(buf,buf_size,n32,false,*factor);
 		break;
 	    }
 	    else if ( n32 < 10000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%3u%c" : "%u%c", n32/10, *factor );
+		StoreNumberUnit(buf,buf_size,n32/10,false,aligned?3:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7329,11 +10491,11 @@ char * PrintNumberU5
 	if ( !n32 && mode & DC_SFORM_DASH )
 	    StringCopyS(buf,buf_size, aligned ? "    -" : "-" );
 	else if ( n32 < 100000 )
-	    snprintf(buf,buf_size, aligned ? "%5u" : "%u", n32 );
+	    StoreNumberUnit(buf,buf_size,n32,false,aligned?5:0,0);
 	else if ( n32 < 10000000 )
-	    snprintf(buf,buf_size, aligned ? "%4uk" : "%uk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000,false,aligned?4:0,'k');
 	else
-	    snprintf(buf,buf_size, aligned ? "%4uM" : "%uM", n32/1000000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000000,false,aligned?4:0,'M');
     }
     else
     {
@@ -7351,7 +10513,7 @@ char * PrintNumberU5
 	{
 	    if ( n32 < 10000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%4u%c" : "%u%c", n32, *factor );
+		StoreNumberUnit(buf,buf_size,n32,false,aligned?4:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7382,11 +10544,11 @@ char * PrintNumberU6
 	if ( !n32 && mode & DC_SFORM_DASH )
 	    StringCopyS(buf,buf_size, aligned ? "     -" : "-" );
 	else if ( n32 < 1000000 )
-	    snprintf(buf,buf_size, aligned ? "%6u" : "%u", n32 );
+	    StoreNumberUnit(buf,buf_size,n32,false,aligned?6:0,0);
 	else if ( n32 < 100000000 )
-	    snprintf(buf,buf_size, aligned ? "%5uk" : "%uk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000,false,aligned?5:0,'k');
 	else
-	    snprintf(buf,buf_size, aligned ? "%5uM" : "%uM", n32/1000000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000000,false,aligned?5:0,'M');
     }
     else
     {
@@ -7404,7 +10566,7 @@ char * PrintNumberU6
 	{
 	    if ( n32 < 100000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%5u%c" : "%u%c", n32, *factor );
+		StoreNumberUnit(buf,buf_size,n32,false,aligned?5:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7435,9 +10597,9 @@ char * PrintNumberU7
 	if ( !n32 && mode & DC_SFORM_DASH )
 	    StringCopyS(buf,buf_size, aligned ? "      -" : "-" );
 	else if ( n32 < 10000000 )
-	    snprintf(buf,buf_size, aligned ? "%7u" : "%u", n32 );
+	    StoreNumberUnit(buf,buf_size,n32,false,aligned?7:0,0);
 	else
-	    snprintf(buf,buf_size, aligned ? "%6uk" : "%uk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,n32/1000,false,aligned?6:0,'k');
     }
     else
     {
@@ -7455,7 +10617,7 @@ char * PrintNumberU7
 	{
 	    if ( n32 < 1000000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%6u%c" : "%u%c", n32, *factor );
+		StoreNumberUnit(buf,buf_size,n32,false,aligned?6:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7488,39 +10650,36 @@ char * PrintNumberS5
     {
 	s32 n32 = num;
 	if ( n32 > -10000 )
-	    snprintf(buf,buf_size, aligned ? "%5d" : "%d", n32 );
+	    StoreNumberUnit(buf,buf_size,-n32,true,aligned?5:0,0);
 	else if ( n32 > -1000000 )
-	    snprintf(buf,buf_size, aligned ? "%4dk" : "%dk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,-n32/1000,true,aligned?4:0,'k');
 	else if ( n32 > -10000000 )
-	{
-	    n32 /= -100000;
-	    snprintf(buf,buf_size,"-%u.%uM", n32/10, n32%10 );
-	}
+	    StoreNumberDot1(buf,buf_size,-n32/100000,true,'M');
 	else
-	    snprintf(buf,buf_size, aligned ? "%4dM" : "%dM", n32/1000000 );
+	    StoreNumberUnit(buf,buf_size,-n32/1000000,true,aligned?4:0,'M');
     }
     else
     {
 	s32 n32;
 	ccp factor = "GTPE";
-	if ( num > -1000000000000000ull ) // -1e15
+	if ( num > -1000000000000000ll ) // -1e15
 	    n32 = num / 100000000; // -1e8
 	else
 	{
 	    factor += 2;
-	    n32 = num / 100000000000000ull; // -1e14
+	    n32 = num / 100000000000000ll; // -1e14
 	}
 
 	while (*factor)
 	{
 	    if ( n32 > -100 )
 	    {
-		snprintf(buf,buf_size,"-%u.%u%c", -n32/10, -n32%10, *factor );
+		StoreNumberDot1(buf,buf_size,-n32,true,*factor);
 		break;
 	    }
 	    else if ( n32 > -10000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%4d%c" : "%d%c", n32/10, *factor );
+		StoreNumberUnit(buf,buf_size,-n32/10,true,aligned?4:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7552,29 +10711,29 @@ char * PrintNumberS6
     {
 	s32 n32 = num;
 	if ( n32 > -100000 )
-	    snprintf(buf,buf_size, aligned ? "%6d" : "%d", n32 );
+	    StoreNumberUnit(buf,buf_size,-n32,true,aligned?6:0,0);
 	else if ( n32 > -10000000 )
-	    snprintf(buf,buf_size, aligned ? "%5dk" : "%dk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,-n32/1000,true,aligned?5:0,'k');
 	else
-	    snprintf(buf,buf_size, aligned ? "%5dM" : "%dM", n32/1000000 );
+	    StoreNumberUnit(buf,buf_size,-n32/1000000,true,aligned?5:0,'M');
     }
     else
     {
 	s32 n32;
 	ccp factor = "MGTPE";
-	if ( num > -1000000000000000ull ) // -1e15
+	if ( num > -1000000000000000ll ) // -1e15
 	    n32 = num / 1000000; // -1e6
 	else
 	{
 	    factor += 2;
-	    n32 = num / 1000000000000ull; // -1e12
+	    n32 = num / 1000000000000ll; // -1e12
 	}
 
 	while (*factor)
 	{
 	    if ( n32 > -10000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%5d%c" : "%d%c", n32, *factor );
+		StoreNumberUnit(buf,buf_size,-n32,true,aligned?5:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7606,27 +10765,27 @@ char * PrintNumberS7
     {
 	s32 n32 = num;
 	if ( n32 > -1000000 )
-	    snprintf(buf,buf_size, aligned ? "%7d" : "%d", n32 );
+	    StoreNumberUnit(buf,buf_size,-n32,true,aligned?7:0,0);
 	else
-	    snprintf(buf,buf_size, aligned ? "%6dk" : "%dk", n32/1000 );
+	    StoreNumberUnit(buf,buf_size,-n32/1000,true,aligned?6:0,'k');
     }
     else
     {
 	s32 n32;
 	ccp factor = "MGTPE";
-	if ( num > -1000000000000000ull ) // -1e15
+	if ( num > -1000000000000000ll ) // -1e15
 	    n32 = num / 1000000; // -1e6
 	else
 	{
 	    factor += 2;
-	    n32 = num / 1000000000000ull; // -1e12
+	    n32 = num / 1000000000000ll; // -1e12
 	}
 
 	while (*factor)
 	{
 	    if ( n32 > -100000 )
 	    {
-		snprintf(buf,buf_size, aligned ? "%6d%c" : "%d%c", n32, *factor );
+		StoreNumberUnit(buf,buf_size,-n32,true,aligned?6:0,*factor);
 		break;
 	    }
 	    n32 /= 1000;
@@ -7859,6 +11018,16 @@ ccp dc_size_tab_1024[DC_SIZE_N_MODES+1] =
     0		// all others
 };
 
+//-----------------------------------------------------------------------------
+
+static const u64 dc_size_factor[2][DC_SIZE_N_MODES] =
+{
+    // [force_1000][mode] => factor for PrintSize()
+
+    { 1, 1, 1, KiB,   MiB,   GiB,   TiB,   PiB,   EiB   },
+    { 1, 1, 1, KB_SI, MB_SI, GB_SI, TB_SI, PB_SI, EB_SI },
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 
 ccp GetSizeUnit // get a unit for column headers
@@ -7946,66 +11115,41 @@ char * PrintSize
     // ??? [[2do]] follow 'sform_mode'
     const sizeform_mode_t aligned = sform_mode & DC_SFORM_ALIGN;
 
-    switch ( mode & DC_SIZE_M_MODE )
+    const size_mode_t unit = mode & DC_SIZE_M_MODE;
+    switch (unit)
     {
 	//---- SI and IEC units
 
 	case DC_SIZE_BYTES:
-	    snprintf(buf,buf_size, aligned ? "%6llu B" : "%llu B", size );
-	    break;
-
 	case DC_SIZE_K:
-	    if (force_1000)
-		snprintf(buf,buf_size, aligned ? "%5llu kB" : "%llu kB",
-			( size + KB_SI/2 ) / KB_SI );
-	    else
-		snprintf(buf,buf_size, aligned ? "%4llu KiB" : "%llu KiB",
-			( size + KiB/2 ) / KiB );
-	    break;
-
 	case DC_SIZE_M:
-	    if (force_1000)
-		snprintf(buf,buf_size, aligned ? "%5llu MB" : "%llu MB",
-			( size + MB_SI /2 ) / MB_SI  );
-	    else
-		snprintf(buf,buf_size, aligned ? "%4llu MiB" : "%llu MiB",
-			( size + MiB /2 ) / MiB  );
-	    break;
-
 	case DC_SIZE_G:
-	    if (force_1000)
-		snprintf(buf,buf_size, aligned ? "%5llu GB" : "%llu GB",
-			( size + GB_SI/2 ) / GB_SI );
-	    else
-		snprintf(buf,buf_size, aligned ? "%4llu GiB" : "%llu GiB",
-			( size + GiB/2 ) / GiB );
-	    break;
-
 	case DC_SIZE_T:
-	    if (force_1000)
-		snprintf(buf,buf_size, aligned ? "%5llu TB" : "%llu TB",
-			( size + TB_SI/2 ) / TB_SI );
-	    else
-		snprintf(buf,buf_size, aligned ? "%4llu TiB" : "%llu TiB",
-			( size + TiB/2 ) / TiB );
-	    break;
-
 	case DC_SIZE_P:
-	    if (force_1000)
-		snprintf(buf,buf_size, aligned ? "%5llu PB" : "%llu PB",
-			( size + PB_SI/2 ) / PB_SI );
-	    else
-		snprintf(buf,buf_size, aligned ? "%4llu PiB" : "%llu PiB",
-			( size + PiB/2 ) / PiB );
-	    break;
-
 	case DC_SIZE_E:
-	    if (force_1000)
-		snprintf(buf,buf_size, aligned ? "%5llu EB" : "%llu EB",
-			( size + EB_SI/2 ) / EB_SI );
-	    else
-		snprintf(buf,buf_size, aligned ? "%4llu EiB" : "%llu EiB",
-			( size + EiB/2 ) / EiB );
+	    {
+		uint fw;
+		ccp unit_name;
+		u64 num = size;
+		if ( unit == DC_SIZE_BYTES )
+		{
+		    fw = 6;
+		    unit_name = "B";
+		}
+		else
+		{
+		    const u64 factor = dc_size_factor[force_1000][unit];
+		    num = ( size + factor/2 ) / factor;
+		    fw = force_1000 ? 5 : 4;
+		    unit_name = force_1000 ? dc_size_tab_1000[unit] : dc_size_tab_1024[unit];
+		}
+
+		char temp[32];
+		char *dest = PutDecimalFW(temp,num,false,aligned?fw:0);
+		*dest++ = ' ';
+		dest = StringCopyE(dest,temp+sizeof(temp),unit_name);
+		StoreField(buf,buf_size,temp,dest-temp);
+	    }
 	    break;
 
 
@@ -8032,6 +11176,62 @@ char * PrintSize
     return buf;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+static char * StoreSizeField
+(
+    // helper for PrintSize1000() and PrintSize1024()
+
+    char		*buf,		// result buffer
+    size_t		buf_size,	// size of 'buf'
+    u64			num,		// scaled size to print
+    size_mode_t		unit,		// unit of 'num'
+    sizeform_mode_t	sform_mode,	// output format, bit field
+    ccp			*unit_tab	// dc_size_tab_1000 or dc_size_tab_1024
+)
+{
+    const bool aligned = ( sform_mode & DC_SFORM_ALIGN ) != 0;
+
+    char temp[40], *dest;
+    if ( !num && unit == DC_SIZE_BYTES && sform_mode & DC_SFORM_DASH )
+    {
+	if (!aligned)
+	{
+	    StringCopyS(buf,buf_size,"-");
+	    return buf;
+	}
+	memcpy(temp,"   -",4);
+	dest = temp + 4;
+    }
+    else
+	dest = PutDecimalFW(temp,num,false,aligned?4:0);
+
+    char *unit_start = dest;
+    if ( !(sform_mode & DC_SFORM_NARROW) )
+	*dest++ = ' ';
+
+    if ( sform_mode & DC_SFORM_UNIT1 )
+    {
+	if ( unit != DC_SIZE_BYTES )
+	    *dest++ = dc_size_tab_1000[unit][0];
+	else if (aligned)
+	    *dest++ = ' ';
+	else
+	    dest = unit_start; // not any char
+    }
+    else
+    {
+	char *name = dest;
+	dest = StringCopyE(dest,temp+sizeof(temp),unit_tab[unit]);
+	if (aligned)
+	    while ( dest < name + 3 )
+		*dest++ = ' ';
+    }
+
+    StoreField(buf,buf_size,temp,dest-temp);
+    return buf;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // [[PrintSize1000]]
 
@@ -8113,39 +11313,7 @@ char * PrintSize1000
 	num /= 1000;
     }
 
-    char unit_buf[8];
-    char *dest = unit_buf;
-    if ( !(sform_mode & DC_SFORM_NARROW) )
-	*dest++ = ' ';
-
-    if ( sform_mode & DC_SFORM_UNIT1 )
-    {
-	if ( unit != DC_SIZE_BYTES )
-	    *dest++ = dc_size_tab_1000[unit][0];
-	else if ( sform_mode & DC_SFORM_ALIGN )
-	    *dest++ = ' ';
-	else
-	    dest = unit_buf; // not any char
-	*dest = 0;
-    }
-    else if ( sform_mode & DC_SFORM_ALIGN )
-	snprintf(dest,sizeof(unit_buf)-1,"%-3s",dc_size_tab_1000[unit]);
-    else
-	StringCopyS(dest,sizeof(unit_buf)-1,dc_size_tab_1000[unit]);
-
-    if ( !num && unit == DC_SIZE_BYTES && sform_mode & DC_SFORM_DASH )
-    {
-	if ( sform_mode & DC_SFORM_ALIGN )
-	    snprintf(buf,buf_size,"   -%s",unit_buf);
-	else
-	    StringCopyS(buf,buf_size,"-");
-    }
-    if ( sform_mode & DC_SFORM_ALIGN )
-	snprintf(buf,buf_size,"%4llu%s",num,unit_buf);
-    else
-	snprintf(buf,buf_size,"%llu%s",num,unit_buf);
-
-    return buf;
+    return StoreSizeField(buf,buf_size,num,unit,sform_mode,dc_size_tab_1000);
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8229,39 +11397,7 @@ char * PrintSize1024
 	num /= 0x400;
     }
 
-    char unit_buf[8];
-    char *dest = unit_buf;
-    if ( !(sform_mode & DC_SFORM_NARROW) )
-	*dest++ = ' ';
-
-    if ( sform_mode & DC_SFORM_UNIT1 )
-    {
-	if ( unit != DC_SIZE_BYTES )
-	    *dest++ = dc_size_tab_1000[unit][0];
-	else if ( sform_mode & DC_SFORM_ALIGN )
-	    *dest++ = ' ';
-	else
-	    dest = unit_buf; // not any char
-	*dest = 0;
-    }
-    else if ( sform_mode & DC_SFORM_ALIGN )
-	snprintf(dest,sizeof(unit_buf)-1,"%-3s",dc_size_tab_1024[unit]);
-    else
-	StringCopyS(dest,sizeof(unit_buf)-1,dc_size_tab_1024[unit]);
-
-    if ( !num && unit == DC_SIZE_BYTES && sform_mode & DC_SFORM_DASH )
-    {
-	if ( sform_mode & DC_SFORM_ALIGN )
-	    snprintf(buf,buf_size,"   -%s",unit_buf);
-	else
-	    StringCopyS(buf,buf_size,"-");
-    }
-    else if ( sform_mode & DC_SFORM_ALIGN )
-	snprintf(buf,buf_size,"%4llu%s",num,unit_buf);
-    else
-	snprintf(buf,buf_size,"%llu%s",num,unit_buf);
-
-    return buf;
+    return StoreSizeField(buf,buf_size,num,unit,sform_mode,dc_size_tab_1024);
 };
 
 //
@@ -8354,8 +11490,22 @@ char * ScanSizeTerm
 {
     ASSERT(source);
 
-    char * end;
-    double d = strtod(source,&end);
+    char * end = 0;
+    double d = 0.0;
+    if ( (uchar)(*source-'0') < 10 )
+    {
+	// integer fast path: (double)u64 rounds like strtod()
+	u64 num;
+	bool overflow;
+	end = (char*)ScanDecimalCore(&num,&overflow,source,0,~0u);
+	if ( overflow || *end && strchr(".,eExX",*end) )
+	    end = 0;
+	else
+	    d = num;
+    }
+    if (!end)
+	d = strtod(source,&end);
+
     if ( end > source )
     {
 	// something was read
@@ -41,8 +41,408 @@
 #include "dclib/dclib-punycode.inc"
 
 //
+///////////////////////////////////////////////////////////////////////////////
+///////////////			label helpers			///////////////
 ///////////////////////////////////////////////////////////////////////////////
-///////////////			Domain2UTF8()			///////////////
+
+enum
+{
+    PUNY_MAX_LEN	= 1000,	// max length of a converted label
+    PUNY_MAX_KEY	=  255,	// max length of a cached label
+    PUNY_MAX_PLAIN	=  999,	// max length of a plain ASCII label
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+static char * CopyLabel ( char *dest, ccp dest_end, ccp src, uint len )
+{
+    // like StringCopyEM(), but never read behind 'src+len'
+
+    if ( dest >= dest_end )
+	return dest;
+
+    ccp nul = memchr(src,0,len);
+    if (nul)
+	len = nul - src;
+    if ( len >= dest_end - dest )
+	len = dest_end - dest - 1;
+
+    memcpy(dest,src,len);
+    dest += len;
+    *dest = 0;
+    return dest;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool IsPlainDomain ( ccp src, ccp end, bool encode )
+{
+    // Returns true, if the domain is not changed by the conversion:
+    //  - never: NULL bytes
+    //  - decode: no label starts with "xn--"
+    //  - encode: only ASCII and no label is longer than PUNY_MAX_PLAIN
+
+    ccp label = src;
+    for ( ; src < end; src++ )
+    {
+	const uchar ch = *src;
+	if ( !ch || encode && ch >= 0x80 )
+	    return false;
+
+	if ( ch == '.' )
+	    label = src + 1;
+	else if (encode)
+	{
+	    if ( src - label >= PUNY_MAX_PLAIN )
+		return false;
+	}
+	else if ( src == label && end - src >= 4 && !memcmp(src,"xn--",4) )
+	    return false;
+    }
+    return true;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			label cache			///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Converted labels are stored in a hash table. All labels are linked as
+// LRU list too. If the cache is full, the least recently used label is
+// dropped. Each thread has its own cache, because the results of
+// DecodeLabel() and EncodeLabel() point into the cache. The cache is
+// disabled until SetupPunycodeCache() is called by the thread.
+
+typedef struct puny_label_t
+{
+    struct puny_label_t	*hash_next;	// next label with same hash index
+    struct puny_label_t	*lru_prev;	// more recently used label
+    struct puny_label_t	*lru_next;	// less recently used label
+
+    u32			hash;		// hash value of 'encode' and key
+    bool		encode;		// true: Domain2ASCII(), false: Domain2UTF8()
+    bool		failed;		// true: conversion failed
+    u16			key_len;	// length of key (source label)
+    u16			val_len;	// length of value (converted label)
+    char		data[];		// key + value, not NULL-terminated
+}
+puny_label_t;
+
+//-----------------------------------------------------------------------------
+
+static __thread struct
+{
+    uint		max_labels;	// max number of cached labels, 0: disabled
+    uint		n_labels;	// current number of cached labels
+    uint		hash_size;	// number of elements of 'hash_tab', power of 2
+    puny_label_t	**hash_tab;	// NULL or hash table
+
+    puny_label_t	*lru_first;	// most recently used label
+    puny_label_t	*lru_last;	// least recently used label
+
+    u64			n_hit;		// number of cache hits
+    u64			n_miss;		// number of cache misses
+    u64			n_drop;		// number of dropped labels
+}
+puny_cache = {0};
+
+///////////////////////////////////////////////////////////////////////////////
+
+static inline u32 HashPunyLabel ( bool encode, ccp key, uint key_len )
+{
+    // FNV-1a
+    u32 hash = encode ? 0x811c9dc5 : 0x050c5d1f;
+    while ( key_len-- > 0 )
+	hash = ( hash ^ (uchar)*key++ ) * 0x01000193;
+    return hash;
+}
+
+//-----------------------------------------------------------------------------
+
+static void UnlinkPunyLabel ( puny_label_t *pl )
+{
+    DASSERT(pl);
+
+    if (pl->lru_prev)
+	pl->lru_prev->lru_next = pl->lru_next;
+    else
+	puny_cache.lru_first = pl->lru_next;
+
+    if (pl->lru_next)
+	pl->lru_next->lru_prev = pl->lru_prev;
+    else
+	puny_cache.lru_last = pl->lru_prev;
+
+    pl->lru_prev = pl->lru_next = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static void LinkPunyLabel ( puny_label_t *pl )
+{
+    DASSERT(pl);
+
+    pl->lru_prev = 0;
+    pl->lru_next = puny_cache.lru_first;
+    if (puny_cache.lru_first)
+	puny_cache.lru_first->lru_prev = pl;
+    else
+	puny_cache.lru_last = pl;
+    puny_cache.lru_first = pl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static const puny_label_t * FindPunyLabel
+	( bool encode, ccp key, uint key_len, u32 hash )
+{
+    puny_label_t *pl = puny_cache.hash_tab
+		? puny_cache.hash_tab[ hash & puny_cache.hash_size-1 ] : 0;
+    for ( ; pl; pl = pl->hash_next )
+	if (   pl->hash == hash
+	    && pl->encode == encode
+	    && pl->key_len == key_len
+	    && !memcmp(pl->data,key,key_len) )
+	{
+	    if ( pl != puny_cache.lru_first )
+	    {
+		UnlinkPunyLabel(pl);
+		LinkPunyLabel(pl);
+	    }
+	    puny_cache.n_hit++;
+	    return pl;
+	}
+
+    puny_cache.n_miss++;
+    return 0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void DropPunyLabel ( puny_label_t *pl )
+{
+    DASSERT(pl);
+    DASSERT(puny_cache.hash_tab);
+
+    puny_label_t **ptr = puny_cache.hash_tab + ( pl->hash & puny_cache.hash_size-1 );
+    while ( *ptr != pl )
+    {
+	DASSERT(*ptr);
+	ptr = &(*ptr)->hash_next;
+    }
+    *ptr = pl->hash_next;
+
+    UnlinkPunyLabel(pl);
+    FREE(pl);
+    puny_cache.n_labels--;
+    puny_cache.n_drop++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static void InsertPunyLabel
+(
+    bool	encode,			// true: Domain2ASCII(), false: Domain2UTF8()
+    ccp		key,			// source label
+    uint	key_len,		// length of 'key', <= PUNY_MAX_KEY
+    u32		hash,			// result of HashPunyLabel()
+    mem_t	val,			// converted label
+    bool	failed			// true: conversion failed
+)
+{
+    DASSERT( key_len <= PUNY_MAX_KEY );
+    DASSERT( val.len <= PUNY_MAX_LEN + 10 );
+
+    if (!puny_cache.max_labels)
+	return;
+
+    if (!puny_cache.hash_tab)
+    {
+	uint size = 16;
+	while ( size < puny_cache.max_labels )
+	    size <<= 1;
+	puny_cache.hash_size = size;
+	puny_cache.hash_tab = CALLOC(size,sizeof(*puny_cache.hash_tab));
+    }
+
+    while ( puny_cache.n_labels >= puny_cache.max_labels && puny_cache.lru_last )
+	DropPunyLabel(puny_cache.lru_last);
+
+    puny_label_t *pl = MALLOC(sizeof(*pl)+key_len+val.len);
+    pl->hash	= hash;
+    pl->encode	= encode;
+    pl->failed	= failed;
+    pl->key_len	= key_len;
+    pl->val_len	= val.len;
+    memcpy(pl->data,key,key_len);
+    memcpy(pl->data+key_len,val.ptr,val.len);
+
+    puny_label_t **slot = puny_cache.hash_tab + ( hash & puny_cache.hash_size-1 );
+    pl->hash_next = *slot;
+    *slot = pl;
+    LinkPunyLabel(pl);
+    puny_cache.n_labels++;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void ResetPunycodeCache(void)
+{
+    while (puny_cache.lru_last)
+	DropPunyLabel(puny_cache.lru_last);
+    FREE(puny_cache.hash_tab);
+    puny_cache.hash_tab  = 0;
+    puny_cache.hash_size = 0;
+    puny_cache.n_hit = puny_cache.n_miss = puny_cache.n_drop = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void SetupPunycodeCache ( uint max_labels )
+{
+    ResetPunycodeCache();
+    puny_cache.max_labels = max_labels;
+}
+
+//-----------------------------------------------------------------------------
+
+ccp GetPunycodeCacheStatistics(void)
+{
+    const u64 total = puny_cache.n_hit + puny_cache.n_miss;
+    char buf[150];
+    const uint len = snprintf(buf,sizeof(buf),
+		"%u/%u labels, %llu hits, %llu misses (%.1f%% hits), %llu drops"
+		,puny_cache.n_labels, puny_cache.max_labels
+		,puny_cache.n_hit, puny_cache.n_miss
+		,total ? 100.0 * puny_cache.n_hit / total : 0.0
+		,puny_cache.n_drop
+		);
+    return CopyCircBuf(buf,len+1);
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			label conversion		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static mem_t DecodeLabel
+(
+    // Returns the UTF-8 representation of a "xn--" label.
+    // The result points to 'name' or into the cache and is valid until
+    // the next call of a Domain2*() function.
+
+    char	*name,			// buffer of size PUNY_MAX_LEN+10
+    ccp		label,			// label, starting with "xn--"
+    uint	label_len		// length of 'label'
+)
+{
+    const bool use_cache = puny_cache.max_labels && label_len <= PUNY_MAX_KEY;
+    const u32 hash = use_cache ? HashPunyLabel(false,label,label_len) : 0;
+    if (use_cache)
+    {
+	const puny_label_t *pl = FindPunyLabel(false,label,label_len,hash);
+	if (pl)
+	    return (mem_t){ pl->data + pl->key_len, pl->val_len };
+    }
+
+    punycode_uint pname[PUNY_MAX_LEN+2];
+    punycode_uint olen = PUNY_MAX_LEN;
+    const enum punycode_status stat
+	= punycode_decode(label_len-4,label+4,&olen,pname,0);
+
+    char *dest = name;
+    if ( stat != punycode_success )
+	dest = name + snprintf(name,PUNY_MAX_LEN+10,"!ERR=%d",stat);
+    else
+    {
+	punycode_uint *src = pname, *src_end = pname + olen;
+	char *dest_end = name + PUNY_MAX_LEN;
+	while ( src < src_end && dest < dest_end )
+	    dest = PrintUTF8Char(dest,*src++);
+	*dest = 0;
+    }
+
+    const mem_t res = { name, dest - name };
+    if (use_cache)
+	InsertPunyLabel(false,label,label_len,hash,res,false);
+    return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+static bool EncodeLabel
+(
+    // Store the ASCII representation of 'label' in 'res'.
+    // The result points to 'name' or into the cache and is valid until
+    // the next call of a Domain2*() function.
+    // Returns false on error.
+
+    mem_t	*res,			// store the result here
+    char	*name,			// buffer of size PUNY_MAX_LEN+10
+    ccp		label,			// UTF-8 label
+    uint	label_len		// length of 'label'
+)
+{
+    DASSERT(res);
+
+    ccp src = label, end = label + label_len;
+    while ( src < end && !( *src & 0x80 ) )
+	src++;
+    if ( src == end )
+    {
+	// plain ASCII label => encoded as itself
+	res->ptr = label;
+	res->len = label_len;
+	return label_len <= PUNY_MAX_PLAIN;
+    }
+
+    const bool use_cache = puny_cache.max_labels && label_len <= PUNY_MAX_KEY;
+    const u32 hash = use_cache ? HashPunyLabel(true,label,label_len) : 0;
+    if (use_cache)
+    {
+	const puny_label_t *pl = FindPunyLabel(true,label,label_len,hash);
+	if (pl)
+	{
+	    res->ptr = pl->data + pl->key_len;
+	    res->len = pl->val_len;
+	    return !pl->failed;
+	}
+    }
+
+    punycode_uint pname[PUNY_MAX_LEN+2];
+    punycode_uint *dest = pname, *dest_end = pname + PUNY_MAX_LEN;
+    for ( src = label; dest < dest_end && src < end; )
+	*dest++ = ScanUTF8AnsiCharE(&src,end);
+
+    punycode_uint olen = PUNY_MAX_LEN;
+    const enum punycode_status stat = src < end
+	? punycode_big_output
+	: punycode_encode(dest-pname,pname,0,&olen,name+4);
+
+    if (stat)
+    {
+	res->ptr = name;
+	res->len = 0;
+    }
+    else if ( olen > 0 && name[olen+3] == '-' )
+    {
+	res->ptr = name + 4;
+	res->len = olen - 1;
+    }
+    else
+    {
+	memcpy(name,"xn--",4);
+	res->ptr = name;
+	res->len = olen + 4;
+    }
+
+    if (use_cache)
+	InsertPunyLabel(true,label,label_len,hash,*res,stat!=0);
+    return !stat;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			Domain2UTF8()			///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 uint Domain2UTF8
@@ -65,67 +465,47 @@ uint Domain2UTF8
 	source_len = strlen(source);
 
     ccp src = source, src_end = source + source_len;
-    char *buf_ptr = buf, *buf_end = buf + buf_size - 2;
+    if ( source_len < buf_size - 2 && IsPlainDomain(src,src_end,false) )
+    {
+	memcpy(buf,src,source_len);
+	buf[source_len] = 0;
+	return source_len;
+    }
 
-    enum { MAX_LEN = 1000 };
-    char name[MAX_LEN+10];
-    punycode_uint pname[MAX_LEN+2];
-    MARK_USED(name,pname);
+    char *buf_ptr = buf, *buf_end = buf + buf_size - 2;
+    char name[PUNY_MAX_LEN+10];
 
     while ( src < src_end )
     {
 	while ( buf_ptr < buf_end && src < src_end && *src == '.' )
 	    *buf_ptr++ = *src++;
 	if ( buf_ptr >= buf_end )
-	{
-	    if (!src)
-		goto error;
 	    break;
-	}
 
 	if ( src >= src_end )
 	    break;
 
-	ccp point = strchr(src,'.');
+	ccp point = memchr(src,'.',src_end-src);
 	if (!point)
 	    point = src_end;
 
 	if ( src+4 > src_end || memcmp(src,"xn--",4 ))
-	    buf_ptr = StringCopyEM(buf_ptr,buf_end,src,point-src);
+	    buf_ptr = CopyLabel(buf_ptr,buf_end,src,point-src);
 	else
 	{
-	    src += 4;
-	    punycode_uint olen = MAX_LEN;
-	    const enum punycode_status stat
-		= punycode_decode(point-src,src,&olen,pname,0);
-	    char *dest = name;
-	    if ( stat != punycode_success )
-		dest = name + snprintf(name,sizeof(name),"!ERR=%d",stat);
-	    else
-	    {
-		punycode_uint *src = pname, *src_end = pname + olen;
-		char *dest_end = name + MAX_LEN;
-		while ( src < src_end && dest < dest_end )
-		    dest = PrintUTF8Char(dest,*src++);
-		*dest = 0;
-	    }
-
-	    buf_ptr = StringCopyEM(buf_ptr,buf_end,name,dest-name);
+	    const mem_t res = DecodeLabel(name,src,point-src);
+	    buf_ptr = CopyLabel(buf_ptr,buf_end,res.ptr,res.len);
 	}
 	src = point;
     }
 
     *buf_ptr = 0;
     return src - (ccp)source;
-
- error:
-    *buf = 0;
-    return 0;
 }
 
 //
-///////////////////////////////////////////////////////////////////////////////
-///////////////			Domain2ASCII()			///////////////
+///////////////////////////////////////////////////////////////////////////////
+///////////////			Domain2ASCII()			///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
 uint Domain2ASCII
@@ -148,50 +528,35 @@ uint Domain2ASCII
 	source_len = strlen(source);
 
     ccp src = source, src_end = source + source_len;
-    char *buf_ptr = buf, *buf_end = buf + buf_size - 5;
+    if ( source_len < buf_size - 5 && IsPlainDomain(src,src_end,true) )
+    {
+	memcpy(buf,src,source_len);
+	buf[source_len] = 0;
+	return source_len;
+    }
 
-    enum { MAX_LEN = 1000 };
-    char name[MAX_LEN+10];
-    punycode_uint pname[MAX_LEN+2];
+    char *buf_ptr = buf, *buf_end = buf + buf_size - 5;
+    char name[PUNY_MAX_LEN+10];
 
     while ( src < src_end )
     {
 	while ( buf_ptr < buf_end && src < src_end && *src == '.' )
 	    *buf_ptr++ = *src++;
 	if ( buf_ptr >= buf_end )
-	{
-	    if (!src)
-		goto error;
 	    break;
-	}
 
 	if ( src >= src_end )
 	    break;
 
-	ccp point = strchr(src,'.');
+	ccp point = memchr(src,'.',src_end-src);
 	if (!point)
 	    point = src_end;
 
-	punycode_uint *dest = pname, *dest_end = pname + MAX_LEN;
-	while ( dest < dest_end && src < point )
-	{
-	    u32 code = ScanUTF8AnsiCharE(&src,point);
-	    *dest++ = code;
-	}
-
-	punycode_uint olen = MAX_LEN;
-	const enum punycode_status stat =
-	    punycode_encode(dest-pname,pname,0,&olen,name);
-	if (stat)
+	mem_t res;
+	if (!EncodeLabel(&res,name,src,point-src))
 	    goto error;
-
-	if ( olen > 0 && name[olen-1] == '-' )
-	    buf_ptr = StringCopyEM(buf_ptr,buf_end,name,olen-1);
-	else
-	{
-	    name[olen] = 0;
-	    buf_ptr = StringCat2E(buf_ptr,buf_end,"xn--",name);
-	}
+	buf_ptr = CopyLabel(buf_ptr,buf_end,res.ptr,res.len);
+	src = point;
     }
 
     *buf_ptr = 0;
@@ -202,6 +567,70 @@ uint Domain2ASCII
     return 0;
 }
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			DomainList2*()			///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static uint DomainList2Any
+(
+    mem_list_t		*dest,		// valid destination list
+    const mem_list_t	*src,		// valid source list
+    uint		factor,		// max grow factor of a single domain
+    uint (*func)( char*, int, const void*, int )
+)
+{
+    DASSERT(dest);
+    DASSERT(src);
+    DASSERT( dest != src );
+    DASSERT(func);
+
+    char local_buf[2000], *buf = local_buf;
+    uint buf_size = sizeof(local_buf), n_err = 0;
+
+    const mem_t *ptr = src->list, *end = ptr + src->used;
+    for ( ; ptr < end; ptr++ )
+    {
+	if (!ptr->ptr)
+	{
+	    AppendMemListN(dest,ptr,1,MEMLM_ALL);
+	    continue;
+	}
+
+	const uint need = factor * ptr->len + 20;
+	if ( need > buf_size )
+	{
+	    if ( buf != local_buf )
+		FREE(buf);
+	    buf_size = need;
+	    buf = MALLOC(buf_size);
+	}
+
+	if ( func(buf,buf_size,ptr->ptr,ptr->len) < ptr->len )
+	    n_err++;
+	const mem_t res = { buf, strlen(buf) };
+	AppendMemListN(dest,&res,1,MEMLM_ALL);
+    }
+
+    if ( buf != local_buf )
+	FREE(buf);
+    return n_err;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint DomainList2UTF8 ( mem_list_t *dest, const mem_list_t *src )
+{
+    return DomainList2Any(dest,src,4,Domain2UTF8);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint DomainList2ASCII ( mem_list_t *dest, const mem_list_t *src )
+{
+    return DomainList2Any(dest,src,8,Domain2ASCII);
+}
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    E N D			///////////////
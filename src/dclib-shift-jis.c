@@ -39,7 +39,7 @@
 
 #include "dclib/dclib-basics.h"
 //#include "dclib-debug.h"
-//#include "dclib-utf8.h"
+#include "dclib/dclib-utf8.h"
 
 //
 ///////////////////////////////////////////////////////////////////////////////
@@ -1220,6 +1220,3204 @@ static const shift_jis_list_t shift_jis_list[] =
 	{0,0,0,0,0}
 };
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			shift_jis_rev_*[]		///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Reverse mapping UTF-16 -> Shift-JIS as two-level table, derived from the
+// tables above (doubles first, then singles). The high byte of the UTF-16
+// code selects a page by shift_jis_rev_index[] (0: no page, all invalid),
+// the low byte the element of that page.
+// => Keep in sync with shift_jis_single[] and shift_jis_double_*[].
+
+static const u8 shift_jis_rev_index[0x100] =
+{
+	  1,  0,  0,  2,  3,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 00..0f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 10..1f
+	  4,  5,  6,  7,  0,  8,  9,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 20..2f
+	 10,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 30..3f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0, 11, 12, // 40..4f
+	 13, 14, 15, 16, 17, 18, 19, 20,   21, 22, 23, 24, 25, 26, 27, 28, // 50..5f
+	 29, 30, 31, 32, 33, 34, 35, 36,   37, 38, 39, 40, 41, 42, 43, 44, // 60..6f
+	 45, 46, 47, 48, 49, 50, 51, 52,   53, 54, 55, 56, 57, 58, 59, 60, // 70..7f
+	 61, 62, 63, 64, 65, 66, 67, 68,   69, 70, 71, 72, 73, 74, 75, 76, // 80..8f
+	 77, 78, 79, 80, 81, 82, 83, 84,   85, 86, 87, 88, 89, 90, 91, 92, // 90..9f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // a0..af
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // b0..bf
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // c0..cf
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // d0..df
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // e0..ef
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0, 93, // f0..ff
+};
+
+//-----------------------------------------------------------------------------
+
+static const u16 shift_jis_rev_page[93][0x100] =
+{
+    { //   1: 0000..00ff
+	   0x0,   0x1,   0x2,   0x3,    0x4,   0x5,   0x6,   0x7, // 0000..0007
+	   0x8,   0x9,   0xa,   0xb,    0xc,   0xd,   0xe,   0xf, // 0008..000f
+	  0x10,  0x11,  0x12,  0x13,   0x14,  0x15,  0x16,  0x17, // 0010..0017
+	  0x18,  0x19,  0x1a,  0x1b,   0x1c,  0x1d,  0x1e,  0x1f, // 0018..001f
+	  0x20,  0x21,  0x22,  0x23,   0x24,  0x25,  0x26,  0x27, // 0020..0027
+	  0x28,  0x29,  0x2a,  0x2b,   0x2c,  0x2d,  0x2e,  0x2f, // 0028..002f
+	  0x30,  0x31,  0x32,  0x33,   0x34,  0x35,  0x36,  0x37, // 0030..0037
+	  0x38,  0x39,  0x3a,  0x3b,   0x3c,  0x3d,  0x3e,  0x3f, // 0038..003f
+	  0x40,  0x41,  0x42,  0x43,   0x44,  0x45,  0x46,  0x47, // 0040..0047
+	  0x48,  0x49,  0x4a,  0x4b,   0x4c,  0x4d,  0x4e,  0x4f, // 0048..004f
+	  0x50,  0x51,  0x52,  0x53,   0x54,  0x55,  0x56,  0x57, // 0050..0057
+	  0x58,  0x59,  0x5a,  0x5b,    INV,  0x5d,  0x5e,  0x5f, // 0058..005f
+	  0x60,  0x61,  0x62,  0x63,   0x64,  0x65,  0x66,  0x67, // 0060..0067
+	  0x68,  0x69,  0x6a,  0x6b,   0x6c,  0x6d,  0x6e,  0x6f, // 0068..006f
+	  0x70,  0x71,  0x72,  0x73,   0x74,  0x75,  0x76,  0x77, // 0070..0077
+	  0x78,  0x79,  0x7a,  0x7b,   0x7c,  0x7d,   INV,  0x7f, // 0078..007f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0080..0087
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0088..008f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0090..0097
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0098..009f
+	   INV,   INV,0x8191,0x8192,    INV,  0x5c,   INV,0x8198, // 00a0..00a7
+	0x814e,   INV,   INV,   INV, 0x81ca,   INV,   INV,   INV, // 00a8..00af
+	0x818b,0x817d,   INV,   INV, 0x814c,   INV,0x81f7,   INV, // 00b0..00b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00b8..00bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00c0..00c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00c8..00cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x817e, // 00d0..00d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00d8..00df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00e0..00e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00e8..00ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x8180, // 00f0..00f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 00f8..00ff
+    },
+    { //   2: 0300..03ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0300..0307
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0308..030f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0310..0317
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0318..031f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0320..0327
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0328..032f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0330..0337
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0338..033f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0340..0347
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0348..034f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0350..0357
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0358..035f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0360..0367
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0368..036f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0370..0377
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0378..037f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0380..0387
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0388..038f
+	   INV,0x839f,0x83a0,0x83a1, 0x83a2,0x83a3,0x83a4,0x83a5, // 0390..0397
+	0x83a6,0x83a7,0x83a8,0x83a9, 0x83aa,0x83ab,0x83ac,0x83ad, // 0398..039f
+	0x83ae,0x83af,   INV,0x83b0, 0x83b1,0x83b2,0x83b3,0x83b4, // 03a0..03a7
+	0x83b5,0x83b6,   INV,   INV,    INV,   INV,   INV,   INV, // 03a8..03af
+	   INV,0x83bf,0x83c0,0x83c1, 0x83c2,0x83c3,0x83c4,0x83c5, // 03b0..03b7
+	0x83c6,0x83c7,0x83c8,0x83c9, 0x83ca,0x83cb,0x83cc,0x83cd, // 03b8..03bf
+	0x83ce,0x83cf,   INV,0x83d0, 0x83d1,0x83d2,0x83d3,0x83d4, // 03c0..03c7
+	0x83d5,0x83d6,   INV,   INV,    INV,   INV,   INV,   INV, // 03c8..03cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 03d0..03d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 03d8..03df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 03e0..03e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 03e8..03ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 03f0..03f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 03f8..03ff
+    },
+    { //   3: 0400..04ff
+	   INV,0x8446,   INV,   INV,    INV,   INV,   INV,   INV, // 0400..0407
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0408..040f
+	0x8440,0x8441,0x8442,0x8443, 0x8444,0x8445,0x8447,0x8448, // 0410..0417
+	0x8449,0x844a,0x844b,0x844c, 0x844d,0x844e,0x844f,0x8450, // 0418..041f
+	0x8451,0x8452,0x8453,0x8454, 0x8455,0x8456,0x8457,0x8458, // 0420..0427
+	0x8459,0x845a,0x845b,0x845c, 0x845d,0x845e,0x845f,0x8460, // 0428..042f
+	0x8470,0x8471,0x8472,0x8473, 0x8474,0x8475,0x8477,0x8478, // 0430..0437
+	0x8479,0x847a,0x847b,0x847c, 0x847d,0x847e,0x8480,0x8481, // 0438..043f
+	0x8482,0x8483,0x8484,0x8485, 0x8486,0x8487,0x8488,0x8489, // 0440..0447
+	0x848a,0x848b,0x848c,0x848d, 0x848e,0x848f,0x8490,0x8491, // 0448..044f
+	   INV,0x8476,   INV,   INV,    INV,   INV,   INV,   INV, // 0450..0457
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0458..045f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0460..0467
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0468..046f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0470..0477
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0478..047f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0480..0487
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0488..048f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0490..0497
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 0498..049f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04a0..04a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04a8..04af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04b0..04b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04b8..04bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04c0..04c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04c8..04cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04d0..04d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04d8..04df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04e0..04e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04e8..04ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04f0..04f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 04f8..04ff
+    },
+    { //   4: 2000..20ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2000..2007
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2008..200f
+	0x815d,   INV,   INV,   INV,    INV,0x815c,0x8161,   INV, // 2010..2017
+	0x8165,0x8166,   INV,   INV, 0x8167,0x8168,   INV,   INV, // 2018..201f
+	0x81f5,0x81f6,   INV,   INV,    INV,0x8164,0x8163,   INV, // 2020..2027
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2028..202f
+	0x81f1,   INV,0x818c,0x818d,    INV,   INV,   INV,   INV, // 2030..2037
+	   INV,   INV,   INV,0x81a6,    INV,   INV,  0x7e,   INV, // 2038..203f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2040..2047
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2048..204f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2050..2057
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2058..205f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2060..2067
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2068..206f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2070..2077
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2078..207f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2080..2087
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2088..208f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2090..2097
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2098..209f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20a0..20a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20a8..20af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20b0..20b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20b8..20bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20c0..20c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20c8..20cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20d0..20d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20d8..20df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20e0..20e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20e8..20ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20f0..20f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 20f8..20ff
+    },
+    { //   5: 2100..21ff
+	   INV,   INV,   INV,0x818e,    INV,   INV,   INV,   INV, // 2100..2107
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2108..210f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2110..2117
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2118..211f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2120..2127
+	   INV,   INV,   INV,0x81f0,    INV,   INV,   INV,   INV, // 2128..212f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2130..2137
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2138..213f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2140..2147
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2148..214f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2150..2157
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2158..215f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2160..2167
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2168..216f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2170..2177
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2178..217f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2180..2187
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2188..218f
+	0x81a9,0x81aa,0x81a8,0x81ab,    INV,   INV,   INV,   INV, // 2190..2197
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2198..219f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21a0..21a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21a8..21af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21b0..21b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21b8..21bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21c0..21c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21c8..21cf
+	   INV,   INV,0x81cb,   INV, 0x81cc,   INV,   INV,   INV, // 21d0..21d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21d8..21df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21e0..21e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21e8..21ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21f0..21f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 21f8..21ff
+    },
+    { //   6: 2200..22ff
+	0x81cd,   INV,0x81dd,0x81ce,    INV,   INV,   INV,0x81de, // 2200..2207
+	0x81b8,   INV,   INV,0x81b9,    INV,   INV,   INV,   INV, // 2208..220f
+	   INV,   INV,0x817c,   INV,    INV,   INV,   INV,   INV, // 2210..2217
+	   INV,   INV,0x81e3,   INV,    INV,0x81e5,0x8187,   INV, // 2218..221f
+	0x81da,   INV,   INV,   INV,    INV,   INV,   INV,0x81c8, // 2220..2227
+	0x81c9,0x81bf,0x81be,0x81e7, 0x81e8,   INV,   INV,   INV, // 2228..222f
+	   INV,   INV,   INV,   INV, 0x8188,0x81e6,   INV,   INV, // 2230..2237
+	   INV,   INV,   INV,   INV,    INV,0x81e4,   INV,   INV, // 2238..223f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2240..2247
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2248..224f
+	   INV,   INV,0x81e0,   INV,    INV,   INV,   INV,   INV, // 2250..2257
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2258..225f
+	0x8182,0x81df,   INV,   INV,    INV,   INV,0x8185,0x8186, // 2260..2267
+	   INV,   INV,0x81e1,0x81e2,    INV,   INV,   INV,   INV, // 2268..226f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2270..2277
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2278..227f
+	   INV,   INV,0x81bc,0x81bd,    INV,   INV,0x81ba,0x81bb, // 2280..2287
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2288..228f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2290..2297
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2298..229f
+	   INV,   INV,   INV,   INV,    INV,0x81db,   INV,   INV, // 22a0..22a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22a8..22af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22b0..22b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22b8..22bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22c0..22c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22c8..22cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22d0..22d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22d8..22df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22e0..22e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22e8..22ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22f0..22f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 22f8..22ff
+    },
+    { //   7: 2300..23ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2300..2307
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2308..230f
+	   INV,   INV,0x81dc,   INV,    INV,   INV,   INV,   INV, // 2310..2317
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2318..231f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2320..2327
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2328..232f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2330..2337
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2338..233f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2340..2347
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2348..234f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2350..2357
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2358..235f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2360..2367
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2368..236f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2370..2377
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2378..237f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2380..2387
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2388..238f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2390..2397
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2398..239f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23a0..23a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23a8..23af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23b0..23b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23b8..23bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23c0..23c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23c8..23cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23d0..23d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23d8..23df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23e0..23e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23e8..23ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23f0..23f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 23f8..23ff
+    },
+    { //   8: 2500..25ff
+	0x849f,0x84aa,0x84a0,0x84ab,    INV,   INV,   INV,   INV, // 2500..2507
+	   INV,   INV,   INV,   INV, 0x84a1,   INV,   INV,0x84ac, // 2508..250f
+	0x84a2,   INV,   INV,0x84ad, 0x84a4,   INV,   INV,0x84af, // 2510..2517
+	0x84a3,   INV,   INV,0x84ae, 0x84a5,0x84ba,   INV,   INV, // 2518..251f
+	0x84b5,   INV,   INV,0x84b0, 0x84a7,0x84bc,   INV,   INV, // 2520..2527
+	0x84b7,   INV,   INV,0x84b2, 0x84a6,   INV,   INV,0x84b6, // 2528..252f
+	0x84bb,   INV,   INV,0x84b1, 0x84a8,   INV,   INV,0x84b8, // 2530..2537
+	0x84bd,   INV,   INV,0x84b3, 0x84a9,   INV,   INV,0x84b9, // 2538..253f
+	   INV,   INV,0x84be,   INV,    INV,   INV,   INV,   INV, // 2540..2547
+	   INV,   INV,   INV,0x84b4,    INV,   INV,   INV,   INV, // 2548..254f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2550..2557
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2558..255f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2560..2567
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2568..256f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2570..2577
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2578..257f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2580..2587
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2588..258f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2590..2597
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2598..259f
+	0x81a1,0x81a0,   INV,   INV,    INV,   INV,   INV,   INV, // 25a0..25a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 25a8..25af
+	   INV,   INV,0x81a3,0x81a2,    INV,   INV,   INV,   INV, // 25b0..25b7
+	   INV,   INV,   INV,   INV, 0x81a5,0x81a4,   INV,   INV, // 25b8..25bf
+	   INV,   INV,   INV,   INV,    INV,   INV,0x819f,0x819e, // 25c0..25c7
+	   INV,   INV,   INV,0x819b,    INV,   INV,0x819d,0x819c, // 25c8..25cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 25d0..25d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 25d8..25df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 25e0..25e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x81fc, // 25e8..25ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 25f0..25f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 25f8..25ff
+    },
+    { //   9: 2600..26ff
+	   INV,   INV,   INV,   INV,    INV,0x819a,0x8199,   INV, // 2600..2607
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2608..260f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2610..2617
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2618..261f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2620..2627
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2628..262f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2630..2637
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2638..263f
+	0x818a,   INV,0x8189,   INV,    INV,   INV,   INV,   INV, // 2640..2647
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2648..264f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2650..2657
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2658..265f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2660..2667
+	   INV,   INV,0x81f4,   INV,    INV,0x81f3,   INV,0x81f2, // 2668..266f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2670..2677
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2678..267f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2680..2687
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2688..268f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2690..2697
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 2698..269f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26a0..26a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26a8..26af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26b0..26b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26b8..26bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26c0..26c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26c8..26cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26d0..26d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26d8..26df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26e0..26e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26e8..26ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26f0..26f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 26f8..26ff
+    },
+    { //  10: 3000..30ff
+	0x8140,0x8141,0x8142,0x8156,    INV,0x8158,0x8159,0x815a, // 3000..3007
+	0x8171,0x8172,0x8173,0x8174, 0x8175,0x8176,0x8177,0x8178, // 3008..300f
+	0x8179,0x817a,0x81a7,0x81ac, 0x816b,0x816c,   INV,   INV, // 3010..3017
+	   INV,   INV,   INV,   INV, 0x8160,   INV,   INV,   INV, // 3018..301f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 3020..3027
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 3028..302f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 3030..3037
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 3038..303f
+	   INV,0x829f,0x82a0,0x82a1, 0x82a2,0x82a3,0x82a4,0x82a5, // 3040..3047
+	0x82a6,0x82a7,0x82a8,0x82a9, 0x82aa,0x82ab,0x82ac,0x82ad, // 3048..304f
+	0x82ae,0x82af,0x82b0,0x82b1, 0x82b2,0x82b3,0x82b4,0x82b5, // 3050..3057
+	0x82b6,0x82b7,0x82b8,0x82b9, 0x82ba,0x82bb,0x82bc,0x82bd, // 3058..305f
+	0x82be,0x82bf,0x82c0,0x82c1, 0x82c2,0x82c3,0x82c4,0x82c5, // 3060..3067
+	0x82c6,0x82c7,0x82c8,0x82c9, 0x82ca,0x82cb,0x82cc,0x82cd, // 3068..306f
+	0x82ce,0x82cf,0x82d0,0x82d1, 0x82d2,0x82d3,0x82d4,0x82d5, // 3070..3077
+	0x82d6,0x82d7,0x82d8,0x82d9, 0x82da,0x82db,0x82dc,0x82dd, // 3078..307f
+	0x82de,0x82df,0x82e0,0x82e1, 0x82e2,0x82e3,0x82e4,0x82e5, // 3080..3087
+	0x82e6,0x82e7,0x82e8,0x82e9, 0x82ea,0x82eb,0x82ec,0x82ed, // 3088..308f
+	0x82ee,0x82ef,0x82f0,0x82f1,    INV,   INV,   INV,   INV, // 3090..3097
+	   INV,   INV,   INV,0x814a, 0x814b,0x8154,0x8155,   INV, // 3098..309f
+	   INV,0x8340,0x8341,0x8342, 0x8343,0x8344,0x8345,0x8346, // 30a0..30a7
+	0x8347,0x8348,0x8349,0x834a, 0x834b,0x834c,0x834d,0x834e, // 30a8..30af
+	0x834f,0x8350,0x8351,0x8352, 0x8353,0x8354,0x8355,0x8356, // 30b0..30b7
+	0x8357,0x8358,0x8359,0x835a, 0x835b,0x835c,0x835d,0x835e, // 30b8..30bf
+	0x835f,0x8360,0x8361,0x8362, 0x8363,0x8364,0x8365,0x8366, // 30c0..30c7
+	0x8367,0x8368,0x8369,0x836a, 0x836b,0x836c,0x836d,0x836e, // 30c8..30cf
+	0x836f,0x8370,0x8371,0x8372, 0x8373,0x8374,0x8375,0x8376, // 30d0..30d7
+	0x8377,0x8378,0x8379,0x837a, 0x837b,0x837c,0x837d,0x837e, // 30d8..30df
+	0x8380,0x8381,0x8382,0x8383, 0x8384,0x8385,0x8386,0x8387, // 30e0..30e7
+	0x8388,0x8389,0x838a,0x838b, 0x838c,0x838d,0x838e,0x838f, // 30e8..30ef
+	0x8390,0x8391,0x8392,0x8393, 0x8394,0x8395,0x8396,   INV, // 30f0..30f7
+	   INV,   INV,   INV,0x8145, 0x815b,0x8152,0x8153,   INV, // 30f8..30ff
+    },
+    { //  11: 4e00..4eff
+	0x88ea,0x929a,   INV,0x8eb5,    INV,   INV,   INV,0x969c, // 4e00..4e07
+	0x8fe4,0x8e4f,0x8fe3,0x89ba,    INV,0x9573,0x975e,   INV, // 4e08..4e0f
+	0x98a0,0x894e,   INV,   INV, 0x8a8e,0x98a1,0x90a2,0x99c0, // 4e10..4e17
+	0x8b75,0x95b8,   INV,   INV,    INV,   INV,0x8fe5,   INV, // 4e18..4e1f
+	   INV,0x97bc,   INV,   INV,    INV,   INV,0x95c0,   INV, // 4e20..4e27
+	   INV,   INV,0x98a2,   INV,    INV,0x9286,   INV,   INV, // 4e28..4e2f
+	   INV,0x98a3,0x8bf8,   INV,    INV,   INV,0x98a4,   INV, // 4e30..4e37
+	0x8adb,0x924f,   INV,0x8ee5, 0x98a5,   INV,   INV,0x98a6, // 4e38..4e3f
+	   INV,   INV,0x98a7,0x9454,    INV,0x8b76,   INV,   INV, // 4e40..4e47
+	   INV,   INV,   INV,0x9456,    INV,0x93e1,0x8cc1,0x9652, // 4e48..4e4f
+	   INV,   INV,   INV,   INV,    INV,0xe568,0x98a8,0x8fe6, // 4e50..4e57
+	0x98a9,0x89b3,   INV,   INV,    INV,0x8be3,0x8cee,0x96e7, // 4e58..4e5f
+	   INV,   INV,0x9ba4,   INV,    INV,   INV,   INV,   INV, // 4e60..4e67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 4e68..4e6f
+	   INV,0x9790,   INV,0x93fb,    INV,   INV,   INV,   INV, // 4e70..4e77
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8aa3,   INV, // 4e78..4e7f
+	0x8b54,   INV,0x98aa,   INV,    INV,0x98ab,0x97b9,   INV, // 4e80..4e87
+	0x975c,0x9188,0x98ad,0x8e96, 0x93f1,   INV,0x98b0,   INV, // 4e88..4e8f
+	   INV,0x895d,0x8cdd,   INV, 0x8cdc,0x88e4,   INV,   INV, // 4e90..4e97
+	0x986a,0x9869,   INV,0x8db1, 0x889f,   INV,0x98b1,0x98b2, // 4e98..4e9f
+	0x98b3,0x9653,0x98b4,   INV, 0x8cf0,0x88e5,0x9692,   INV, // 4ea0..4ea7
+	0x8b9c,   INV,   INV,0x8b9d, 0x8b9e,0x92e0,0x97ba,   INV, // 4ea8..4eaf
+	0x98b5,   INV,   INV,0x98b6,    INV,   INV,0x98b7,   INV, // 4eb0..4eb7
+	   INV,   INV,0x906c,   INV,    INV,   INV,   INV,   INV, // 4eb8..4ebf
+	0x8f59,0x906d,0x98bc,   INV, 0x98ba,   INV,0x98bb,0x8b77, // 4ec0..4ec7
+	   INV,   INV,0x8da1,0x89ee,    INV,0x98b9,0x98b8,0x95a7, // 4ec8..4ecf
+	   INV,   INV,   INV,   INV, 0x8e65,0x8e64,0x91bc,0x98bd, // 4ed0..4ed7
+	0x9574,0x90e5,   INV,   INV,    INV,0x8157,0x98be,0x98c0, // 4ed8..4edf
+	   INV,   INV,   INV,0x91e3, 0x97df,0x88c8,   INV,   INV, // 4ee0..4ee7
+	   INV,   INV,   INV,   INV,    INV,0x98bf,0x89bc,   INV, // 4ee8..4eef
+	0x8bc2,   INV,0x9287,   INV,    INV,   INV,0x8c8f,0x98c1, // 4ef0..4ef7
+	   INV,   INV,   INV,0x9443,    INV,   INV,   INV,   INV, // 4ef8..4eff
+    },
+    { //  12: 4f00..4fff
+	   INV,0x8ae9,   INV,   INV,    INV,   INV,   INV,   INV, // 4f00..4f07
+	   INV,0x98c2,0x88c9,   INV,    INV,0x8cde,0x8aea,0x959a, // 4f08..4f0f
+	0x94b0,0x8b78,   INV,   INV,    INV,   INV,   INV,   INV, // 4f10..4f17
+	   INV,   INV,0x89ef,   INV, 0x98e5,0x9360,   INV,   INV, // 4f18..4f1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 4f20..4f27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x948c, // 4f28..4f2f
+	0x98c4,   INV,   INV,   INV, 0x94ba,   INV,0x97e0,   INV, // 4f30..4f37
+	0x904c,   INV,0x8e66,   INV, 0x8e97,0x89be,   INV,   INV, // 4f38..4f3f
+	   INV,   INV,   INV,0x92cf,    INV,   INV,0x9241,0x98c8, // 4f40..4f47
+	   INV,   INV,   INV,   INV,    INV,0x88ca,0x92e1,0x8f5a, // 4f48..4f4f
+	0x8db2,0x9743,   INV,0x91cc,    INV,0x89bd,   INV,0x98c7, // 4f50..4f57
+	   INV,0x975d,0x98c3,0x98c5, 0x8dec,0x98c6,0x9b43,   INV, // 4f58..4f5f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 4f60..4f67
+	   INV,0x98ce,   INV,   INV,    INV,   INV,   INV,0x98d1, // 4f68..4f6f
+	0x98cf,   INV,   INV,0x89c0,    INV,0x95b9,0x98c9,   INV, // 4f70..4f77
+	   INV,   INV,   INV,0x98cd, 0x8cf1,   INV,   INV,0x8e67, // 4f78..4f7f
+	   INV,   INV,   INV,0x8aa4,    INV,   INV,0x98d2,   INV, // 4f80..4f87
+	0x98ca,   INV,   INV,0x97e1,    INV,0x8e98,   INV,0x98cb, // 4f88..4f8f
+	   INV,0x98d0,   INV,   INV,    INV,   INV,0x98d3,   INV, // 4f90..4f97
+	0x98cc,   INV,   INV,0x8b9f,    INV,0x88cb,   INV,   INV, // 4f98..4f9f
+	0x8ba0,0x89bf,   INV,   INV,    INV,   INV,   INV,   INV, // 4fa0..4fa7
+	   INV,   INV,   INV,0x9b44,    INV,0x9699,0x958e,0x8cf2, // 4fa8..4faf
+	   INV,   INV,   INV,   INV,    INV,0x904e,0x97b5,   INV, // 4fb0..4fb7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x95d6, // 4fb8..4fbf
+	   INV,   INV,0x8c57,0x91a3, 0x89e2,   INV,   INV,   INV, // 4fc0..4fc7
+	   INV,   INV,0x8f72,   INV,    INV,   INV,0x98d7,   INV, // 4fc8..4fcf
+	0x98dc,0x98da,   INV,   INV, 0x98d5,   INV,   INV,0x91ad, // 4fd0..4fd7
+	0x98d8,   INV,0x98db,0x98d9,    INV,0x95db,   INV,0x98d6, // 4fd8..4fdf
+	   INV,0x904d,   INV,0x9693, 0x98dd,0x98de,   INV,   INV, // 4fe0..4fe7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8f43,0x98eb, // 4fe8..4fef
+	   INV,   INV,   INV,0x946f,    INV,0x9555,0x98e6,   INV, // 4ff0..4ff7
+	0x95ee,   INV,0x89b4,   INV,    INV,   INV,0x98ea,   INV, // 4ff8..4fff
+    },
+    { //  13: 5000..50ff
+	   INV,   INV,   INV,   INV,    INV,0x98e4,0x98ed,   INV, // 5000..5007
+	   INV,0x9171,   INV,0x8cc2,    INV,0x947b,   INV,0xe0c5, // 5008..500f
+	   INV,0x98ec,0x937c,   INV, 0x98e1,   INV,0x8cf4,   INV, // 5010..5017
+	   INV,0x8cf3,0x98df,   INV,    INV,   INV,   INV,0x8ed8, // 5018..501f
+	   INV,0x98e7,   INV,0x95ed, 0x926c,0x98e3,0x8c91,   INV, // 5020..5027
+	0x98e0,0x98e8,0x98e2,0x97cf, 0x98e9,0x9860,   INV,   INV, // 5028..502f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8be4,   INV, // 5030..5037
+	   INV,0x8c90,   INV,   INV,    INV,   INV,   INV,   INV, // 5038..503f
+	   INV,   INV,   INV,0x98ee,    INV,   INV,   INV,0x98ef, // 5040..5047
+	0x98f3,0x88cc,   INV,   INV,    INV,   INV,   INV,0x95ce, // 5048..504f
+	0x98f2,   INV,   INV,   INV,    INV,0x98f1,0x98f5,   INV, // 5050..5057
+	   INV,   INV,0x98f4,   INV, 0x92e2,   INV,   INV,   INV, // 5058..505f
+	   INV,   INV,   INV,   INV,    INV,0x8c92,   INV,   INV, // 5060..5067
+	   INV,   INV,   INV,   INV, 0x98f6,   INV,   INV,   INV, // 5068..506f
+	   INV,   INV,0x8ec3,   INV, 0x91a4,0x92e3,0x8bf4,   INV, // 5070..5077
+	0x98f7,   INV,   INV,   INV,    INV,0x8b55,   INV,   INV, // 5078..507f
+	0x98f8,   INV,   INV,   INV,    INV,0x98fa,   INV,   INV, // 5080..5087
+	   INV,   INV,   INV,   INV,    INV,0x9654,   INV,   INV, // 5088..508f
+	   INV,0x8c86,   INV,   INV,    INV,   INV,   INV,   INV, // 5090..5097
+	0x8e50,0x94f5,0x98f9,   INV,    INV,   INV,   INV,   INV, // 5098..509f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 50a0..50a7
+	   INV,   INV,   INV,   INV, 0x8dc3,0x9762,   INV,   INV, // 50a8..50af
+	   INV,   INV,0x98fc,0x9942, 0x98fb,0x8dc2,   INV,0x8f9d, // 50b0..50b7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8c58,   INV, // 50b8..50bf
+	   INV,   INV,0x9943,   INV,    INV,0x8bcd,   INV,   INV, // 50c0..50c7
+	   INV,0x9940,0x9941,   INV,    INV,0x93ad,   INV,0x919c, // 50c8..50cf
+	   INV,0x8ba1,   INV,   INV,    INV,0x966c,0x9944,   INV, // 50d0..50d7
+	   INV,   INV,0x97bb,   INV,    INV,   INV,0x9945,   INV, // 50d8..50df
+	   INV,   INV,   INV,0x9948,    INV,0x9946,   INV,0x916d, // 50e0..50e7
+	   INV,   INV,   INV,   INV,    INV,0x9947,0x9949,   INV, // 50e8..50ef
+	   INV,   INV,   INV,   INV,    INV,0x994b,   INV,   INV, // 50f0..50f7
+	   INV,0x994a,   INV,0x95c6,    INV,   INV,   INV,   INV, // 50f8..50ff
+    },
+    { //  14: 5100..51ff
+	0x8b56,0x994d,0x994e,   INV, 0x89ad,   INV,   INV,   INV, // 5100..5107
+	   INV,0x994c,   INV,   INV,    INV,   INV,   INV,   INV, // 5108..510f
+	   INV,   INV,0x8ef2,   INV, 0x9951,0x9950,0x994f,   INV, // 5110..5117
+	0x98d4,   INV,0x9952,   INV,    INV,   INV,   INV,0x8f9e, // 5118..511f
+	   INV,0x9953,   INV,   INV,    INV,   INV,   INV,   INV, // 5120..5127
+	   INV,   INV,0x9744,   INV,    INV,   INV,   INV,   INV, // 5128..512f
+	   INV,   INV,0x96d7,   INV,    INV,   INV,   INV,0x9955, // 5130..5137
+	   INV,   INV,0x9954,0x9957, 0x9956,   INV,   INV,0x9958, // 5138..513f
+	0x9959,0x88f2,   INV,0x8cb3, 0x8c5a,0x8f5b,0x929b,0x8ba2, // 5140..5147
+	0x90e6,0x8cf5,   INV,0x8d8e, 0x995b,0x96c6,0x9365,   INV, // 5148..514f
+	0x8e99,   INV,0x995a,   INV, 0x995c,   INV,   INV,   INV, // 5150..5157
+	   INV,   INV,0x937d,   INV, 0x8a95,   INV,   INV,   INV, // 5158..515f
+	   INV,   INV,0x995d,   INV,    INV,0x93fc,   INV,   INV, // 5160..5167
+	0x9153,0x995f,0x9960,0x94aa, 0x8cf6,0x985a,0x9961,   INV, // 5168..516f
+	   INV,0x8ba4,   INV,   INV,    INV,0x95ba,0x91b4,0x8bef, // 5170..5177
+	0x9354,   INV,   INV,   INV, 0x8c93,   INV,   INV,   INV, // 5178..517f
+	0x9962,   INV,0x9963,   INV,    INV,0x93e0,0x897e,   INV, // 5180..5187
+	   INV,0x9966,0x8dfb,   INV, 0x9965,0x8dc4,   INV,0x9967, // 5188..518f
+	0xe3ec,0x9968,0x9660,0x9969,    INV,0x996a,0x996b,0x8fe7, // 5190..5197
+	   INV,0x8eca,   INV,   INV,    INV,   INV,   INV,   INV, // 5198..519f
+	0x8aa5,   INV,0x996e,   INV, 0x996c,0x96bb,0x996d,   INV, // 51a0..51a7
+	0x9579,0x996f,0x9970,0x9971, 0x937e,   INV,   INV,   INV, // 51a8..51af
+	0x9975,0x9973,0x9974,0x9972, 0x8de1,0x9976,0x96e8,0x97e2, // 51b0..51b7
+	   INV,   INV,   INV,   INV,    INV,0x9977,   INV,   INV, // 51b8..51bf
+	   INV,   INV,   INV,   INV, 0x90a6,0x9978,0x8f79,   INV, // 51c0..51c7
+	   INV,0x9979,   INV,0x929c, 0x97bd,0x9380,   INV,   INV, // 51c8..51cf
+	   INV,   INV,   INV,   INV,    INV,   INV,0x99c3,   INV, // 51d0..51d7
+	   INV,   INV,   INV,0x997a, 0xeaa3,0x8bc3,   INV,   INV, // 51d8..51df
+	0x997b,0x967d,   INV,   INV,    INV,   INV,0x8f88,0x91fa, // 51e0..51e7
+	   INV,0x997d,0x93e2,   INV,    INV,0x997e,   INV,   INV, // 51e8..51ef
+	0x9980,0x8a4d,   INV,   INV,    INV,0x9981,0x8ba5,   INV, // 51f0..51f7
+	0x93ca,0x899a,0x8f6f,   INV,    INV,0x949f,0x9982,   INV, // 51f8..51ff
+    },
+    { //  15: 5200..52ff
+	0x9381,   INV,   INV,0x906e, 0x9983,   INV,0x95aa,0x90d8, // 5200..5207
+	0x8aa0,   INV,0x8aa7,0x9984,    INV,   INV,0x9986,   INV, // 5208..520f
+	   INV,0x8c59,   INV,   INV, 0x9985,   INV,   INV,0x97f1, // 5210..5217
+	   INV,   INV,   INV,   INV,    INV,0x8f89,   INV,   INV, // 5218..521f
+	   INV,   INV,   INV,   INV, 0x94bb,0x95ca,   INV,0x9987, // 5220..5227
+	   INV,0x9798,0x9988,   INV,    INV,   INV,0x9989,   INV, // 5228..522f
+	0x939e,   INV,   INV,0x998a,    INV,   INV,0x90a7,0x8dfc, // 5230..5237
+	0x8c94,0x998b,0x8e68,0x8d8f,    INV,   INV,   INV,   INV, // 5238..523f
+	   INV,   INV,   INV,0x92e4, 0x998d,   INV,   INV,0x91a5, // 5240..5247
+	   INV,   INV,0x8ded,0x998e, 0x998f,0x914f,   INV,0x998c, // 5248..524f
+	   INV,   INV,   INV,   INV, 0x9991,   INV,0x9655,   INV, // 5250..5257
+	   INV,   INV,   INV,0x8d84,    INV,   INV,0x9990,   INV, // 5258..525f
+	   INV,   INV,   INV,0x8c95, 0x8ddc,0x948d,   INV,   INV, // 5260..5267
+	   INV,0x9994,0x9992,   INV,    INV,   INV,   INV,0x959b, // 5268..526f
+	0x8fe8,0x999b,0x8a84,0x9995, 0x9993,0x916e,   INV,   INV, // 5270..5277
+	   INV,   INV,   INV,   INV,    INV,0x9997,   INV,0x9996, // 5278..527f
+	   INV,   INV,   INV,0x8a63,    INV,   INV,   INV,0x8c80, // 5280..5287
+	0x999c,0x97ab,   INV,   INV,    INV,0x9998,   INV,   INV, // 5288..528f
+	   INV,0x999d,0x999a,   INV, 0x9999,   INV,   INV,   INV, // 5290..5297
+	   INV,   INV,   INV,0x97cd,    INV,   INV,   INV,0x8cf7, // 5298..529f
+	0x89c1,   INV,   INV,0x97f2,    INV,   INV,   INV,   INV, // 52a0..52a7
+	   INV,0x8f95,0x9377,0x8d85, 0x99a0,0x99a1,   INV,   INV, // 52a8..52af
+	   INV,0x97e3,   INV,   INV, 0x984a,0x99a3,   INV,   INV, // 52b0..52b7
+	   INV,0x8cf8,   INV,   INV, 0x99a2,   INV,0x8a4e,   INV, // 52b8..52bf
+	   INV,0x99a4,   INV,0x9675,    INV,0x92ba,   INV,0x9745, // 52c0..52c7
+	   INV,0x95d7,   INV,   INV,    INV,0x99a5,   INV,   INV, // 52c8..52cf
+	   INV,   INV,0xe8d3,   INV,    INV,0x93ae,   INV,0x99a6, // 52d0..52d7
+	0x8aa8,0x96b1,   INV,   INV,    INV,0x8f9f,0x99a7,0x95e5, // 52d8..52df
+	0x99ab,   INV,0x90a8,0x99a8, 0x8bce,   INV,0x99a9,0x8aa9, // 52e0..52e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 52e8..52ef
+	   INV,   INV,0x8c4d,0x99ac,    INV,0x99ad,   INV,   INV, // 52f0..52f7
+	0x99ae,0x99af,0x8ed9,   INV,    INV,   INV,0x8cf9,0x96dc, // 52f8..52ff
+    },
+    { //  16: 5300..53ff
+	   INV,0x96e6,0x93f5,   INV,    INV,0x95ef,0x99b0,   INV, // 5300..5307
+	0x99b1,   INV,   INV,   INV,    INV,0x99b3,   INV,0x99b5, // 5308..530f
+	0x99b4,   INV,   INV,   INV,    INV,0x99b6,0x89bb,0x966b, // 5310..5317
+	   INV,0x8dfa,0x99b7,   INV,    INV,0x9178,   INV,   INV, // 5318..531f
+	0x8fa0,0x8ba7,   INV,0x99b8,    INV,   INV,   INV,   INV, // 5320..5327
+	   INV,   INV,0x94d9,   INV,    INV,   INV,   INV,0x99b9, // 5328..532f
+	   INV,0x99ba,   INV,0x99bb,    INV,   INV,   INV,   INV, // 5330..5337
+	0x99bc,0x9543,0x8be6,0x88e3,    INV,   INV,   INV,0x93bd, // 5338..533f
+	0x99bd,0x8f5c,   INV,0x90e7,    INV,0x99bf,0x99be,0x8fa1, // 5340..5347
+	0x8cdf,0x99c1,0x94bc,   INV,    INV,0x99c2,   INV,   INV, // 5348..534f
+	   INV,0x94da,0x91b2,0x91ec, 0x8ba6,   INV,   INV,0x93ec, // 5350..5357
+	0x9250,   INV,0x948e,   INV, 0x966d,   INV,0x99c4,   INV, // 5358..535f
+	0x90e8,   INV,   INV,   INV,    INV,   INV,0x8c54,   INV, // 5360..5367
+	   INV,0x99c5,   INV,   INV,    INV,   INV,0x99c6,0x894b, // 5368..536f
+	0x88f3,0x8aeb,   INV,0x91a6, 0x8b70,0x9791,   INV,0x99c9, // 5370..5377
+	0x89b5,   INV,   INV,0x99c8,    INV,   INV,   INV,0x8ba8, // 5378..537f
+	   INV,   INV,0x99ca,   INV, 0x96ef,   INV,   INV,   INV, // 5380..5387
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5388..538f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x99cb,   INV, // 5390..5397
+	0x97d0,   INV,0x8cfa,   INV,    INV,   INV,   INV,0x8cb4, // 5398..539f
+	0x99cc,   INV,   INV,   INV,    INV,0x99ce,0x99cd,   INV, // 53a0..53a7
+	0x907e,0x8958,   INV,   INV,    INV,0x897d,0x99cf,   INV, // 53a8..53af
+	0x99d0,   INV,   INV,0x8cb5,    INV,   INV,0x99d1,   INV, // 53b0..53b7
+	   INV,   INV,   INV,0x8b8e,    INV,   INV,   INV,   INV, // 53b8..53bf
+	   INV,   INV,0x8e51,0x99d2,    INV,   INV,   INV,   INV, // 53c0..53c7
+	0x9694,0x8db3,0x8b79,0x9746, 0x916f,0x94bd,0x8efb,   INV, // 53c8..53cf
+	   INV,   INV,   INV,   INV, 0x8f66,   INV,0x8ee6,0x8ef3, // 53d0..53d7
+	   INV,0x8f96,   INV,0x94be,    INV,   INV,   INV,0x99d5, // 53d8..53df
+	   INV,0x8962,0x9170,0x8cfb, 0x8cc3,0x8be5,   INV,   INV, // 53e0..53e7
+	0x99d9,0x9240,0x91fc,0x8ba9, 0x8fa2,0x99da,0x99d8,0x89c2, // 53e8..53ef
+	0x91e4,0x8eb6,0x8e6a,0x8945,    INV,   INV,0x8a90,0x8d86, // 53f0..53f7
+	0x8e69,   INV,0x99db,   INV,    INV,   INV,   INV,   INV, // 53f8..53ff
+    },
+    { //  17: 5400..54ff
+	   INV,0x99dc,   INV,0x8b68, 0x8a65,   INV,   INV,   INV, // 5400..5407
+	0x8d87,0x8b67,0x92dd,0x8944, 0x93af,0x96bc,0x8d40,0x9799, // 5408..540f
+	0x9366,0x8cfc,   INV,   INV,    INV,   INV,   INV,   INV, // 5410..5417
+	   INV,   INV,   INV,0x8c4e,    INV,0x99e5,   INV,0x8be1, // 5418..541f
+	0x9669,   INV,   INV,   INV,    INV,   INV,0x94db,   INV, // 5420..5427
+	   INV,0x99e4,   INV,0x8adc, 0x99df,0x99e0,0x99e2,   INV, // 5428..542f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x99e3,   INV, // 5430..5437
+	0x8b7a,0x9081,   INV,0x95ab, 0x99e1,0x99dd,0x8ce1,   INV, // 5438..543f
+	0x99de,   INV,0x9843,   INV,    INV,   INV,0x95f0,   INV, // 5440..5447
+	0x92e6,0x8ce0,0x8d90,   INV,    INV,   INV,0x99e6,   INV, // 5448..544f
+	   INV,0x93db,   INV,   INV,    INV,   INV,   INV,   INV, // 5450..5457
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x99ea, // 5458..545f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5460..5467
+	0x8efc,   INV,0x8ef4,   INV,    INV,   INV,   INV,   INV, // 5468..546f
+	0x99ed,0x99eb,   INV,0x96a1,    INV,0x99e8,0x99f1,0x99ec, // 5470..5477
+	   INV,   INV,   INV,0x99ef, 0x8cc4,0x96bd,   INV,   INV, // 5478..547f
+	0x99f0,   INV,   INV,   INV, 0x99f2,   INV,0x99f4,   INV, // 5480..5487
+	   INV,   INV,   INV,0x8dee, 0x9861,   INV,0x99e9,0x99e7, // 5488..548f
+	0x99f3,   INV,0x99ee,   INV,    INV,   INV,   INV,   INV, // 5490..5497
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5498..549f
+	   INV,   INV,0x99f6,   INV, 0x9a42,0x99f8,   INV,   INV, // 54a0..54a7
+	0x99fc,   INV,   INV,0x9a40, 0x99f9,   INV,   INV,0x9a5d, // 54a8..54af
+	   INV,   INV,0x8de7,0x8a50,    INV,   INV,   INV,   INV, // 54b0..54b7
+	0x99f7,   INV,   INV,   INV, 0x9a44,0x88f4,0x9a43,   INV, // 54b8..54bf
+	0x88a3,0x9569,0x9a41,   INV, 0x99fa,   INV,   INV,0x99f5, // 54c0..54c7
+	0x99fb,0x8dc6,   INV,   INV,    INV,   INV,   INV,   INV, // 54c8..54cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 54d0..54d7
+	0x9a45,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 54d8..54df
+	   INV,0x88f5,0x9a4e,   INV,    INV,0x9a46,0x9a47,   INV, // 54e0..54e7
+	0x8fa3,0x9689,   INV,   INV,    INV,0x9a4c,0x9a4b,   INV, // 54e8..54ef
+	   INV,   INV,0x934e,   INV,    INV,   INV,   INV,   INV, // 54f0..54f7
+	   INV,   INV,0x9a4d,   INV,    INV,0x9a4a,   INV,   INV, // 54f8..54ff
+    },
+    { //  18: 5500..55ff
+	   INV,   INV,   INV,   INV, 0x8953,   INV,0x8db4,0x904f, // 5500..5507
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9a48, // 5508..550f
+	0x9382,   INV,   INV,   INV, 0x9a49,   INV,0x88a0,   INV, // 5510..5517
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5518..551f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5520..5527
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9a53,0x9742, // 5528..552f
+	   INV,0x8fa5,   INV,0x9a59,    INV,   INV,   INV,   INV, // 5530..5537
+	0x9a58,0x9a4f,   INV,   INV,    INV,   INV,0x91c1,   INV, // 5538..553f
+	0x9a50,   INV,   INV,   INV, 0x91ed,0x9a55,0x8fa4,   INV, // 5540..5547
+	   INV,   INV,   INV,   INV, 0x9a52,   INV,   INV,0x96e2, // 5548..554f
+	   INV,   INV,   INV,0x8c5b,    INV,   INV,0x9a56,0x9a57, // 5550..5557
+	   INV,   INV,   INV,   INV, 0x9a54,0x9a5a,   INV,   INV, // 5558..555f
+	   INV,   INV,   INV,0x9a51,    INV,   INV,   INV,   INV, // 5560..5567
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5568..556f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5570..5577
+	   INV,   INV,   INV,0x9a60, 0x9a65,   INV,0x9a61,   INV, // 5578..557f
+	0x9a5c,   INV,   INV,0x9a66, 0x9150,   INV,   INV,0x9a68, // 5580..5587
+	   INV,0x8d41,0x9a5e,0x929d,    INV,   INV,   INV,   INV, // 5588..558f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5590..5597
+	0x9a62,0x9a5b,0x8aab,   INV, 0x8aec,0x8a85,0x9a63,0x9a5f, // 5598..559f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x8c96, // 55a0..55a7
+	0x9a69,0x9a67,0x9172,0x8b69, 0x8baa,   INV,0x9a64,   INV, // 55a8..55af
+	0x8bf2,   INV,   INV,   INV,    INV,   INV,0x8963,   INV, // 55b0..55b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 55b8..55bf
+	   INV,   INV,   INV,   INV, 0x9a6d,0x9a6b,   INV,0x9aa5, // 55c0..55c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 55c8..55cf
+	   INV,   INV,   INV,   INV, 0x9a70,   INV,   INV,   INV, // 55d0..55d7
+	   INV,   INV,0x9a6a,   INV, 0x9a6e,   INV,   INV,0x9a6c, // 55d8..55df
+	   INV,   INV,   INV,0x8e6b, 0x9a6f,   INV,   INV,   INV, // 55e0..55e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 55e8..55ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9a72, // 55f0..55f7
+	   INV,0x9a77,   INV,   INV,    INV,0x9a75,0x9a74,   INV, // 55f8..55ff
+    },
+    { //  19: 5600..56ff
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9251,   INV, // 5600..5607
+	   INV,0x89c3,   INV,   INV,    INV,   INV,   INV,   INV, // 5608..560f
+	   INV,   INV,   INV,   INV, 0x9a71,   INV,0x9a73,0x8fa6, // 5610..5617
+	0x8952,   INV,   INV,0x9a76,    INV,   INV,   INV,   INV, // 5618..561f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5620..5627
+	   INV,0x89dc,   INV,   INV,    INV,   INV,   INV,0x9a82, // 5628..562f
+	   INV,0x8ffa,0x9a7d,   INV, 0x9a7b,   INV,0x9a7c,   INV, // 5630..5637
+	0x9a7e,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5638..563f
+	   INV,   INV,0x895c,   INV,    INV,   INV,   INV,   INV, // 5640..5647
+	   INV,   INV,   INV,   INV, 0x9158,   INV,0x9a78,   INV, // 5648..564f
+	0x9a79,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5650..5657
+	   INV,   INV,   INV,0x8a9a,    INV,   INV,   INV,   INV, // 5658..565f
+	   INV,   INV,   INV,   INV, 0x9a81,   INV,   INV,   INV, // 5660..5667
+	0x8aed,   INV,0x9a84,0x9a80, 0x9a83,   INV,   INV,   INV, // 5668..566f
+	   INV,   INV,   INV,   INV, 0x95ac,   INV,   INV,   INV, // 5670..5677
+	0x93d3,   INV,0x94b6,   INV,    INV,   INV,   INV,   INV, // 5678..567f
+	0x9a86,   INV,   INV,   INV,    INV,   INV,0x9a85,0x8a64, // 5680..5687
+	   INV,   INV,0x9a87,   INV,    INV,   INV,   INV,0x9a8a, // 5688..568f
+	   INV,   INV,   INV,   INV, 0x9a89,   INV,   INV,   INV, // 5690..5697
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5698..569f
+	0x9a88,   INV,0x9458,   INV,    INV,0x9a8b,   INV,   INV, // 56a0..56a7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9a8c,   INV, // 56a8..56af
+	   INV,   INV,   INV,   INV, 0x9a8e,   INV,0x9a8d,   INV, // 56b0..56b7
+	   INV,   INV,   INV,   INV, 0x9a90,   INV,   INV,   INV, // 56b8..56bf
+	0x9a93,0x9a91,0x9a8f,0x9a92,    INV,   INV,   INV,   INV, // 56c0..56c7
+	0x9a94,   INV,   INV,   INV,    INV,   INV,0x9a95,   INV, // 56c8..56cf
+	   INV,0x9a96,   INV,0x9a97,    INV,   INV,   INV,0x9a98, // 56d0..56d7
+	0x9964,   INV,0x8efa,0x8e6c,    INV,   INV,0x89f1,   INV, // 56d8..56df
+	0x88f6,   INV,   INV,0x9263,    INV,   INV,   INV,   INV, // 56e0..56e7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9a99,   INV, // 56e8..56ef
+	0x8da2,   INV,0x88cd,0x907d,    INV,   INV,   INV,   INV, // 56f0..56f7
+	   INV,0x9a9a,0x8cc5,   INV,    INV,0x8d91,   INV,0x9a9c, // 56f8..56ff
+    },
+    { //  20: 5700..57ff
+	0x9a9b,   INV,   INV,0x95de, 0x9a9d,   INV,   INV,   INV, // 5700..5707
+	0x9a9f,0x9a9e,   INV,0x9aa0,    INV,0x9aa1,   INV,0x8c97, // 5708..570f
+	   INV,   INV,0x8980,0x9aa2,    INV,   INV,0x9aa4,   INV, // 5710..5717
+	0x9aa3,   INV,   INV,   INV, 0x9aa6,   INV,   INV,0x9379, // 5718..571f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9aa7,0x88b3, // 5720..5727
+	0x8ddd,   INV,   INV,   INV,    INV,0x8c5c,   INV,   INV, // 5728..572f
+	0x926e,   INV,   INV,   INV,    INV,   INV,   INV,0x9aa8, // 5730..5737
+	0x9aa9,   INV,   INV,0x9aab,    INV,   INV,   INV,   INV, // 5738..573f
+	0x9aac,   INV,0x8de2,   INV,    INV,   INV,   INV,0x8bcf, // 5740..5747
+	   INV,   INV,0x9656,   INV,    INV,   INV,0x9aaa,0x9aad, // 5748..574f
+	0x8dbf,0x8d42,   INV,   INV,    INV,   INV,   INV,   INV, // 5750..5757
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5758..575f
+	   INV,0x9ab1,   INV,   INV, 0x8da3,   INV,0x9252,   INV, // 5760..5767
+	   INV,0x9aae,0x92d8,   INV,    INV,   INV,   INV,   INV, // 5768..576f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5770..5777
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9ab2, // 5778..577f
+	   INV,   INV,0x9082,   INV,    INV,   INV,   INV,   INV, // 5780..5787
+	0x9ab0,0x9ab3,   INV,0x8c5e,    INV,   INV,   INV,   INV, // 5788..578f
+	   INV,   INV,   INV,0x9ab4,    INV,   INV,   INV,   INV, // 5790..5797
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5798..579f
+	0x9ab5,   INV,0x8d43,0x8a5f, 0x9ab7,   INV,   INV,   INV, // 57a0..57a7
+	   INV,   INV,0x9ab8,   INV,    INV,   INV,   INV,   INV, // 57a8..57af
+	0x9ab9,   INV,   INV,0x9ab6,    INV,   INV,   INV,   INV, // 57b0..57b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 57b8..57bf
+	0x9aaf,   INV,   INV,0x9aba,    INV,   INV,0x9abb,   INV, // 57c0..57c7
+	   INV,   INV,   INV,0x9684,    INV,   INV,0x8fe9,   INV, // 57c8..57cf
+	   INV,   INV,0x9abd,0x9abe, 0x9abc,   INV,0x9ac0,   INV, // 57d0..57d7
+	   INV,   INV,   INV,   INV, 0x9457,   INV,   INV,0x88e6, // 57d8..57df
+	0x9575,   INV,   INV,0x9ac1,    INV,   INV,   INV,   INV, // 57e0..57e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 57e8..57ef
+	   INV,   INV,   INV,   INV, 0x8ffb,   INV,   INV,0x8eb7, // 57f0..57f7
+	   INV,0x947c,0x8aee,   INV, 0x8de9,   INV,   INV,   INV, // 57f8..57ff
+    },
+    { //  21: 5800..58ff
+	0x9678,   INV,0x93b0,   INV,    INV,0x8c98,0x91cd,   INV, // 5800..5807
+	   INV,   INV,0x9abf,0x9ac2,    INV,   INV,   INV,   INV, // 5808..580f
+	   INV,   INV,   INV,   INV,    INV,0x91c2,   INV,   INV, // 5810..5817
+	   INV,0x9ac3,   INV,   INV,    INV,0x9ac4,   INV,   INV, // 5818..581f
+	   INV,0x9ac6,   INV,   INV, 0x92e7,   INV,   INV,   INV, // 5820..5827
+	   INV,   INV,0x8aac,   INV,    INV,   INV,   INV,0xea9f, // 5828..582f
+	0x8981,0x95f1,   INV,   INV, 0x8fea,0x9367,   INV,   INV, // 5830..5837
+	   INV,   INV,0x8de4,   INV,    INV,0x9acc,   INV,   INV, // 5838..583f
+	0x95bb,0x97db,   INV,   INV,    INV,   INV,   INV,   INV, // 5840..5847
+	   INV,   INV,0x89f2,0x9ac8,    INV,   INV,   INV,   INV, // 5848..584f
+	   INV,0x9159,0x9acb,   INV, 0x9383,   INV,   INV,0x9368, // 5850..5857
+	0x9384,0x94b7,0x92cb,   INV,    INV,   INV,0x8dc7,   INV, // 5858..585f
+	   INV,   INV,0x9ac7,   INV,    INV,   INV,   INV,   INV, // 5860..5867
+	   INV,0x8996,   INV,0x9355,    INV,   INV,   INV,   INV, // 5868..586f
+	0x9ac9,   INV,0x9ac5,   INV,    INV,0x906f,   INV,   INV, // 5870..5877
+	   INV,0x9acd,   INV,   INV,    INV,   INV,0x8f6d,   INV, // 5878..587f
+	   INV,   INV,   INV,0x8bab,    INV,0x9ace,   INV,   INV, // 5880..5887
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5888..588f
+	   INV,   INV,   INV,0x95e6,    INV,   INV,   INV,0x919d, // 5890..5897
+	   INV,   INV,   INV,   INV, 0x92c4,   INV,   INV,0x9ad0, // 5898..589f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 58a0..58a7
+	0x966e,   INV,   INV,0x9ad1,    INV,   INV,0x9ad6,   INV, // 58a8..58af
+	   INV,   INV,   INV,0x95ad,    INV,   INV,   INV,   INV, // 58b0..58b7
+	0x9ad5,0x9acf,0x9ad2,0x9ad4,    INV,   INV,0x8da4,   INV, // 58b8..58bf
+	   INV,0x95c7,   INV,   INV,    INV,0x9ad7,   INV,0x9264, // 58c0..58c7
+	   INV,   INV,0x89f3,   INV, 0x8feb,   INV,   INV,   INV, // 58c8..58cf
+	   INV,0x9ad9,   INV,0x9ad8,    INV,0x8d88,   INV,0x9ada, // 58d0..58d7
+	0x9adc,0x9adb,   INV,   INV, 0x9ade,   INV,0x9ad3,0x9ae0, // 58d8..58df
+	   INV,   INV,   INV,   INV, 0x9adf,0x9add,   INV,   INV, // 58e0..58e7
+	   INV,   INV,   INV,0x8e6d, 0x9070,   INV,0x9173,0x9ae1, // 58e8..58ef
+	0x90ba,0x88eb,0x9484,   INV,    INV,   INV,   INV,0x92d9, // 58f0..58f7
+	   INV,0x9ae3,0x9ae2,0x9ae4, 0x9ae5,0x9ae6,   INV,   INV, // 58f8..58ff
+    },
+    { //  22: 5900..59ff
+	   INV,   INV,0x9ae7,   INV,    INV,   INV,   INV,   INV, // 5900..5907
+	   INV,0x95cf,0x9ae8,   INV,    INV,   INV,   INV,0x89c4, // 5908..590f
+	0x9ae9,   INV,   INV,   INV,    INV,0x975b,0x8a4f,   INV, // 5910..5917
+	0x99c7,0x8f67,0x91bd,0x9aea, 0x96e9,   INV,   INV,   INV, // 5918..591f
+	   INV,   INV,0x96b2,   INV,    INV,0x9aec,   INV,0x91e5, // 5920..5927
+	   INV,0x9356,0x91be,0x9576, 0x9aed,0x9aee,0x899b,   INV, // 5928..592f
+	   INV,0x8eb8,0x9aef,   INV,    INV,   INV,   INV,0x88ce, // 5930..5937
+	0x9af0,   INV,   INV,   INV,    INV,   INV,0x9af1,   INV, // 5938..593f
+	   INV,   INV,   INV,   INV, 0x8982,   INV,   INV,0x8aef, // 5940..5947
+	0x93de,0x95f2,   INV,   INV,    INV,   INV,0x9af5,0x9174, // 5948..594f
+	0x9af4,0x8c5f,   INV,   INV, 0x967a,0x9af3,   INV,0x9385, // 5950..5957
+	0x9af7,   INV,0x9af6,   INV,    INV,   INV,   INV,   INV, // 5958..595f
+	0x9af9,   INV,0x9af8,   INV,    INV,0x899c,   INV,0x9afa, // 5960..5967
+	0x8fa7,0x9afc,0x9244,   INV, 0x9afb,   INV,0x95b1,   INV, // 5968..596f
+	   INV,   INV,   INV,0x8f97, 0x937a,   INV,   INV,   INV, // 5970..5977
+	0x9b40,   INV,   INV,   INV,    INV,0x8d44,   INV,   INV, // 5978..597f
+	   INV,0x9b41,0x9440,0x94dc, 0x96cf,   INV,   INV,   INV, // 5980..5987
+	   INV,   INV,0x9444,   INV,    INV,0x9b4a,   INV,   INV, // 5988..598f
+	   INV,   INV,   INV,0x8b57,    INV,   INV,0x9764,   INV, // 5990..5997
+	   INV,0x96ad,   INV,0x9baa,    INV,0x9b42,   INV,   INV, // 5998..599f
+	   INV,   INV,   INV,0x9b45,    INV,0x91c3,   INV,   INV, // 59a0..59a7
+	0x9657,   INV,   INV,   INV, 0x9369,   INV,   INV,   INV, // 59a8..59af
+	   INV,   INV,0x9b46,   INV,    INV,   INV,   INV,   INV, // 59b0..59b7
+	   INV,0x9685,   INV,0x8dc8,    INV,   INV,0x8fa8,   INV, // 59b8..59bf
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9b47,   INV, // 59c0..59c7
+	   INV,0x8e6f,   INV,0x8e6e,    INV,   INV,   INV,   INV, // 59c8..59cf
+	0x88b7,0x8cc6,   INV,0x90a9, 0x88cf,   INV,   INV,   INV, // 59d0..59d7
+	   INV,0x9b4b,0x9b4c,   INV, 0x9b49,   INV,   INV,   INV, // 59d8..59df
+	   INV,   INV,   INV,   INV,    INV,0x8957,0x8aad,   INV, // 59e0..59e7
+	0x9b48,   INV,0x96c3,0x9550,    INV,   INV,   INV,   INV, // 59e8..59ef
+	   INV,   INV,   INV,   INV,    INV,   INV,0x88a6,   INV, // 59f0..59f7
+	   INV,   INV,   INV,0x88f7,    INV,   INV,   INV,0x8e70, // 59f8..59ff
+    },
+    { //  23: 5a00..5aff
+	   INV,0x88d0,   INV,0x88a1,    INV,   INV,   INV,   INV, // 5a00..5a07
+	   INV,0x9b51,   INV,   INV,    INV,   INV,   INV,   INV, // 5a08..5a0f
+	   INV,0x9b4f,   INV,   INV,    INV,   INV,   INV,   INV, // 5a10..5a17
+	0x96ba,   INV,0x9b52,   INV, 0x9b50,   INV,   INV,0x9b4e, // 5a18..5a1f
+	0x9050,   INV,   INV,   INV,    INV,0x9b4d,   INV,   INV, // 5a20..5a27
+	   INV,0x95d8,   INV,   INV,    INV,   INV,   INV,0x8ce2, // 5a28..5a2f
+	   INV,   INV,   INV,   INV,    INV,0x9b56,0x9b57,   INV, // 5a30..5a37
+	   INV,   INV,   INV,   INV, 0x8fa9,   INV,   INV,   INV, // 5a38..5a3f
+	0x9b53,0x984b,   INV,   INV,    INV,   INV,0x946b,   INV, // 5a40..5a47
+	   INV,0x9b55,   INV,   INV,    INV,   INV,   INV,   INV, // 5a48..5a4f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5a50..5a57
+	   INV,   INV,0x8da5,   INV,    INV,   INV,   INV,   INV, // 5a58..5a5f
+	   INV,   INV,0x9b58,   INV,    INV,   INV,0x9577,   INV, // 5a60..5a67
+	   INV,   INV,0x9b59,   INV, 0x9b54,   INV,   INV,   INV, // 5a68..5a6f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5a70..5a77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x96b9, // 5a78..5a7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5a80..5a87
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5a88..5a8f
+	   INV,   INV,0x947d,   INV,    INV,   INV,   INV,   INV, // 5a90..5a97
+	   INV,   INV,0x9b5a,0x9551,    INV,   INV,   INV,   INV, // 5a98..5a9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5aa0..5aa7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5aa8..5aaf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5ab0..5ab7
+	   INV,   INV,   INV,   INV, 0x9b5b,0x9b5f,0x9b5c,   INV, // 5ab8..5abf
+	   INV,0x89c5,0x9b5e,   INV,    INV,   INV,   INV,   INV, // 5ac0..5ac7
+	   INV,0x8eb9,   INV,0x9b5d, 0x8c99,   INV,   INV,   INV, // 5ac8..5acf
+	0x9b6b,   INV,   INV,   INV,    INV,   INV,0x9b64,0x9b61, // 5ad0..5ad7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5ad8..5adf
+	   INV,0x9284,   INV,0x9b60,    INV,   INV,0x9b62,   INV, // 5ae0..5ae7
+	   INV,0x9b63,   INV,   INV,    INV,   INV,   INV,   INV, // 5ae8..5aef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5af0..5af7
+	   INV,   INV,0x9b65,0x9b66,    INV,   INV,   INV,   INV, // 5af8..5aff
+    },
+    { //  24: 5b00..5bff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5b00..5b07
+	   INV,0x8af0,   INV,0x9b68, 0x9b67,   INV,   INV,   INV, // 5b08..5b0f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9b69,   INV, // 5b10..5b17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5b18..5b1f
+	   INV,   INV,0x8fec,   INV,    INV,   INV,   INV,   INV, // 5b20..5b27
+	   INV,   INV,0x9b6c,   INV, 0x92da,   INV,   INV,   INV, // 5b28..5b2f
+	0x8964,   INV,0x9b6a,   INV,    INV,   INV,0x9b6d,   INV, // 5b30..5b37
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9b6e,   INV, // 5b38..5b3f
+	0x9b71,   INV,   INV,0x9b6f,    INV,0x9b70,   INV,   INV, // 5b40..5b47
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5b48..5b4f
+	0x8e71,0x9b72,   INV,   INV, 0x8d45,0x9b73,   INV,0x8e9a, // 5b50..5b57
+	0x91b6,   INV,0x9b74,0x9b75, 0x8e79,0x8d46,   INV,0x96d0, // 5b58..5b5f
+	   INV,   INV,   INV,0x8b47, 0x8cc7,0x9b76,0x8a77,   INV, // 5b60..5b67
+	   INV,0x9b77,   INV,0x91b7,    INV,   INV,   INV,   INV, // 5b68..5b6f
+	0x9b78,0x9ba1,   INV,0x9b79,    INV,0x9b7a,   INV,   INV, // 5b70..5b77
+	0x9b7b,   INV,0x9b7d,   INV,    INV,   INV,   INV,   INV, // 5b78..5b7f
+	0x9b7e,   INV,   INV,0x9b80,    INV,0x91ee,   INV,0x8946, // 5b80..5b87
+	0x8ee7,0x88c0,   INV,0x9176, 0x8aae,0x8eb3,   INV,0x8d47, // 5b88..5b8f
+	   INV,   INV,   INV,   INV,    INV,0x9386,   INV,0x8f40, // 5b90..5b97
+	0x8aaf,0x9288,0x92e8,0x88b6, 0x8b58,0x95f3,   INV,0x8ec0, // 5b98..5b9f
+	   INV,   INV,0x8b71,0x90e9, 0x8eba,0x9747,0x9b81,   INV, // 5ba0..5ba7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8b7b,   INV, // 5ba8..5baf
+	0x8dc9,   INV,   INV,0x8a51, 0x8983,0x8faa,0x89c6,   INV, // 5bb0..5bb7
+	0x9b82,0x9765,   INV,   INV,    INV,   INV,   INV,0x8f68, // 5bb8..5bbf
+	   INV,   INV,0x8ee2,0x9b83, 0x8af1,0x93d0,0x96a7,0x9b84, // 5bc0..5bc7
+	   INV,0x9b85,   INV,   INV, 0x9578,   INV,   INV,   INV, // 5bc8..5bcf
+	0x9b87,   INV,0x8aa6,0x8bf5, 0x9b86,   INV,   INV,   INV, // 5bd0..5bd7
+	   INV,   INV,   INV,0x8ab0,    INV,0x9051,0x9b8b,0x8e40, // 5bd8..5bdf
+	   INV,0x89c7,0x9b8a,   INV, 0x9b88,0x9b8c,0x9b89,0x944a, // 5be0..5be7
+	0x9ecb,0x9052,   INV,0x9b8d,    INV,   INV,0x97be,   INV, // 5be8..5bef
+	0x9b8e,   INV,   INV,0x9b90,    INV,0x929e,0x9b8f,   INV, // 5bf0..5bf7
+	0x90a1,   INV,0x8e9b,   INV,    INV,   INV,0x91ce,0x8ef5, // 5bf8..5bff
+    },
+    { //  25: 5c00..5cff
+	   INV,0x9595,0x90ea,   INV, 0x8ecb,0x9b91,0x8fab,0x9b92, // 5c00..5c07
+	0x9b93,0x88d1,0x91b8,0x9071,    INV,0x9b94,0x93b1,0x8fac, // 5c08..5c0f
+	   INV,0x8fad,   INV,0x9b95,    INV,   INV,0x90eb,   INV, // 5c10..5c17
+	   INV,   INV,0x8fae,   INV,    INV,   INV,   INV,   INV, // 5c18..5c1f
+	0x9b96,   INV,0x9b97,   INV, 0x96de,   INV,   INV,   INV, // 5c20..5c27
+	0x9b98,   INV,   INV,   INV,    INV,0x8bc4,   INV,   INV, // 5c28..5c2f
+	   INV,0x8f41,   INV,   INV,    INV,   INV,   INV,   INV, // 5c30..5c37
+	0x9b99,0x9b9a,0x8eda,0x904b, 0x93f2,0x9073,0x94f6,0x9441, // 5c38..5c3f
+	0x8bc7,0x9b9b,   INV,   INV,    INV,0x8b8f,0x9b9c,   INV, // 5c40..5c47
+	0x8bfc,   INV,0x93cd,0x89ae,    INV,0x8e72,0x9b9d,0x9ba0, // 5c48..5c4f
+	0x9b9f,0x8bfb,   INV,0x9b9e,    INV,0x9357,   INV,   INV, // 5c50..5c57
+	   INV,   INV,   INV,   INV,    INV,   INV,0x91ae,   INV, // 5c58..5c5f
+	0x936a,0x8ec6,   INV,   INV, 0x9177,0x979a,   INV,   INV, // 5c60..5c67
+	   INV,   INV,   INV,   INV, 0x9ba2,   INV,0x9ba3,0x93d4, // 5c68..5c6f
+	   INV,0x8e52,   INV,   INV,    INV,   INV,0x9ba5,   INV, // 5c70..5c77
+	   INV,0x9ba6,   INV,   INV,    INV,   INV,   INV,   INV, // 5c78..5c7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5c80..5c87
+	   INV,   INV,   INV,   INV, 0x9ba7,   INV,   INV,   INV, // 5c88..5c8f
+	0x8af2,0x9ba8,   INV,   INV, 0x9ba9,   INV,   INV,   INV, // 5c90..5c97
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5c98..5c9f
+	   INV,0x89aa,   INV,   INV,    INV,   INV,   INV,   INV, // 5ca0..5ca7
+	0x915a,0x8ae2,   INV,0x9bab, 0x96a6,   INV,   INV,   INV, // 5ca8..5caf
+	   INV,0x91d0,   INV,0x8a78,    INV,   INV,0x9bad,0x9baf, // 5cb0..5cb7
+	0x8add,   INV,   INV,0x9bac, 0x9bae,   INV,0x9bb1,   INV, // 5cb8..5cbf
+	   INV,   INV,   INV,   INV,    INV,0x9bb0,   INV,0x9bb2, // 5cc0..5cc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5cc8..5ccf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5cd0..5cd7
+	   INV,0x9bb3,   INV,   INV,    INV,   INV,   INV,   INV, // 5cd8..5cdf
+	0x93bb,0x8bac,   INV,   INV,    INV,   INV,   INV,   INV, // 5ce0..5ce7
+	0x89e3,0x9bb4,0x9bb9,   INV,    INV,0x9bb7,   INV,0x95f5, // 5ce8..5cef
+	0x95f4,   INV,   INV,   INV,    INV,   INV,0x9387,   INV, // 5cf0..5cf7
+	   INV,   INV,0x9bb6,0x8f73,    INV,0x9bb5,   INV,   INV, // 5cf8..5cff
+    },
+    { //  26: 5d00..5dff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9092, // 5d00..5d07
+	   INV,   INV,   INV,0x9bba,    INV,   INV,0x8de8,   INV, // 5d08..5d0f
+	   INV,0x9bc0,   INV,   INV, 0x9bc1,0x9bbb,0x8a52,0x9bbc, // 5d10..5d17
+	0x9bc5,0x9bc4,0x9bc3,0x9bbf,    INV,   INV,   INV,0x9bbe, // 5d18..5d1f
+	   INV,   INV,0x9bc2,   INV,    INV,   INV,   INV,   INV, // 5d20..5d27
+	   INV,0x95f6,   INV,   INV,    INV,   INV,   INV,   INV, // 5d28..5d2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5d30..5d37
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5d38..5d3f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5d40..5d47
+	   INV,   INV,   INV,0x9bc9, 0x9bc6,   INV,0x9bc8,   INV, // 5d48..5d4f
+	0x9792,   INV,0x9bc7,   INV,    INV,   INV,   INV,   INV, // 5d50..5d57
+	   INV,   INV,   INV,   INV, 0x9bbd,   INV,   INV,   INV, // 5d58..5d5f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5d60..5d67
+	   INV,0x9093,   INV,   INV, 0x9bca,   INV,   INV,0x8db5, // 5d68..5d6f
+	   INV,   INV,   INV,0x9bcb,    INV,   INV,0x9bcc,   INV, // 5d70..5d77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5d78..5d7f
+	   INV,   INV,0x9bcf,   INV, 0x9bce,   INV,   INV,0x9bcd, // 5d80..5d87
+	   INV,   INV,   INV,0x9388, 0x9bb8,   INV,   INV,   INV, // 5d88..5d8f
+	0x9bd5,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5d90..5d97
+	   INV,   INV,   INV,   INV,    INV,0x9bd1,   INV,   INV, // 5d98..5d9f
+	   INV,   INV,0x9bd0,   INV,    INV,   INV,   INV,   INV, // 5da0..5da7
+	   INV,   INV,   INV,   INV, 0x9bd2,   INV,0x9bd3,   INV, // 5da8..5daf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9bd6, // 5db0..5db7
+	   INV,   INV,0x97e4,   INV, 0x9bd7,0x9bd4,   INV,   INV, // 5db8..5dbf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5dc0..5dc7
+	   INV,0x9bd8,   INV,   INV, 0x8ade,0x9bd9,   INV,   INV, // 5dc8..5dcf
+	   INV,   INV,0x9bdb,0x9bda,    INV,   INV,0x9bdc,   INV, // 5dd0..5dd7
+	   INV,   INV,   INV,0x9bdd,    INV,0x90ec,0x8f42,   INV, // 5dd8..5ddf
+	   INV,0x8f84,   INV,0x9183,    INV,0x8d48,0x8db6,0x8d49, // 5de0..5de7
+	0x8b90,   INV,   INV,0x9bde,    INV,   INV,0x8db7,   INV, // 5de8..5def
+	   INV,0x8cc8,0x9bdf,0x96a4, 0x9462,0x9be0,   INV,0x8d4a, // 5df0..5df7
+	   INV,   INV,   INV,0x8aaa,    INV,0x9246,0x8bd0,   INV, // 5df8..5dff
+    },
+    { //  27: 5e00..5eff
+	   INV,   INV,0x8e73,0x957a,    INV,   INV,0x94bf,   INV, // 5e00..5e07
+	   INV,   INV,   INV,0x9be1, 0x8af3,   INV,   INV,   INV, // 5e08..5e0f
+	   INV,0x9be4,   INV,   INV,    INV,   INV,0x929f,   INV, // 5e10..5e17
+	   INV,0x9be3,0x9be2,0x9be5,    INV,0x92e9,   INV,   INV, // 5e18..5e1f
+	   INV,   INV,   INV,   INV,    INV,0x9083,   INV,   INV, // 5e20..5e27
+	   INV,   INV,   INV,0x8e74,    INV,0x90c8,   INV,0x91d1, // 5e28..5e2f
+	0x8b41,   INV,   INV,0x92a0,    INV,   INV,0x9be6,0x9be7, // 5e30..5e37
+	0x8fed,   INV,   INV,   INV,    INV,0x9658,   INV,   INV, // 5e38..5e3f
+	0x9bea,   INV,   INV,0x9be9, 0x9be8,0x959d,   INV,0x9bf1, // 5e40..5e47
+	   INV,   INV,   INV,   INV, 0x9679,   INV,0x9beb,   INV, // 5e48..5e4f
+	   INV,   INV,   INV,   INV, 0x9bed,0x968b,   INV,0x9bec, // 5e50..5e57
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9bee, // 5e58..5e5f
+	   INV,0x94a6,0x9bef,0x95bc, 0x9bf0,   INV,   INV,   INV, // 5e60..5e67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5e68..5e6f
+	   INV,   INV,0x8ab1,0x95bd, 0x944e,0x9bf2,0x9bf3,   INV, // 5e70..5e77
+	0x8d4b,0x8ab2,0x9bf4,0x8cb6, 0x9763,0x9748,0x8af4,0x9bf6, // 5e78..5e7f
+	   INV,0x92a1,   INV,0x8d4c, 0x8faf,   INV,   INV,0x94dd, // 5e80..5e87
+	   INV,   INV,0x8fb0,   INV,    INV,   INV,   INV,0x8f98, // 5e88..5e8f
+	   INV,   INV,   INV,   INV,    INV,0x92ea,0x95f7,0x9358, // 5e90..5e97
+	   INV,   INV,0x8d4d,   INV, 0x957b,   INV,   INV,   INV, // 5e98..5e9f
+	0x9bf7,   INV,   INV,   INV,    INV,   INV,0x9378,0x8dc0, // 5ea0..5ea7
+	   INV,   INV,   INV,0x8cc9,    INV,0x92eb,   INV,   INV, // 5ea8..5eaf
+	   INV,   INV,   INV,   INV,    INV,0x88c1,0x8f8e,0x8d4e, // 5eb0..5eb7
+	0x9766,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 5eb8..5ebf
+	   INV,0x9bf8,0x9bf9,0x9470,    INV,   INV,   INV,   INV, // 5ec0..5ec7
+	0x9bfa,0x97f5,0x984c,   INV,    INV,   INV,   INV,0x9bfc, // 5ec8..5ecf
+	0x9bfb,   INV,   INV,0x8a66,    INV,   INV,0x9c40,   INV, // 5ed0..5ed7
+	   INV,   INV,0x9c43,0x9c44,    INV,0x9c42,   INV,0x955f, // 5ed8..5edf
+	0x8fb1,0x9c46,0x9c45,0x9c41,    INV,   INV,   INV,   INV, // 5ee0..5ee7
+	0x9c47,0x9c48,   INV,   INV, 0x9c49,   INV,   INV,   INV, // 5ee8..5eef
+	0x9c4c,0x9c4a,   INV,0x9c4b, 0x9c4d,   INV,0x8984,0x92ec, // 5ef0..5ef7
+	0x9c4e,   INV,0x8c9a,0x89f4, 0x9455,   INV,0x9c4f,0x93f9, // 5ef8..5eff
+    },
+    { //  28: 5f00..5fff
+	   INV,0x95d9,   INV,0x9c50, 0x984d,   INV,   INV,   INV, // 5f00..5f07
+	   INV,0x9c51,0x95be,0x9c54, 0x989f,0x98af,   INV,0x8eae, // 5f08..5f0f
+	0x93f3,0x9c55,   INV,0x8b7c, 0x92a2,0x88f8,0x9c56,0x95a4, // 5f10..5f17
+	0x8d4f,   INV,   INV,0x926f,    INV,   INV,   INV,0x92ed, // 5f18..5f1f
+	   INV,   INV,   INV,   INV,    INV,0x96ed,0x8cb7,0x8cca, // 5f20..5f27
+	   INV,0x9c57,   INV,   INV,    INV,0x9c58,   INV,0x9c5e, // 5f28..5f2f
+	   INV,0x8ee3,   INV,   INV,    INV,0x92a3,   INV,0x8bad, // 5f30..5f37
+	0x9c59,   INV,   INV,   INV, 0x954a,   INV,0x9265,   INV, // 5f38..5f3f
+	   INV,0x9c5a,   INV,   INV,    INV,   INV,   INV,   INV, // 5f40..5f47
+	0x9c5b,   INV,0x8bae,   INV, 0x9c5c,   INV,0x9c5d,   INV, // 5f48..5f4f
+	   INV,0x9c5f,   INV,0x9396,    INV,   INV,0x9c60,0x9c61, // 5f50..5f57
+	   INV,0x9c62,   INV,   INV, 0x9c53,0x9c52,   INV,   INV, // 5f58..5f5f
+	   INV,0x9c63,0x8c60,   INV,    INV,   INV,0x9546,   INV, // 5f60..5f67
+	   INV,0x8dca,0x9556,0x92a4, 0x956a,0x9c64,   INV,   INV, // 5f68..5f6f
+	0x8fb2,0x8965,   INV,0x9c65,    INV,   INV,   INV,0x9c66, // 5f70..5f77
+	   INV,0x96f0,   INV,   INV, 0x94de,   INV,   INV,0x9c69, // 5f78..5f7f
+	0x899d,0x90aa,0x9c68,0x9c67, 0x8c61,0x91d2,   INV,0x9c6d, // 5f80..5f87
+	0x9c6b,   INV,0x9c6a,0x97a5, 0x8ce3,   INV,   INV,   INV, // 5f88..5f8f
+	0x8f99,0x9c6c,0x936b,0x8f5d,    INV,   INV,   INV,0x93be, // 5f90..5f97
+	0x9c70,0x9c6f,   INV,   INV,    INV,   INV,0x9c6e,   INV, // 5f98..5f9f
+	0x9c71,0x8ce4,   INV,   INV,    INV,   INV,   INV,   INV, // 5fa0..5fa7
+	0x9c72,0x959c,0x8f7a,   INV,    INV,0x9c73,0x94f7,   INV, // 5fa8..5faf
+	   INV,   INV,   INV,0x93bf, 0x92a5,   INV,   INV,   INV, // 5fb0..5fb7
+	   INV,0x934f,   INV,   INV, 0x9c74,0x8b4a,   INV,   INV, // 5fb8..5fbf
+	   INV,   INV,   INV,0x9053,    INV,0x954b,   INV,   INV, // 5fc0..5fc7
+	   INV,   INV,   INV,   INV, 0x8af5,0x9445,   INV,   INV, // 5fc8..5fcf
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9c75,0x8e75, // 5fd0..5fd7
+	0x9659,0x965a,   INV,   INV, 0x899e,0x9c7a,   INV,   INV, // 5fd8..5fdf
+	0x9289,   INV,   INV,   INV, 0x9c77,   INV,   INV,   INV, // 5fe0..5fe7
+	   INV,   INV,   INV,0x89f5,    INV,   INV,   INV,   INV, // 5fe8..5fef
+	0x9cab,0x9c79,   INV,   INV,    INV,0x944f,   INV,   INV, // 5ff0..5ff7
+	0x9c78,   INV,   INV,0x9c76,    INV,0x8d9a,   INV,0x9c7c, // 5ff8..5fff
+    },
+    { //  29: 6000..60ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6000..6007
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9c83,0x9c89, // 6008..600f
+	0x9c81,   INV,0x937b,   INV,    INV,0x9c86,0x957c,   INV, // 6010..6017
+	   INV,0x9c80,   INV,0x9c85, 0x97e5,0x8e76,   INV,   INV, // 6018..601f
+	0x91d3,0x9c7d,   INV,   INV,    INV,0x8b7d,0x9c88,0x90ab, // 6020..6027
+	0x8985,0x9c82,0x89f6,0x9c87,    INV,   INV,   INV,0x8baf, // 6028..602f
+	   INV,0x9c84,   INV,   INV,    INV,   INV,   INV,   INV, // 6030..6037
+	   INV,   INV,0x9c8a,   INV,    INV,   INV,   INV,   INV, // 6038..603f
+	   INV,0x9c8c,0x9c96,0x9c94,    INV,   INV,0x9c91,   INV, // 6040..6047
+	   INV,   INV,0x9c90,0x97f6,    INV,0x9c92,   INV,   INV, // 6048..604f
+	0x8bb0,   INV,0x8d50,   INV,    INV,0x8f9a,   INV,   INV, // 6050..6057
+	   INV,0x9c99,0x9c8b,   INV,    INV,   INV,   INV,0x9c8f, // 6058..605f
+	0x9c7e,   INV,0x89f8,0x9c93, 0x9c95,0x9270,   INV,   INV, // 6060..6067
+	0x8da6,0x89b6,0x9c8d,0x9c98, 0x9c97,0x8bb1,   INV,0x91a7, // 6068..606f
+	0x8a86,   INV,   INV,   INV,    INV,0x8c62,   INV,0x9c8e, // 6070..6077
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6078..607f
+	   INV,0x9c9a,   INV,0x9c9d, 0x9c9f,   INV,   INV,   INV, // 6080..6087
+	   INV,0x8ebb,   INV,0x9ca5, 0x92ee,0x9c9b,   INV,   INV, // 6088..608f
+	   INV,   INV,0x9ca3,   INV, 0x89f7,   INV,0x9ca1,0x9ca2, // 6090..6097
+	   INV,   INV,0x9c9e,0x9ca0,    INV,   INV,   INV,0x8ce5, // 6098..609f
+	0x9749,   INV,   INV,0x8ab3,    INV,   INV,0x8978,0x9ca4, // 60a0..60a7
+	   INV,0x9459,0x88ab,   INV,    INV,   INV,   INV,   INV, // 60a8..60af
+	   INV,   INV,0x94df,0x9c7b, 0x9caa,0x9cae,0x96e3,   INV, // 60b0..60b7
+	0x9ca7,   INV,   INV,   INV, 0x9389,0x9cac,   INV,   INV, // 60b8..60bf
+	   INV,   INV,   INV,   INV,    INV,0x8fee,0x9cad,0x93d5, // 60c0..60c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 60c8..60cf
+	   INV,0x9866,   INV,0x9ca9,    INV,   INV,   INV,   INV, // 60d0..60d7
+	0x9caf,   INV,0x8d9b,   INV, 0x90c9,   INV,   INV,0x88d2, // 60d8..60df
+	0x9ca8,0x9ca6,   INV,0x9179,    INV,   INV,   INV,0x9c9c, // 60e0..60e7
+	0x8e53,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 60e8..60ef
+	0x91c4,0x9cbb,   INV,0x917a, 0x9cb6,   INV,0x9cb3,0x9cb4, // 60f0..60f7
+	   INV,0x8ee4,0x9cb7,0x9cba,    INV,   INV,   INV,   INV, // 60f8..60ff
+    },
+    { //  30: 6100..61ff
+	0x9cb5,0x8f44,   INV,0x9cb8,    INV,   INV,0x9cb2,   INV, // 6100..6107
+	0x96fa,0x96f9,   INV,   INV,    INV,0x9cbc,0x9cbd,0x88d3, // 6108..610f
+	   INV,   INV,   INV,   INV,    INV,0x9cb1,   INV,   INV, // 6110..6117
+	   INV,   INV,0x8bf0,0x88a4,    INV,   INV,   INV,0x8ab4, // 6118..611f
+	   INV,0x9cb9,   INV,   INV,    INV,   INV,   INV,0x9cc1, // 6120..6127
+	0x9cc0,   INV,   INV,   INV, 0x9cc5,   INV,   INV,   INV, // 6128..612f
+	   INV,   INV,   INV,   INV, 0x9cc6,   INV,   INV,   INV, // 6130..6137
+	   INV,   INV,   INV,   INV, 0x9cc4,0x9cc7,0x9cbf,0x9cc3, // 6138..613f
+	   INV,   INV,0x9cc8,   INV, 0x9cc9,   INV,   INV,0x9cbe, // 6140..6147
+	0x8e9c,   INV,0x9cc2,0x91d4, 0x8d51,0x9cb0,0x9054,   INV, // 6148..614f
+	   INV,   INV,   INV,0x9cd6,    INV,0x95e7,   INV,   INV, // 6150..6157
+	0x9ccc,0x9ccd,0x9cce,   INV,    INV,0x9cd5,   INV,0x9cd4, // 6158..615f
+	   INV,   INV,0x969d,0x8ab5,    INV,0x9cd2,   INV,0x8c64, // 6160..6167
+	0x8a53,   INV,   INV,0x9ccf,    INV,   INV,0x97b6,0x9cd1, // 6168..616f
+	0x88d4,0x9cd3,   INV,0x9cca, 0x9cd0,0x9cd7,0x8c63,0x9ccb, // 6170..6177
+	   INV,   INV,   INV,   INV,    INV,   INV,0x977c,   INV, // 6178..617f
+	   INV,   INV,0x974a,   INV,    INV,   INV,   INV,0x9cda, // 6180..6187
+	   INV,   INV,0x9cde,   INV,    INV,   INV,0x919e,   INV, // 6188..618f
+	0x97f7,0x9cdf,   INV,   INV, 0x9cdc,   INV,0x9cd9,   INV, // 6190..6197
+	   INV,0x9cd8,0x9cdd,   INV,    INV,   INV,   INV,   INV, // 6198..619f
+	   INV,   INV,   INV,   INV, 0x95ae,   INV,   INV,0x93b2, // 61a0..61a7
+	   INV,0x8c65,   INV,0x9ce0, 0x9cdb,   INV,0x9ce1,   INV, // 61a8..61af
+	   INV,   INV,0x8c9b,   INV,    INV,   INV,0x89af,   INV, // 61b0..61b7
+	   INV,   INV,0x9ce9,   INV,    INV,   INV,0x8ab6,   INV, // 61b8..61bf
+	   INV,   INV,   INV,0x9ce7,    INV,   INV,0x9ce8,0x8da7, // 61c0..61c7
+	0x9ce6,0x9ce4,0x9ce3,0x9cea, 0x9ce2,0x9cec,   INV,   INV, // 61c8..61cf
+	0x89f9,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 61d0..61d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 61d8..61df
+	   INV,   INV,   INV,0x9cee,    INV,   INV,0x9ced,   INV, // 61e0..61e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 61e8..61ef
+	   INV,   INV,0x92a6,   INV, 0x9cf1,   INV,0x9cef,0x9ce5, // 61f0..61f7
+	0x8c9c,   INV,0x9cf0,   INV, 0x9cf4,0x9cf3,0x9cf5,0x9cf2, // 61f8..61ff
+    },
+    { //  31: 6200..62ff
+	0x9cf6,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6200..6207
+	0x9cf7,0x9cf8,0x95e8,   INV, 0x9cfa,0x9cf9,0x8f5e,   INV, // 6208..620f
+	0x90ac,0x89e4,0x89fa,   INV, 0x9cfb,   INV,0x88bd,   INV, // 6210..6217
+	   INV,   INV,0x90ca,0x9cfc,    INV,0xe6c1,0x9d40,0x8c81, // 6218..621f
+	   INV,0x9d41,   INV,   INV,    INV,   INV,0x90ed,   INV, // 6220..6227
+	   INV,   INV,0x9d42,   INV,    INV,   INV,0x9d43,0x8b59, // 6228..622f
+	0x9d44,   INV,0x9d45,0x9d46, 0x91d5,   INV,   INV,   INV, // 6230..6237
+	0x8ccb,   INV,   INV,0x96df,    INV,   INV,   INV,0x965b, // 6238..623f
+	0x8f8a,0x9d47,   INV,   INV,    INV,   INV,   INV,0x90ee, // 6240..6247
+	0xe7bb,0x94e0,   INV,0x8ee8,    INV,0x8dcb,0x9d48,   INV, // 6248..624f
+	   INV,   INV,   INV,0x91c5,    INV,0x95a5,   INV,   INV, // 6250..6257
+	0x91ef,   INV,   INV,0x9d4b,    INV,   INV,0x9d49,   INV, // 6258..625f
+	0x9d4c,   INV,   INV,0x9d4a,    INV,   INV,   INV,   INV, // 6260..6267
+	0x9d4d,   INV,   INV,   INV,    INV,   INV,0x95af,   INV, // 6268..626f
+	   INV,0x88b5,   INV,   INV,    INV,   INV,0x957d,   INV, // 6270..6277
+	   INV,0x94e1,   INV,   INV, 0x9d4e,   INV,0x9d51,0x8fb3, // 6278..627f
+	0x8b5a,   INV,0x9d4f,0x9d56, 0x8fb4,   INV,   INV,   INV, // 6280..6287
+	   INV,0x9d50,0x9463,   INV,    INV,   INV,   INV,   INV, // 6288..628f
+	   INV,0x977d,0x9d52,0x9d53, 0x9d57,0x938a,0x9d54,0x8d52, // 6290..6297
+	0x90dc,   INV,   INV,0x9d65, 0x94b2,   INV,0x91f0,   INV, // 6298..629f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 62a0..62a7
+	   INV,   INV,   INV,0x94e2, 0x9dab,   INV,   INV,   INV, // 62a8..62af
+	   INV,0x95f8,   INV,   INV,    INV,0x92ef,   INV,   INV, // 62b0..62b7
+	   INV,0x9695,   INV,0x9d5a, 0x899f,0x928a,   INV,   INV, // 62b8..62bf
+	   INV,   INV,0x9d63,   INV,    INV,0x9253,0x9d5d,0x9d64, // 62c0..62c7
+	0x9d5f,0x9d66,0x9d62,   INV, 0x9d61,0x948f,   INV,0x9d5b, // 62c8..62cf
+	0x89fb,0x9d59,0x8b91,0x91f1, 0x9d55,   INV,   INV,0x9d58, // 62d0..62d7
+	0x8d53,0x90d9,   INV,0x8fb5, 0x9d60,0x9471,   INV,   INV, // 62d8..62df
+	0x8b92,0x8a67,   INV,   INV,    INV,   INV,   INV,   INV, // 62e0..62e7
+	   INV,   INV,   INV,   INV, 0x8a87,0x9040,0x9d68,0x9d6d, // 62e8..62ef
+	   INV,0x9d69,   INV,0x8c9d,    INV,0x9d6e,0x8e41,0x8d89, // 62f0..62f7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8f45,0x9d5c, // 62f8..62ff
+    },
+    { //  32: 6300..63ff
+	   INV,0x8e9d,0x9d6b,   INV,    INV,   INV,   INV,0x8e77, // 6300..6307
+	0x9d6c,0x88c2,   INV,   INV, 0x9d67,   INV,   INV,   INV, // 6308..630f
+	   INV,0x92a7,   INV,   INV,    INV,   INV,   INV,   INV, // 6310..6317
+	   INV,0x8b93,   INV,   INV,    INV,   INV,   INV,0x8bb2, // 6318..631f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9d6a, // 6320..6327
+	0x88a5,   INV,   INV,0x8dc1,    INV,   INV,   INV,0x9055, // 6328..632f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6330..6337
+	   INV,   INV,0x92f0,   INV,    INV,0x94d2,0x9d70,0x917d, // 6338..633f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6340..6347
+	   INV,0x91a8,   INV,   INV, 0x8e4a,0x9d71,   INV,0x9d73, // 6348..634f
+	0x9d6f,   INV,   INV,   INV,    INV,0x95df,   INV,0x92bb, // 6350..6357
+	   INV,   INV,   INV,   INV, 0x917b,   INV,   INV,   INV, // 6358..635f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x95f9, // 6360..6367
+	0x8ecc,0x9d80,   INV,0x9d7e,    INV,   INV,0x9098,   INV, // 6368..636f
+	   INV,   INV,0x8c9e,   INV,    INV,   INV,0x9d78,0x8fb7, // 6370..6377
+	   INV,   INV,0x93e6,0x9450,    INV,   INV,   INV,   INV, // 6378..637f
+	0x9d76,   INV,   INV,0x917c,    INV,   INV,   INV,   INV, // 6380..6387
+	0x8ef6,0x9d7b,   INV,   INV, 0x8fb6,   INV,0x9d75,0x9d7a, // 6388..638f
+	   INV,   INV,0x9472,   INV,    INV,   INV,0x9d74,   INV, // 6390..6397
+	0x8c40,   INV,   INV,0x8a7c,    INV,   INV,   INV,0x9d7c, // 6398..639f
+	0x97a9,0x8dcc,0x9254,0x9d79,    INV,0x90da,   INV,0x8d54, // 63a0..63a7
+	0x9084,0x8986,0x915b,0x9d77, 0x8b64,   INV,   INV,   INV, // 63a8..63af
+	   INV,   INV,0x8c66,   INV, 0x92cd,0x9d7d,   INV,   INV, // 63b0..63b7
+	   INV,   INV,   INV,0x917e,    INV,   INV,0x9d81,   INV, // 63b8..63bf
+	0x9d83,   INV,   INV,0x91b5, 0x9d89,   INV,0x9d84,   INV, // 63c0..63c7
+	   INV,0x9d86,   INV,   INV,    INV,   INV,   INV,0x9560, // 63c8..63cf
+	0x92f1,   INV,0x9d87,   INV,    INV,   INV,0x974b,   INV, // 63d0..63d7
+	   INV,   INV,0x9767,0x8ab7,    INV,   INV,   INV,   INV, // 63d8..63df
+	   INV,0x88ac,   INV,0x9d85,    INV,   INV,   INV,   INV, // 63e0..63e7
+	   INV,0x9d82,   INV,   INV,    INV,   INV,0x8af6,   INV, // 63e8..63ef
+	   INV,   INV,   INV,   INV, 0x8987,   INV,0x9d88,   INV, // 63f0..63f7
+	   INV,   INV,0x9768,   INV,    INV,   INV,   INV,   INV, // 63f8..63ff
+    },
+    { //  33: 6400..64ff
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9d8c,   INV, // 6400..6407
+	   INV,   INV,   INV,   INV,    INV,0x91b9,   INV,0x9d93, // 6408..640f
+	   INV,   INV,   INV,0x9d8d,    INV,   INV,0x9d8a,0x9d91, // 6410..6417
+	   INV,   INV,   INV,   INV, 0x9d72,   INV,   INV,   INV, // 6418..641f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9d8e,   INV, // 6420..6427
+	0x9d92,   INV,   INV,   INV, 0x94c0,0x938b,   INV,   INV, // 6428..642f
+	   INV,   INV,   INV,   INV, 0x9d8b,   INV,0x9d8f,   INV, // 6430..6437
+	   INV,   INV,0x8c67,   INV,    INV,   INV,0x8def,   INV, // 6438..643f
+	   INV,   INV,0x90db,   INV,    INV,   INV,   INV,   INV, // 6440..6447
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9d97,   INV, // 6448..644f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6450..6457
+	0x9345,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6458..645f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9d94, // 6460..6467
+	   INV,0x9680,   INV,   INV,    INV,   INV,   INV,0x9d95, // 6468..646f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9d96,   INV, // 6470..6477
+	0x96cc,   INV,0x90a0,   INV,    INV,   INV,   INV,   INV, // 6478..647f
+	   INV,   INV,   INV,0x8c82,    INV,   INV,   INV,   INV, // 6480..6487
+	0x9d9d,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6488..648f
+	   INV,   INV,0x8e54,0x9d9a,    INV,0x9d99,   INV,   INV, // 6490..6497
+	   INV,   INV,0x9451,   INV,    INV,   INV,0x93b3,   INV, // 6498..649f
+	   INV,   INV,   INV,   INV, 0x9350,0x9d9b,   INV,   INV, // 64a0..64a7
+	   INV,0x9d9c,   INV,0x958f,    INV,0x9464,0x8e42,   INV, // 64a8..64af
+	0x90ef,   INV,0x966f,   INV,    INV,   INV,   INV,   INV, // 64b0..64b7
+	   INV,0x8a68,   INV,0x9da3, 0x9d9e,   INV,   INV,   INV, // 64b8..64bf
+	   INV,0x9769,0x9da5,   INV,    INV,0x9da1,   INV,0x9da2, // 64c0..64c7
+	   INV,   INV,   INV,   INV,    INV,0x9180,   INV,   INV, // 64c8..64cf
+	   INV,   INV,0x9da0,   INV, 0x9d5e,   INV,   INV,   INV, // 64d0..64d7
+	0x9da4,   INV,0x9d9f,   INV,    INV,   INV,   INV,   INV, // 64d8..64df
+	0x9da9,0x9daa,0x9346,0x9dac,    INV,   INV,0x8e43,0x9da7, // 64e0..64e7
+	   INV,   INV,   INV,   INV, 0x8b5b,   INV,   INV,0x9dad, // 64e8..64ef
+	   INV,0x9da6,0x9db1,   INV, 0x9db0,   INV,0x9daf,   INV, // 64f0..64f7
+	   INV,   INV,0x9db2,   INV,    INV,0x9db4,0x8fef,   INV, // 64f8..64ff
+    },
+    { //  34: 6500..65ff
+	0x9db3,   INV,   INV,   INV,    INV,0x9db7,   INV,   INV, // 6500..6507
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6508..650f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6510..6517
+	0x9db5,   INV,   INV,   INV, 0x9db6,0x9d90,   INV,   INV, // 6518..651f
+	   INV,   INV,   INV,0x9db9, 0x9db8,   INV,   INV,   INV, // 6520..6527
+	   INV,   INV,0x9d98,0x9dba, 0x9dae,   INV,   INV,0x8e78, // 6528..652f
+	   INV,   INV,   INV,   INV, 0x9dbb,0x9dbc,0x9dbe,0x9dbd, // 6530..6537
+	0x9dbf,0x89fc,   INV,0x8d55,    INV,   INV,0x95fa,0x90ad, // 6538..653f
+	   INV,   INV,   INV,   INV,    INV,0x8ccc,   INV,   INV, // 6540..6547
+	0x9dc1,   INV,   INV,   INV,    INV,0x9dc4,   INV,0x9571, // 6548..654f
+	   INV,0x8b7e,   INV,   INV,    INV,0x9dc3,0x9dc2,0x9473, // 6550..6557
+	0x9dc5,0x8bb3,   INV,   INV,    INV,0x9dc7,0x9dc6,   INV, // 6558..655f
+	   INV,   INV,0x8ab8,0x8e55,    INV,   INV,0x93d6,   INV, // 6560..6567
+	   INV,   INV,   INV,   INV, 0x8c68,   INV,   INV,   INV, // 6568..656f
+	0x9094,   INV,0x9dc8,   INV, 0x90ae,0x9347,   INV,0x957e, // 6570..6577
+	0x9dc9,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6578..657f
+	   INV,   INV,0x9dca,0x9dcb,    INV,   INV,   INV,0x95b6, // 6580..6587
+	0x9b7c,0x90c4,   INV,   INV, 0x956b,   INV,0x8dd6,   INV, // 6588..658f
+	0x94e3,0x94c1,   INV,   INV,    INV,   INV,   INV,0x936c, // 6590..6597
+	   INV,0x97bf,   INV,0x9dcd, 0x8ece,   INV,   INV,0x9dce, // 6598..659f
+	   INV,0x88b4,   INV,   INV, 0x8bd2,0x90cb,   INV,0x9580, // 65a0..65a7
+	   INV,   INV,   INV,0x9dcf, 0x8e61,0x9266,   INV,0x8e7a, // 65a8..65af
+	0x9056,   INV,   INV,   INV,    INV,   INV,   INV,0x9dd0, // 65b0..65b7
+	   INV,0x95fb,   INV,   INV, 0x8997,0x8e7b,   INV,   INV, // 65b8..65bf
+	   INV,0x9dd3,   INV,0x9dd1, 0x9dd4,0x97b7,0x9dd2,   INV, // 65c0..65c7
+	   INV,   INV,   INV,0x90f9, 0x9dd5,   INV,   INV,0x91b0, // 65c8..65cf
+	   INV,   INV,0x9dd6,   INV,    INV,   INV,   INV,0x8af8, // 65d0..65d7
+	   INV,0x9dd8,   INV,0x9dd7,    INV,   INV,   INV,   INV, // 65d8..65df
+	0x9dd9,0x9dda,0x8af9,   INV,    INV,0x93fa,0x9255,0x8b8c, // 65e0..65e7
+	0x8e7c,0x9181,   INV,   INV, 0x8f7b,0x88ae,   INV,   INV, // 65e8..65ef
+	   INV,0x9ddb,   INV,   INV,    INV,   INV,   INV,   INV, // 65f0..65f7
+	   INV,   INV,0x89a0,0x9ddf,    INV,   INV,   INV,   INV, // 65f8..65ff
+    },
+    { //  35: 6600..66ff
+	   INV,   INV,0x8d56,0x9dde,    INV,   INV,0x8da9,0x8fb8, // 6600..6607
+	   INV,   INV,0x9ddd,   INV, 0x8fb9,   INV,0x96be,0x8da8, // 6608..660f
+	   INV,   INV,   INV,0x88d5, 0x90cc,   INV,   INV,   INV, // 6610..6617
+	   INV,   INV,   INV,   INV, 0x9de4,   INV,   INV,0x90af, // 6618..661f
+	0x8966,   INV,   INV,   INV,    INV,0x8f74,   INV,0x9686, // 6620..6627
+	0x8df0,   INV,   INV,   INV,    INV,0x8fba,   INV,0x90a5, // 6628..662f
+	   INV,   INV,   INV,   INV, 0x9de3,0x9de1,0x9de2,   INV, // 6630..6637
+	   INV,   INV,   INV,   INV, 0x928b,   INV,   INV,0x9e45, // 6638..663f
+	   INV,0x9de8,0x8e9e,0x8d57, 0x9de6,   INV,   INV,   INV, // 6640..6647
+	   INV,0x9de7,   INV,0x9057,    INV,   INV,   INV,0x9de5, // 6648..664f
+	   INV,   INV,0x8e4e,   INV,    INV,   INV,   INV,   INV, // 6650..6657
+	   INV,   INV,   INV,   INV,    INV,0x9dea,0x9de9,0x9dee, // 6658..665f
+	   INV,   INV,0x9def,   INV, 0x9deb,   INV,0x8a41,0x9dec, // 6660..6667
+	0x9ded,0x94d3,   INV,   INV,    INV,   INV,0x9581,0x8c69, // 6668..666f
+	0x9df0,   INV,   INV,   INV, 0x90b0,   INV,0x8fbb,   INV, // 6670..6677
+	   INV,   INV,0x9271,   INV,    INV,   INV,   INV,   INV, // 6678..667f
+	   INV,0x8bc5,   INV,0x9df1, 0x9df5,   INV,   INV,0x89c9, // 6680..6687
+	0x9df2,0x9df4,   INV,   INV,    INV,   INV,0x9df3,   INV, // 6688..668f
+	   INV,0x8f8b,   INV,   INV,    INV,   INV,0x9267,0x88c3, // 6690..6697
+	0x9df6,   INV,   INV,   INV,    INV,0x9df7,   INV,   INV, // 6698..669f
+	   INV,   INV,0x92a8,   INV,    INV,   INV,0x97ef,   INV, // 66a0..66a7
+	   INV,   INV,   INV,0x8e62,    INV,   INV,0x95e9,   INV, // 66a8..66af
+	   INV,   INV,   INV,   INV, 0x965c,   INV,   INV,   INV, // 66b0..66b7
+	0x9e41,0x9df9,   INV,   INV, 0x9dfc,   INV,0x9dfb,   INV, // 66b8..66bf
+	   INV,0x9df8,   INV,   INV, 0x9e40,   INV,   INV,0x93dc, // 66c0..66c7
+	   INV,0x9dfa,   INV,   INV,    INV,   INV,   INV,   INV, // 66c8..66cf
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9e42,   INV, // 66d0..66d7
+	   INV,0x8f8c,0x9e43,   INV, 0x976a,0x9498,   INV,   INV, // 66d8..66df
+	0x9e44,   INV,   INV,   INV,    INV,   INV,0x9e46,   INV, // 66e0..66e7
+	   INV,0x9e47,   INV,   INV,    INV,   INV,   INV,   INV, // 66e8..66ef
+	0x9e48,   INV,0x8bc8,0x8967, 0x8d58,0x9e49,   INV,0x9e4a, // 66f0..66f7
+	0x8f91,0x9182,   INV,   INV, 0x99d6,0x915d,0x915c,0x91d6, // 66f8..66ff
+    },
+    { //  36: 6700..67ff
+	0x8dc5,   INV,   INV,0x98f0,    INV,   INV,   INV,   INV, // 6700..6707
+	0x8c8e,0x974c,   INV,0x95fc,    INV,0x959e,   INV,0x9e4b, // 6708..670f
+	   INV,   INV,   INV,   INV, 0x8df1,0x92bd,0x9e4c,0x984e, // 6710..6717
+	   INV,   INV,   INV,0x965d,    INV,0x92a9,0x9e4d,0x8afa, // 6718..671f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9e4e,0x9e4f, // 6720..6727
+	0x96d8,   INV,0x96a2,0x9696, 0x967b,0x8e44,0x9e51,   INV, // 6728..672f
+	   INV,0x8ee9,   INV,   INV, 0x9670,   INV,0x9e53,0x9e56, // 6730..6737
+	0x9e55,   INV,0x8af7,   INV,    INV,0x8b80,   INV,0x9e52, // 6738..673f
+	   INV,0x9e54,   INV,   INV,    INV,   INV,0x9e57,   INV, // 6740..6747
+	   INV,0x9099,   INV,   INV,    INV,   INV,0x979b,0x88c7, // 6748..674f
+	0x8dde,0x91ba,   INV,0x8edb,    INV,   INV,0x8ff1,   INV, // 6750..6757
+	   INV,0x9e5a,   INV,   INV, 0x936d,   INV,0x9e58,0x91a9, // 6758..675f
+	0x9e59,0x8ff0,0x96db,0x9e5b, 0x9e5c,0x9788,   INV,   INV, // 6760..6767
+	   INV,   INV,0x9e61,   INV,    INV,0x8d59,   INV,0x9474, // 6768..676f
+	0x9e5e,0x938c,0x9ddc,0x9de0,    INV,0x8b6e,   INV,0x9466, // 6770..6777
+	   INV,   INV,   INV,   INV, 0x9e60,   INV,0x8fbc,0x94c2, // 6778..677f
+	   INV,   INV,   INV,   INV,    INV,0x9e66,   INV,0x94f8, // 6780..6787
+	   INV,0x9e5d,   INV,0x9e63, 0x9e62,   INV,   INV,   INV, // 6788..678f
+	0x90cd,   INV,   INV,   INV,    INV,0x968d,   INV,0x97d1, // 6790..6797
+	   INV,   INV,0x9687,   INV, 0x89ca,0x8e7d,   INV,   INV, // 6798..679f
+	0x9867,0x9e65,0x9095,   INV,    INV,   INV,0x9e64,   INV, // 67a0..67a7
+	   INV,0x9e5f,   INV,   INV,    INV,   INV,   INV,0x8ccd, // 67a8..67af
+	   INV,   INV,   INV,0x9e6b, 0x9e69,   INV,0x89cb,0x9e67, // 67b0..67b7
+	0x9e6d,0x9e73,   INV,   INV,    INV,   INV,   INV,   INV, // 67b8..67bf
+	   INV,0x91c6,   INV,   INV, 0x95bf,   INV,0x9e75,   INV, // 67c0..67c7
+	   INV,   INV,0x9541,   INV,    INV,   INV,0x9e74,0x9490, // 67c8..67cf
+	0x965e,0x8ab9,   INV,0x90f5, 0x8f5f,   INV,   INV,   INV, // 67d0..67d7
+	0x92d1,   INV,0x974d,   INV,    INV,0x9e70,0x9e6f,   INV, // 67d8..67df
+	   INV,   INV,0x9e71,   INV, 0x9e6e,   INV,   INV,0x9e76, // 67e0..67e7
+	   INV,0x9e6c,   INV,   INV, 0x9e6a,   INV,0x9e72,0x9e68, // 67e8..67ef
+	   INV,0x928c,   INV,0x96f6, 0x8ec4,0x8df2,   INV,   INV, // 67f0..67f7
+	   INV,   INV,   INV,0x8db8,    INV,   INV,0x968f,0x8a60, // 67f8..67ff
+    },
+    { //  37: 6800..68ff
+	   INV,   INV,0x92cc,0x93c8, 0x8968,   INV,   INV,   INV, // 6800..6807
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6808..680f
+	   INV,   INV,   INV,0x90f0,    INV,   INV,0x90b2,0x8c49, // 6810..6817
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9e78,   INV, // 6818..681f
+	   INV,0x8d5a,0x8a9c,   INV,    INV,   INV,   INV,   INV, // 6820..6827
+	   INV,0x9e7a,0x8a94,0x9e81,    INV,   INV,   INV,   INV, // 6828..682f
+	   INV,   INV,0x9e7d,   INV, 0x90f1,   INV,   INV,   INV, // 6830..6837
+	0x8a6a,0x8daa,   INV,   INV, 0x8a69,0x8dcd,   INV,   INV, // 6838..683f
+	0x9e7b,0x8c85,0x8c6a,0x938d,    INV,   INV,0x9e79,   INV, // 6840..6847
+	0x88c4,   INV,   INV,   INV,    INV,0x9e7c,0x9e7e,   INV, // 6848..684f
+	0x8bcb,0x8c4b,   INV,0x8aba, 0x8b6a,   INV,   INV,   INV, // 6850..6857
+	   INV,0x9e82,   INV,   INV, 0x8df7,0x9691,   INV,0x8e56, // 6858..685f
+	   INV,   INV,   INV,0x9e83,    INV,   INV,   INV,0x954f, // 6860..6867
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6868..686f
+	   INV,   INV,   INV,   INV, 0x9e8f,   INV,0x89b1,0x9e84, // 6870..6877
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9e95,0x9e85, // 6878..687f
+	   INV,0x97c0,   INV,0x9e8c,    INV,0x947e,   INV,   INV, // 6880..6887
+	   INV,   INV,   INV,   INV,    INV,0x9e94,   INV,0x9e87, // 6888..688f
+	   INV,   INV,   INV,0x88b2, 0x9e89,   INV,   INV,0x8d5b, // 6890..6897
+	   INV,   INV,   INV,0x9e8b,    INV,0x9e8a,   INV,0x9e86, // 6898..689f
+	0x9e91,   INV,0x8fbd,   INV,    INV,   INV,0x9aeb,0x8ce6, // 68a0..68a7
+	0x979c,   INV,   INV,   INV,    INV,0x9e88,   INV,0x92f2, // 68a8..68af
+	0x8a42,0x8dab,   INV,0x9e80,    INV,0x9e90,0x8a81,   INV, // 68b0..68b7
+	   INV,0x9e8e,0x9e92,   INV, 0x938e,   INV,   INV,   INV, // 68b8..68bf
+	   INV,   INV,   INV,   INV, 0x8afc,   INV,0x9eb0,   INV, // 68c0..68c7
+	   INV,0x96c7,0x9e97,0x8afb,    INV,0x9e9e,   INV,   INV, // 68c8..68cf
+	   INV,   INV,0x965f,   INV, 0x9e9f,0x9ea1,   INV,0x9ea5, // 68d0..68d7
+	0x9e99,   INV,0x9249,   INV,    INV,   INV,   INV,0x938f, // 68d8..68df
+	0x9ea9,0x9e9c,   INV,0x9ea6,    INV,   INV,   INV,0x9ea0, // 68e0..68e7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9058,0x9eaa, // 68e8..68ef
+	   INV,   INV,0x90b1,   INV,    INV,   INV,   INV,   INV, // 68f0..68f7
+	   INV,0x9ea8,0x8abb,   INV,    INV,   INV,   INV,   INV, // 68f8..68ff
+    },
+    { //  38: 6900..69ff
+	0x986f,0x9e96,   INV,   INV, 0x9ea4,0x88d6,   INV,   INV, // 6900..6907
+	0x9e98,   INV,   INV,0x96b8, 0x9e9d,0x9041,0x92c5,0x9e93, // 6908..690f
+	   INV,   INV,0x9ea3,   INV,    INV,   INV,   INV,   INV, // 6910..6917
+	   INV,0x909a,0x9ead,0x8a91, 0x8c9f,   INV,   INV,   INV, // 6918..691f
+	   INV,0x9eaf,0x9e9a,0x9eae,    INV,0x9ea7,0x9e9b,   INV, // 6920..6927
+	0x9eab,   INV,0x9eac,   INV,    INV,   INV,   INV,   INV, // 6928..692f
+	0x9ebd,   INV,   INV,   INV, 0x93cc,   INV,0x9ea2,   INV, // 6930..6937
+	   INV,0x9eb9,   INV,   INV,    INV,0x9ebb,   INV,0x92d6, // 6938..693f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6940..6947
+	   INV,   INV,0x976b,   INV,    INV,   INV,   INV,   INV, // 6948..694f
+	   INV,   INV,   INV,0x9596, 0x9eb6,0x91c8,   INV,   INV, // 6950..6957
+	   INV,0x9ebc,0x915e,   INV, 0x9eb3,0x9ec0,0x9ebf,   INV, // 6958..695f
+	0x93ed,0x9ebe,0x93e8,   INV,    INV,   INV,   INV,   INV, // 6960..6967
+	   INV,   INV,0x9ec2,0x9eb5,    INV,0x8bc6,0x9eb8,0x8f7c, // 6968..696f
+	   INV,   INV,   INV,0x9480, 0x9eba,0x8bc9,   INV,0x9eb2, // 6970..6977
+	0x9eb4,0x9eb1,   INV,   INV, 0x984f,0x8a79,0x9eb7,   INV, // 6978..697f
+	   INV,0x9ec1,0x8a54,   INV,    INV,   INV,   INV,   INV, // 6980..6987
+	   INV,   INV,0x8de5,   INV,    INV,   INV,0x897c,   INV, // 6988..698f
+	   INV,0x9ed2,   INV,   INV, 0x9850,0x9ed5,   INV,   INV, // 6990..6997
+	   INV,   INV,   INV,0x9059, 0x9ed4,   INV,   INV,   INV, // 6998..699f
+	0x9ed3,   INV,   INV,   INV,    INV,   INV,   INV,0x9ed0, // 69a0..69a7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9ec4,   INV, // 69a8..69af
+	   INV,0x9ee1,0x9ec3,   INV, 0x9ed6,   INV,   INV,   INV, // 69b0..69b7
+	   INV,   INV,   INV,0x9ece,    INV,   INV,0x9ec9,0x9ec6, // 69b8..69bf
+	   INV,0x9ec7,   INV,0x9ecf,    INV,   INV,   INV,0xeaa0, // 69c0..69c7
+	   INV,   INV,0x9ecc,0x8d5c, 0x92c6,0x9184,0x9eca,   INV, // 69c8..69cf
+	0x9ec5,   INV,   INV,0x9ec8,    INV,   INV,   INV,   INV, // 69d0..69d7
+	0x976c,0x968a,   INV,   INV,    INV,0x9ecd,0x9ed7,   INV, // 69d8..69df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9edf, // 69e0..69e7
+	0x9ed8,   INV,   INV,0x9ee5,    INV,0x9ee3,   INV,   INV, // 69e8..69ef
+	   INV,   INV,0x9ede,   INV,    INV,   INV,   INV,   INV, // 69f0..69f7
+	   INV,0x9edd,   INV,0x92ce,    INV,0x9185,   INV,0x9edb, // 69f8..69ff
+    },
+    { //  39: 6a00..6aff
+	   INV,   INV,0x9ed9,   INV,    INV,0x9ee0,   INV,   INV, // 6a00..6a07
+	   INV,   INV,0x9ee6,0x94f3, 0x9eec,   INV,   INV,   INV, // 6a08..6a0f
+	   INV,   INV,0x9ee7,0x9eea, 0x9ee4,   INV,   INV,0x9294, // 6a10..6a17
+	   INV,0x9557,   INV,0x9eda,    INV,   INV,0x9ee2,0x8fbe, // 6a18..6a1f
+	   INV,0x96cd,0x9ef6,0x9ee9,    INV,   INV,   INV,   INV, // 6a20..6a27
+	   INV,0x8ca0,0x89a1,0x8a7e,    INV,   INV,0x9ed1,   INV, // 6a28..6a2f
+	   INV,   INV,   INV,   INV,    INV,0x8fbf,0x9eee,   INV, // 6a30..6a37
+	0x9ef5,0x8ef7,0x8a92,   INV,    INV,0x924d,   INV,   INV, // 6a38..6a3f
+	   INV,   INV,   INV,   INV, 0x9eeb,   INV,   INV,0x9ef0, // 6a40..6a47
+	0x9ef4,   INV,   INV,0x8bb4,    INV,   INV,   INV,   INV, // 6a48..6a4f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6a50..6a57
+	0x8b6b,0x9ef2,   INV,   INV,    INV,   INV,   INV,0x8b40, // 6a58..6a5f
+	   INV,0x93c9,0x9ef1,   INV,    INV,   INV,0x9ef3,   INV, // 6a60..6a67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6a68..6a6f
+	   INV,   INV,0x9eed,   INV,    INV,   INV,   INV,   INV, // 6a70..6a77
+	0x9eef,   INV,   INV,   INV,    INV,   INV,   INV,0x8a80, // 6a78..6a7f
+	0x9268,   INV,   INV,   INV, 0x9efa,   INV,   INV,   INV, // 6a80..6a87
+	   INV,   INV,   INV,   INV,    INV,0x9ef8,0x8ce7,   INV, // 6a88..6a8f
+	0x9ef7,   INV,   INV,   INV,    INV,   INV,   INV,0x9f40, // 6a90..6a97
+	   INV,   INV,   INV,   INV, 0x9e77,   INV,   INV,   INV, // 6a98..6a9f
+	0x9ef9,   INV,0x9efb,0x9efc,    INV,   INV,   INV,   INV, // 6aa0..6aa7
+	   INV,   INV,0x9f4b,   INV, 0x9f47,   INV,0x9e8d,   INV, // 6aa8..6aaf
+	   INV,   INV,   INV,0x9f46,    INV,   INV,   INV,   INV, // 6ab0..6ab7
+	0x9f45,   INV,   INV,0x9f42,    INV,   INV,   INV,   INV, // 6ab8..6abf
+	   INV,0x9ee8,0x9f44,0x9f43,    INV,   INV,   INV,   INV, // 6ac0..6ac7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6ac8..6acf
+	   INV,0x9f49,   INV,0x9845,    INV,   INV,   INV,   INV, // 6ad0..6ad7
+	   INV,   INV,0x9f4c,0x8bf9,    INV,   INV,0x9f48,0x9f4a, // 6ad8..6adf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6ae0..6ae7
+	0x94a5,   INV,0x9f4d,   INV,    INV,   INV,   INV,   INV, // 6ae8..6aef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6af0..6af7
+	   INV,   INV,0x9f51,0x9f4e,    INV,   INV,   INV,   INV, // 6af8..6aff
+    },
+    { //  40: 6b00..6bff
+	   INV,   INV,   INV,   INV, 0x9793,0x9f4f,   INV,   INV, // 6b00..6b07
+	   INV,   INV,0x9edc,   INV,    INV,   INV,   INV,   INV, // 6b08..6b0f
+	   INV,   INV,0x9f52,   INV,    INV,   INV,0x9f53,   INV, // 6b10..6b17
+	   INV,   INV,   INV,   INV,    INV,0x8954,   INV,0x9f55, // 6b18..6b1f
+	0x8c87,0x8e9f,   INV,0x8bd3,    INV,   INV,   INV,0x89a2, // 6b20..6b27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6b28..6b2f
+	   INV,   INV,0x977e,   INV,    INV,   INV,   INV,0x9f57, // 6b30..6b37
+	0x9f56,0x9f59,0x8b5c,   INV,    INV,0x8bd4,0x8abc,   INV, // 6b38..6b3f
+	   INV,   INV,   INV,0x9f5c,    INV,   INV,   INV,0x9f5b, // 6b40..6b47
+	   INV,0x9f5d,   INV,   INV, 0x89cc,   INV,0x9256,   INV, // 6b48..6b4f
+	0x9f5e,   INV,   INV,0x8abd, 0x9f60,   INV,   INV,   INV, // 6b50..6b57
+	   INV,0x9f5f,   INV,0x9f61,    INV,   INV,   INV,0x9f62, // 6b58..6b5f
+	   INV,0x9f63,0x8e7e,0x90b3, 0x8d9f,   INV,0x9590,   INV, // 6b60..6b67
+	   INV,0x95e0,0x9863,   INV,    INV,   INV,   INV,0x8e95, // 6b68..6b6f
+	   INV,   INV,   INV,0x8dce, 0x97f0,   INV,   INV,   INV, // 6b70..6b77
+	0x9f64,0x9f65,   INV,0x8e80,    INV,   INV,   INV,0x9f66, // 6b78..6b7f
+	0x9f67,   INV,   INV,0x9f69, 0x9f68,   INV,0x9677,   INV, // 6b80..6b87
+	   INV,0x8f7d,0x8eea,0x8e63,    INV,0x9f6a,   INV,   INV, // 6b88..6b8f
+	   INV,   INV,   INV,   INV,    INV,0x9f6c,0x9042,   INV, // 6b90..6b97
+	0x9f6b,   INV,   INV,   INV,    INV,   INV,0x9f6d,   INV, // 6b98..6b9f
+	   INV,   INV,   INV,   INV, 0x9f6e,   INV,   INV,   INV, // 6ba0..6ba7
+	   INV,   INV,0x9f6f,0x9f70,    INV,   INV,   INV,0x9f71, // 6ba8..6baf
+	   INV,0x9f73,0x9f72,0x9f74, 0x89a3,0x9269,   INV,0x9f75, // 6bb0..6bb7
+	   INV,   INV,0x8e45,0x8a6b, 0x9f76,   INV,   INV,0x9361, // 6bb8..6bbf
+	0x9aca,   INV,   INV,   INV,    INV,0x8b42,0x9f77,   INV, // 6bc0..6bc7
+	   INV,   INV,   INV,0x9f78,    INV,0x95ea,0x9688,   INV, // 6bc8..6bcf
+	   INV,   INV,0x93c5,0x9f79, 0x94e4,   INV,   INV,   INV, // 6bd0..6bd7
+	0x94f9,   INV,   INV,0x96d1,    INV,   INV,   INV,0x9f7a, // 6bd8..6bdf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6be0..6be7
+	   INV,   INV,   INV,0x9f7c, 0x9f7b,   INV,   INV,0x9f7e, // 6be8..6bef
+	   INV,   INV,   INV,0x9f7d,    INV,   INV,   INV,   INV, // 6bf0..6bf7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6bf8..6bff
+    },
+    { //  41: 6c00..6cff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6c00..6c07
+	0x9f81,   INV,   INV,   INV,    INV,   INV,   INV,0x8e81, // 6c08..6c0f
+	   INV,0x96af,   INV,0x9f82, 0x9f83,   INV,   INV,0x8b43, // 6c10..6c17
+	   INV,   INV,   INV,0x9f84,    INV,   INV,   INV,   INV, // 6c18..6c1f
+	   INV,   INV,   INV,0x9f86, 0x9f85,   INV,   INV,   INV, // 6c20..6c27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6c28..6c2f
+	   INV,   INV,   INV,   INV, 0x9085,   INV,   INV,0x9558, // 6c30..6c37
+	0x8969,   INV,   INV,   INV,    INV,   INV,0x94c3,   INV, // 6c38..6c3f
+	0x92f3,0x8f60,0x8b81,   INV,    INV,   INV,   INV,   INV, // 6c40..6c47
+	   INV,   INV,   INV,   INV,    INV,   INV,0x94c4,   INV, // 6c48..6c4f
+	0x8eac,   INV,   INV,   INV,    INV,0x9f88,   INV,0x8abe, // 6c50..6c57
+	   INV,   INV,0x8998,   INV,    INV,0x93f0,0x9f87,0x8d5d, // 6c58..6c5f
+	0x9272,   INV,0x9f89,   INV,    INV,   INV,   INV,   INV, // 6c60..6c67
+	0x9f91,   INV,0x9f8a,   INV,    INV,   INV,   INV,   INV, // 6c68..6c6f
+	0x91bf,   INV,0x8b82,0x9f92,    INV,   INV,   INV,   INV, // 6c70..6c77
+	   INV,   INV,0x8c88,   INV,    INV,0x8b44,0x9f90,   INV, // 6c78..6c7f
+	   INV,0x9f8e,0x9f8b,0x9780,    INV,   INV,   INV,   INV, // 6c80..6c87
+	0x92be,   INV,   INV,   INV, 0x93d7,0x9f8c,   INV,   INV, // 6c88..6c8f
+	0x9f94,   INV,0x9f93,0x8c42,    INV,   INV,0x89ab,   INV, // 6c90..6c97
+	   INV,0x8db9,0x9f8d,0x9f8f,    INV,   INV,   INV,   INV, // 6c98..6c9f
+	   INV,0x9676,0x91f2,   INV,    INV,   INV,   INV,   INV, // 6ca0..6ca7
+	   INV,   INV,   INV,0x9697,    INV,   INV,0x9f9c,   INV, // 6ca8..6caf
+	   INV,0x9f9d,   INV,0x89cd,    INV,   INV,   INV,   INV, // 6cb0..6cb7
+	0x95a6,0x96fb,0x9f9f,0x8ea1, 0x8fc0,0x9f98,0x9f9e,0x8988, // 6cb8..6cbf
+	   INV,0x8bb5,   INV,   INV, 0x9f95,0x9f9a,   INV,   INV, // 6cc0..6cc7
+	   INV,0x90f2,0x9491,   INV, 0x94e5,   INV,   INV,   INV, // 6cc8..6ccf
+	   INV,   INV,   INV,0x9f97,    INV,0x9640,   INV,0x9f99, // 6cd0..6cd7
+	   INV,0x9fa2,   INV,0x9fa0,    INV,0x9f9b,   INV,   INV, // 6cd8..6cdf
+	   INV,0x9641,0x9467,0x8b83,    INV,0x9344,   INV,   INV, // 6ce0..6ce7
+	0x928d,   INV,0x9fa3,   INV,    INV,   INV,   INV,0x9fa1, // 6ce8..6cef
+	0x91d7,0x9f96,   INV,0x896a,    INV,   INV,   INV,   INV, // 6cf0..6cf7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6cf8..6cff
+    },
+    { //  42: 6d00..6dff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6d00..6d07
+	   INV,   INV,   INV,0x976d, 0x9fae,   INV,   INV,   INV, // 6d08..6d0f
+	   INV,   INV,0x9fad,   INV,    INV,   INV,   INV,0x90f4, // 6d10..6d17
+	   INV,0x9faa,   INV,0x978c,    INV,   INV,0x93b4,0x9fa4, // 6d18..6d1f
+	   INV,   INV,   INV,   INV,    INV,0x92c3,   INV,   INV, // 6d20..6d27
+	   INV,0x896b,0x8d5e,0x9fa7,    INV,   INV,   INV,   INV, // 6d28..6d2f
+	   INV,   INV,0x8f46,0x9fac,    INV,0x9fab,0x9fa6,   INV, // 6d30..6d37
+	0x9fa9,   INV,   INV,0x8a88,    INV,0x9fa8,0x9468,   INV, // 6d38..6d3f
+	   INV,0x97ac,   INV,   INV, 0x8ff2,0x90f3,   INV,   INV, // 6d40..6d47
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6d48..6d4f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6d50..6d57
+	   INV,0x9fb4,0x9fb2,   INV, 0x956c,   INV,   INV,   INV, // 6d58..6d5f
+	   INV,   INV,   INV,0x9faf, 0x9fb1,   INV,0x8959,   INV, // 6d60..6d67
+	   INV,0x8d5f,0x9851,   INV, 0x8a5c,   INV,0x9582,   INV, // 6d68..6d6f
+	   INV,   INV,   INV,   INV, 0x9781,   INV,   INV,0x8a43, // 6d70..6d77
+	0x905a,0x9fb3,   INV,   INV,    INV,   INV,   INV,   INV, // 6d78..6d7f
+	   INV,   INV,   INV,   INV,    INV,0x9fb8,   INV,   INV, // 6d80..6d87
+	0x8fc1,   INV,   INV,   INV, 0x974f,   INV,0x9fb5,   INV, // 6d88..6d8f
+	   INV,   INV,   INV,0x9fb0,    INV,0x9fb6,   INV,   INV, // 6d90..6d97
+	   INV,0x97dc,   INV,0x9393, 0x93c0,   INV,   INV,   INV, // 6d98..6d9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6da0..6da7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x8a55, // 6da8..6daf
+	   INV,   INV,0x8974,   INV,    INV,0x9fbc,   INV,   INV, // 6db0..6db7
+	0x9fbf,   INV,   INV,   INV, 0x97c1,   INV,   INV,   INV, // 6db8..6dbf
+	0x9784,   INV,   INV,   INV,    INV,0x9fc6,0x9fc0,0x9fbd, // 6dc0..6dc7
+	   INV,   INV,   INV,0x97d2, 0x9fc3,   INV,   INV,   INV, // 6dc8..6dcf
+	   INV,0x8f69,0x9fc5,   INV,    INV,0x9fca,   INV,   INV, // 6dd0..6dd7
+	0x9391,0x9fc8,   INV,   INV,    INV,   INV,0x9fc2,   INV, // 6dd8..6ddf
+	   INV,0x9257,   INV,   INV, 0x9fc9,   INV,0x9fbe,   INV, // 6de0..6de7
+	0x9fc4,   INV,0x9fcb,0x88fa, 0x9fc1,   INV,0x9fcc,   INV, // 6de8..6def
+	   INV,0x905b,   INV,0x8f7e,    INV,0x95a3,   INV,0x8dac, // 6df0..6df7
+	   INV,0x9fb9,0x9fc7,0x9359,    INV,   INV,   INV,   INV, // 6df8..6dff
+    },
+    { //  43: 6e00..6eff
+	   INV,   INV,   INV,   INV,    INV,0x90b4,   INV,0x8a89, // 6e00..6e07
+	0x8dcf,0x8fc2,0x9fbb,0x8f61,    INV,   INV,   INV,   INV, // 6e08..6e0f
+	   INV,   INV,   INV,0x8c6b,    INV,0x9fba,   INV,   INV, // 6e10..6e17
+	   INV,0x9fd0,0x8f8d,0x8cb8,    INV,0x9fdf,   INV,0x9fd9, // 6e18..6e1f
+	0x8b94,0x936e,   INV,0x9fd4, 0x9fdd,0x88ad,0x8951,   INV, // 6e20..6e27
+	   INV,0x89b7,   INV,0x9fd6, 0x91aa,0x9fcd,0x9fcf,0x8d60, // 6e28..6e2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6e30..6e37
+	0x9fe0,   INV,0x9fdb,   INV,    INV,   INV,0x9fd3,   INV, // 6e38..6e3f
+	   INV,   INV,   INV,0x9fda,    INV,   INV,   INV,   INV, // 6e40..6e47
+	   INV,   INV,0x96a9,   INV,    INV,0x9fd8,0x9fdc,   INV, // 6e48..6e4f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8cce,   INV, // 6e50..6e57
+	0x8fc3,   INV,   INV,0x9258,    INV,   INV,   INV,0x9fd2, // 6e58..6e5f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x974e, // 6e60..6e67
+	   INV,   INV,   INV,0x9fd5,    INV,   INV,0x9fce,0x9392, // 6e68..6e6f
+	   INV,   INV,0x9fd1,   INV,    INV,   INV,0x9fd7,   INV, // 6e70..6e77
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9870,0x8ebc, // 6e78..6e7f
+	0x969e,   INV,0x9fe1,   INV,    INV,   INV,   INV,   INV, // 6e80..6e87
+	   INV,   INV,   INV,   INV, 0x94ac,   INV,   INV,0x9fed, // 6e88..6e8f
+	0x8cb9,   INV,   INV,   INV,    INV,   INV,0x8f80,   INV, // 6e90..6e97
+	0x9fe3,   INV,   INV,   INV, 0x97ad,0x8d61,   INV,0x9ff0, // 6e98..6e9f
+	   INV,   INV,0x88ec,   INV,    INV,0x9fee,   INV,   INV, // 6ea0..6ea7
+	   INV,   INV,0x9fe2,   INV,    INV,   INV,   INV,0x9fe8, // 6ea8..6eaf
+	   INV,   INV,0x9fea,   INV,    INV,   INV,0x976e,0x9fe5, // 6eb0..6eb7
+	   INV,   INV,0x934d,   INV,    INV,0x9fe7,   INV,   INV, // 6eb8..6ebf
+	   INV,   INV,0x9fef,   INV, 0x9fe9,0x96c5,   INV,   INV, // 6ec0..6ec7
+	   INV,0x9fe4,   INV,0x8ea0, 0x9ffc,   INV,   INV,   INV, // 6ec8..6ecf
+	   INV,0x8a8a,   INV,0x9fe6, 0x9feb,0x9fec,   INV,   INV, // 6ed0..6ed7
+	   INV,   INV,   INV,   INV,    INV,0x91ea,0x91d8,   INV, // 6ed8..6edf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6ee0..6ee7
+	   INV,   INV,   INV,   INV, 0x9ff4,   INV,   INV,0x9ffa, // 6ee8..6eef
+	   INV,   INV,0x9ff8,   INV, 0x9348,   INV,   INV,0xe042, // 6ef0..6ef7
+	0x9ff5,   INV,   INV,   INV,    INV,   INV,0x9ff6,0x9fde, // 6ef8..6eff
+    },
+    { //  44: 6f00..6fff
+	   INV,0x8b99,0x9559,   INV,    INV,   INV,0x8ebd,   INV, // 6f00..6f07
+	   INV,0x8d97,   INV,   INV,    INV,   INV,   INV,0x9852, // 6f08..6f0f
+	   INV,0x9ff2,   INV,0xe041, 0x8989,0x9186,   INV,   INV, // 6f10..6f17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6f18..6f1f
+	0x9499,   INV,0x8abf,0x97f8,    INV,   INV,   INV,   INV, // 6f20..6f27
+	   INV,   INV,   INV,0x969f, 0x92d0,   INV,   INV,   INV, // 6f28..6f2f
+	   INV,0x9ff9,0x9ffb,   INV,    INV,   INV,   INV,   INV, // 6f30..6f37
+	0x9151,   INV,   INV,   INV,    INV,   INV,0xe040,0x9ff7, // 6f38..6f3f
+	   INV,0x9ff1,   INV,   INV,    INV,0x8ac1,   INV,   INV, // 6f40..6f47
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6f48..6f4f
+	   INV,   INV,   INV,   INV, 0x8c89,   INV,   INV,   INV, // 6f50..6f57
+	0xe04e,   INV,   INV,0xe049, 0x90f6,   INV,   INV,0x8a83, // 6f58..6f5f
+	   INV,   INV,   INV,   INV, 0x8f81,   INV,0xe052,   INV, // 6f60..6f67
+	   INV,   INV,   INV,   INV,    INV,0xe04b,0x92aa,0xe048, // 6f68..6f6f
+	0x92d7,   INV,   INV,   INV, 0xe06b,   INV,   INV,   INV, // 6f70..6f77
+	0xe045,   INV,0xe044,   INV, 0xe04d,   INV,   INV,   INV, // 6f78..6f7f
+	0xe047,0xe046,0xe04c,   INV, 0x909f,   INV,0xe043,   INV, // 6f80..6f87
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe04f,   INV, // 6f88..6f8f
+	   INV,0xe050,   INV,   INV,    INV,   INV,   INV,0x8ac0, // 6f90..6f97
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6f98..6f9f
+	   INV,0xe055,   INV,0xe054, 0xe056,   INV,   INV,   INV, // 6fa0..6fa7
+	   INV,   INV,0xe059,   INV,    INV,   INV,   INV,   INV, // 6fa8..6faf
+	   INV,0x9362,   INV,0xe053,    INV,   INV,   INV,   INV, // 6fb0..6fb7
+	   INV,0xe057,   INV,   INV,    INV,   INV,   INV,   INV, // 6fb8..6fbf
+	0x8c83,0x91f7,0xe051,0x945a,    INV,   INV,0xe058,   INV, // 6fc0..6fc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 6fc8..6fcf
+	   INV,   INV,   INV,   INV, 0xe05d,0xe05b,   INV,   INV, // 6fd0..6fd7
+	0xe05e,   INV,   INV,0xe061,    INV,   INV,   INV,0xe05a, // 6fd8..6fdf
+	0x8d8a,0x9447,   INV,   INV, 0x9fb7,   INV,   INV,   INV, // 6fe0..6fe7
+	   INV,   INV,   INV,0x9794, 0xe05c,   INV,0xe060,0x91f3, // 6fe8..6fef
+	   INV,0xe05f,   INV,0xe04a,    INV,   INV,0xe889,   INV, // 6ff0..6ff7
+	   INV,   INV,0xe064,   INV,    INV,   INV,0xe068,   INV, // 6ff8..6fff
+    },
+    { //  45: 7000..70ff
+	   INV,0xe066,   INV,   INV,    INV,   INV,   INV,   INV, // 7000..7007
+	   INV,0xe062,   INV,0xe063,    INV,   INV,   INV,0xe067, // 7008..700f
+	   INV,0xe065,   INV,   INV,    INV,0x956d,   INV,   INV, // 7010..7017
+	0xe06d,   INV,0xe06a,0xe069,    INV,0xe06c,0x93d2,0xe06e, // 7018..701f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9295,0x91eb, // 7020..7027
+	   INV,   INV,   INV,   INV, 0x90a3,   INV,   INV,   INV, // 7028..702f
+	0xe06f,   INV,0xe071,   INV,    INV,   INV,   INV,   INV, // 7030..7037
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe070,   INV, // 7038..703f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7040..7047
+	   INV,   INV,   INV,   INV, 0x9ff3,   INV,   INV,   INV, // 7048..704f
+	   INV,0xe072,   INV,   INV,    INV,   INV,   INV,   INV, // 7050..7057
+	0x93e5,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7058..705f
+	   INV,   INV,   INV,0xe073,    INV,   INV,   INV,   INV, // 7060..7067
+	   INV,   INV,   INV,0x89ce,    INV,   INV,   INV,0x9394, // 7068..706f
+	0x8a44,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7070..7077
+	0x8b84,   INV,   INV,   INV, 0x8edc,0x8dd0,   INV,   INV, // 7078..707f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7080..7087
+	   INV,0x9846,0x9086,   INV,    INV,   INV,0x898a,   INV, // 7088..708f
+	   INV,   INV,0xe075,   INV,    INV,   INV,   INV,   INV, // 7090..7097
+	   INV,0xe074,   INV,   INV,    INV,   INV,   INV,   INV, // 7098..709f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 70a0..70a7
+	   INV,   INV,   INV,   INV, 0xe078,0x9259,0xe07b,0xe076, // 70a8..70af
+	   INV,   INV,   INV,0xe07a,    INV,   INV,   INV,   INV, // 70b0..70b7
+	0xe079,0x935f,0x88d7,   INV,    INV,   INV,   INV,   INV, // 70b8..70bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 70c0..70c7
+	0x97f3,   INV,   INV,0xe07d,    INV,   INV,   INV,0x8947, // 70c8..70cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 70d0..70d7
+	   INV,0xe080,   INV,   INV,    INV,0xe07e,   INV,0xe07c, // 70d8..70df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 70e0..70e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 70e8..70ef
+	   INV,0xe077,   INV,   INV,    INV,   INV,   INV,   INV, // 70f0..70f7
+	   INV,0x9642,   INV,   INV,    INV,0xe082,   INV,   INV, // 70f8..70ff
+    },
+    { //  46: 7100..71ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7100..7107
+	   INV,0xe081,   INV,   INV,    INV,   INV,   INV,   INV, // 7108..710f
+	   INV,   INV,   INV,   INV, 0x898b,   INV,   INV,   INV, // 7110..7117
+	   INV,0xe084,0x95b0,   INV, 0xe083,   INV,   INV,   INV, // 7118..711f
+	   INV,0x96b3,   INV,   INV,    INV,   INV,0x8fc5,   INV, // 7120..7127
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7128..712f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9152,   INV, // 7130..7137
+	   INV,   INV,   INV,   INV, 0x8fc4,   INV,   INV,   INV, // 7138..713f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7140..7147
+	   INV,0x97f9,   INV,   INV, 0xe08a,   INV,0x90f7,   INV, // 7148..714f
+	   INV,   INV,   INV,   INV,    INV,0xe086,0xe08b,   INV, // 7150..7157
+	   INV,0x898c,   INV,   INV,    INV,   INV,   INV,   INV, // 7158..715f
+	   INV,   INV,0xe089,   INV, 0x9481,0xe085,0xe088,0x8fc6, // 7160..7167
+	   INV,0x94cf,   INV,   INV, 0xe08c,   INV,0x8ecf,   INV, // 7168..716f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7170..7177
+	   INV,   INV,   INV,   INV,    INV,0x90f8,   INV,   INV, // 7178..717f
+	   INV,   INV,   INV,   INV, 0xe08f,   INV,   INV,   INV, // 7180..7187
+	0xe087,   INV,0x8c46,   INV,    INV,   INV,   INV,0xe08d, // 7188..718f
+	   INV,   INV,   INV,   INV, 0x976f,0xe090,   INV,   INV, // 7190..7197
+	   INV,0xeaa4,   INV,   INV,    INV,   INV,   INV,0x8f6e, // 7198..719f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 71a0..71a7
+	0xe091,   INV,   INV,   INV, 0xe092,   INV,   INV,   INV, // 71a8..71af
+	   INV,0x944d,   INV,   INV,    INV,   INV,   INV,   INV, // 71b0..71b7
+	   INV,0xe094,   INV,   INV,    INV,   INV,0xe095,   INV, // 71b8..71bf
+	   INV,   INV,   INV,0x9452,    INV,   INV,   INV,   INV, // 71c0..71c7
+	0x9395,0xe097,   INV,   INV,    INV,   INV,0xe099,   INV, // 71c8..71cf
+	0x97d3,   INV,0xe096,   INV, 0xe098,0x898d,   INV,0xe093, // 71d0..71d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9a7a, // 71d8..71df
+	0xe09a,   INV,   INV,   INV,    INV,0x9187,0x8e57,0xe09c, // 71e0..71e7
+	   INV,   INV,   INV,   INV, 0xe09b,0x9043,0x99d7,   INV, // 71e8..71ef
+	   INV,   INV,   INV,   INV,    INV,0xe09d,   INV,   INV, // 71f0..71f7
+	   INV,0xe09f,   INV,0xe08e, 0xe09e,   INV,   INV,0xe0a0, // 71f8..71ff
+    },
+    { //  47: 7200..72ff
+	   INV,   INV,   INV,   INV,    INV,   INV,0x949a,   INV, // 7200..7207
+	   INV,   INV,   INV,   INV,    INV,0xe0a1,   INV,   INV, // 7208..720f
+	0xe0a2,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7210..7217
+	   INV,   INV,   INV,0xe0a3,    INV,   INV,   INV,   INV, // 7218..721f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7220..7227
+	0xe0a4,   INV,0x92dc,   INV, 0xe0a6,0xe0a5,   INV,   INV, // 7228..722f
+	0xe0a7,   INV,0xe0a8,   INV,    INV,0x8edd,0x9583,   INV, // 7230..7237
+	   INV,   INV,0x96ea,0xe0a9, 0xe0aa,0x9175,0x8ea2,0xe0ab, // 7238..723f
+	0xe0ac,   INV,   INV,   INV,    INV,   INV,0xe0ad,0x95d0, // 7240..7247
+	0x94c5,   INV,   INV,0xe0ae, 0x9476,   INV,   INV,   INV, // 7248..724f
+	   INV,   INV,0x92ab,   INV,    INV,   INV,   INV,   INV, // 7250..7257
+	0xe0af,0x89e5,   INV,0x8b8d,    INV,0x96c4,   INV,0x96b4, // 7258..725f
+	   INV,0x89b2,0x9853,   INV,    INV,   INV,   INV,0x9671, // 7260..7267
+	   INV,0x95a8,   INV,   INV,    INV,   INV,   INV,   INV, // 7268..726f
+	   INV,   INV,0x90b5,   INV, 0xe0b0,   INV,   INV,   INV, // 7270..7277
+	   INV,0x93c1,   INV,   INV,    INV,0x8ca1,0xe0b1,   INV, // 7278..727f
+	0x8dd2,0xe0b3,0xe0b2,   INV,    INV,   INV,   INV,0xe0b4, // 7280..7287
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7288..728f
+	   INV,   INV,0xe0b5,   INV,    INV,   INV,0xe0b6,   INV, // 7290..7297
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7298..729f
+	0x8b5d,   INV,0xe0b7,   INV,    INV,   INV,   INV,0xe0b8, // 72a0..72a7
+	   INV,   INV,   INV,   INV, 0x8ca2,   INV,   INV,0x94c6, // 72a8..72af
+	   INV,   INV,0xe0ba,   INV,    INV,   INV,0x8ff3,   INV, // 72b0..72b7
+	   INV,0xe0b9,   INV,   INV,    INV,   INV,   INV,   INV, // 72b8..72bf
+	   INV,   INV,0x8bb6,0xe0bb, 0xe0bd,   INV,0xe0bc,   INV, // 72c0..72c7
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0be,   INV, // 72c8..72cf
+	0x8ccf,   INV,0xe0bf,   INV,    INV,   INV,   INV,0x8be7, // 72d0..72d7
+	   INV,0x915f,   INV,0x8d9d,    INV,   INV,   INV,   INV, // 72d8..72df
+	0xe0c1,0xe0c2,0xe0c0,   INV,    INV,   INV,   INV,   INV, // 72e0..72e7
+	   INV,0x8eeb,   INV,   INV, 0x93c6,0x8bb7,   INV,   INV, // 72e8..72ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe0c4, // 72f0..72f7
+	0x924b,0xe0c3,   INV,   INV, 0x9854,0x9482,   INV,   INV, // 72f8..72ff
+    },
+    { //  48: 7300..73ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7300..7307
+	   INV,   INV,0xe0c7,   INV,    INV,   INV,   INV,   INV, // 7308..730f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0c9,0xe0c6, // 7310..7317
+	   INV,   INV,   INV,0x96d2, 0xe0c8,0xe0ca,   INV,0x97c2, // 7318..731f
+	   INV,   INV,   INV,   INV,    INV,0xe0ce,   INV,   INV, // 7320..7327
+	   INV,0xe0cd,0x9296,0x944c,    INV,   INV,0x8ca3,0xe0cc, // 7328..732f
+	   INV,   INV,   INV,   INV, 0xe0cb,   INV,0x9750,0x9751, // 7330..7337
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0cf,0x898e, // 7338..733f
+	   INV,   INV,   INV,   INV, 0x8d96,0x8e82,   INV,   INV, // 7340..7347
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0d0,0xe0d1, // 7348..734f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe0d3, // 7350..7357
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7358..735f
+	   INV,   INV,   INV,0x8f62,    INV,   INV,   INV,   INV, // 7360..7367
+	0xe0d5,   INV,0xe0d4,   INV,    INV,   INV,   INV,   INV, // 7368..736f
+	0xe0d6,   INV,0x8a6c,   INV,    INV,0xe0d8,   INV,   INV, // 7370..7377
+	0xe0d7,   INV,0xe0da,0xe0d9,    INV,   INV,   INV,   INV, // 7378..737f
+	   INV,   INV,   INV,   INV, 0x8cba,   INV,   INV,0x97a6, // 7380..7387
+	   INV,0x8bca,   INV,0x89a4,    INV,   INV,   INV,   INV, // 7388..738f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8be8,   INV, // 7390..7397
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7398..739f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 73a0..73a7
+	   INV,0x8adf,   INV,   INV,    INV,   INV,   INV,   INV, // 73a8..73af
+	   INV,   INV,0x97e6,0xe0dc,    INV,   INV,   INV,   INV, // 73b0..73b7
+	   INV,   INV,   INV,0xe0de,    INV,   INV,   INV,   INV, // 73b8..73bf
+	0xe0df,   INV,0x89cf,   INV,    INV,   INV,   INV,   INV, // 73c0..73c7
+	0xe0db,   INV,0x8e58,   INV,    INV,0x92bf,0xe0dd,   INV, // 73c8..73cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 73d0..73d7
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0e2,   INV, // 73d8..73df
+	0x8eec,   INV,   INV,   INV,    INV,0xe0e0,   INV,   INV, // 73e0..73e7
+	   INV,   INV,0x8c5d,   INV,    INV,0x94c7,0xe0e1,   INV, // 73e8..73ef
+	   INV,0xe0fc,   INV,   INV,    INV,   INV,   INV,   INV, // 73f0..73f7
+	0xe0e7,   INV,   INV,   INV,    INV,   INV,0x8cbb,   INV, // 73f8..73ff
+    },
+    { //  49: 7400..74ff
+	   INV,   INV,   INV,0x8b85,    INV,0xe0e4,0x979d,   INV, // 7400..7407
+	   INV,0x97ae,   INV,   INV,    INV,   INV,   INV,   INV, // 7408..740f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7410..7417
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7418..741f
+	   INV,   INV,0x91f4,   INV,    INV,0xe0e6,   INV,   INV, // 7420..7427
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7428..742f
+	   INV,   INV,0xe0e8,0x97d4, 0x8bd5,0x94fa,0x9469,   INV, // 7430..7437
+	   INV,   INV,0xe0e9,   INV,    INV,   INV,   INV,0xe0eb, // 7438..743f
+	   INV,0xe0ee,   INV,   INV,    INV,   INV,   INV,   INV, // 7440..7447
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7448..744f
+	   INV,   INV,   INV,   INV,    INV,0xe0ea,   INV,   INV, // 7450..7457
+	   INV,0xe0ed,0x8ce8,0x896c, 0xe0ef,   INV,0x9090,0xe0ec, // 7458..745f
+	0x97da,   INV,   INV,0xe0f2, 0xeaa2,   INV,   INV,   INV, // 7460..7467
+	   INV,0xe0f0,0xe0f3,   INV,    INV,   INV,   INV,0xe0e5, // 7468..746f
+	0xe0f1,   INV,   INV,0x8dba,    INV,   INV,0xe0f4,   INV, // 7470..7477
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0f5,   INV, // 7478..747f
+	   INV,   INV,   INV,0x979e,    INV,   INV,   INV,   INV, // 7480..7487
+	   INV,   INV,   INV,0xe0f6,    INV,   INV,   INV,   INV, // 7488..748f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7490..7497
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe0f7,   INV, // 7498..749f
+	   INV,   INV,0xe0e3,   INV,    INV,   INV,   INV,0xe0f8, // 74a0..74a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 74a8..74af
+	0x8ac2,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 74b0..74b7
+	   INV,   INV,   INV,   INV,    INV,0x8ea3,   INV,   INV, // 74b8..74bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 74c0..74c7
+	   INV,   INV,0xe0f9,   INV,    INV,   INV,   INV,0xe0fa, // 74c8..74cf
+	   INV,   INV,   INV,   INV, 0xe0fb,   INV,   INV,   INV, // 74d0..74d7
+	   INV,   INV,   INV,   INV, 0x895a,   INV,   INV,   INV, // 74d8..74df
+	0xe140,   INV,0x955a,0xe141,    INV,   INV,0x8aa2,0xe142, // 74e0..74e7
+	   INV,0xe143,   INV,   INV,    INV,   INV,0xe144,   INV, // 74e8..74ef
+	0xe146,0xe147,0xe145,   INV,    INV,   INV,0x9572,0xe149, // 74f0..74f7
+	0xe148,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 74f8..74ff
+    },
+    { //  50: 7500..75ff
+	   INV,   INV,   INV,0xe14b, 0xe14a,0xe14c,   INV,   INV, // 7500..7507
+	   INV,   INV,   INV,   INV, 0xe14d,0xe14f,0xe14e,   INV, // 7508..750f
+	   INV,0x8d99,   INV,0xe151,    INV,0xe150,   INV,   INV, // 7510..7517
+	0x8ac3,   INV,0x9072,   INV, 0x935b,   INV,0xe152,0x90b6, // 7518..751f
+	   INV,   INV,   INV,0x8e59,    INV,0x8999,0xe153,   INV, // 7520..7527
+	0x9770,   INV,   INV,0x95e1, 0xe154,   INV,   INV,   INV, // 7528..752f
+	0x9363,0x9752,0x8d62,0x905c,    INV,   INV,   INV,0x926a, // 7530..7537
+	0x99b2,   INV,0x92ac,0x89e6, 0xe155,   INV,   INV,   INV, // 7538..753f
+	   INV,   INV,   INV,   INV, 0xe156,   INV,0xe15b,   INV, // 7540..7547
+	   INV,0xe159,0xe158,0x9dc0, 0x8a45,0xe157,   INV,0x88d8, // 7548..754f
+	   INV,0x94a8,   INV,   INV, 0x94c8,   INV,   INV,   INV, // 7550..7557
+	   INV,0x97af,0xe15c,0xe15a, 0x927b,0x90a4,   INV,   INV, // 7558..755f
+	0x94a9,   INV,0x954c,   INV, 0xe15e,0x97aa,0x8c6c,0xe15f, // 7560..7567
+	   INV,0xe15d,0x94d4,0xe160,    INV,0xe161,   INV,   INV, // 7568..756f
+	0x88d9,   INV,   INV,0x8ff4, 0xe166,   INV,0xe163,0x93eb, // 7570..7577
+	0xe162,   INV,   INV,   INV,    INV,   INV,   INV,0x8b45, // 7578..757f
+	   INV,   INV,0xe169,   INV,    INV,   INV,0xe164,0xe165, // 7580..7587
+	   INV,0xe168,0xe167,0x9544,    INV,   INV,0x9161,0x9160, // 7588..758f
+	   INV,0x8b5e,   INV,   INV, 0xe16a,   INV,   INV,   INV, // 7590..7597
+	   INV,   INV,0xe16b,   INV,    INV,0xe16c,   INV,   INV, // 7598..759f
+	   INV,   INV,   INV,0xe16e,    INV,0xe16d,   INV,   INV, // 75a0..75a7
+	   INV,   INV,   INV,0x8975,    INV,   INV,   INV,   INV, // 75a8..75af
+	   INV,0xe176,0x94e6,0xe170,    INV,0xe172,   INV,   INV, // 75b0..75b7
+	0xe174,0x905d,   INV,   INV, 0xe175,0xe173,0x8ebe,   INV, // 75b8..75bf
+	   INV,   INV,0xe16f,0xe171,    INV,0x9561,   INV,0x8fc7, // 75c0..75c7
+	   INV,   INV,0xe178,   INV,    INV,0xe177,   INV,   INV, // 75c8..75cf
+	   INV,   INV,0xe179,   INV, 0x8ea4,0x8dad,   INV,   INV, // 75d0..75d7
+	0x9397,0xe17a,   INV,0x92c9,    INV,   INV,0xe17c,   INV, // 75d8..75df
+	   INV,   INV,0x979f,0xe17b,    INV,   INV,   INV,   INV, // 75e0..75e7
+	   INV,0x9189,   INV,   INV,    INV,   INV,   INV,   INV, // 75e8..75ef
+	0xe182,   INV,0xe184,0xe185, 0x9273,   INV,   INV,   INV, // 75f0..75f7
+	   INV,   INV,0xe183,   INV, 0xe180,   INV,0xe17d,0xe17e, // 75f8..75ff
+    },
+    { //  51: 7600..76ff
+	   INV,0xe181,   INV,   INV,    INV,   INV,   INV,   INV, // 7600..7607
+	   INV,0xe188,   INV,0xe186,    INV,0xe187,   INV,   INV, // 7608..760f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7610..7617
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe189, // 7618..761f
+	0xe18b,0xe18c,0xe18d,   INV, 0xe18e,   INV,   INV,0xe18a, // 7620..7627
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7628..762f
+	0xe190,   INV,   INV,   INV, 0xe18f,   INV,   INV,   INV, // 7630..7637
+	   INV,   INV,   INV,0xe191,    INV,   INV,   INV,   INV, // 7638..763f
+	   INV,   INV,0x97c3,   INV,    INV,   INV,0xe194,0xe192, // 7640..7647
+	0xe193,   INV,   INV,   INV, 0x8ae0,   INV,   INV,   INV, // 7648..764f
+	   INV,   INV,0x96fc,   INV,    INV,   INV,0x95c8,   INV, // 7650..7657
+	0xe196,   INV,   INV,   INV, 0xe195,   INV,   INV,   INV, // 7658..765f
+	   INV,0xe197,0xe198,   INV,    INV,   INV,   INV,0xe19c, // 7660..7667
+	0xe199,0xe19a,0xe19b,   INV, 0xe19d,   INV,   INV,   INV, // 7668..766f
+	0xe19e,   INV,0xe19f,   INV,    INV,   INV,0xe1a0,   INV, // 7670..7677
+	0xe1a1,   INV,0x94ad,0x936f, 0xe1a2,0x9492,0x9553,   INV, // 7678..767f
+	0xe1a3,   INV,   INV,0xe1a4, 0x9349,   INV,0x8a46,0x8d63, // 7680..7687
+	0xe1a5,   INV,   INV,0xe1a6,    INV,   INV,0xe1a7,   INV, // 7688..768f
+	0x8e48,   INV,   INV,0xe1a9,    INV,   INV,0xe1a8,   INV, // 7690..7697
+	   INV,0xe1aa,0xe1ab,   INV,    INV,   INV,   INV,   INV, // 7698..769f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 76a0..76a7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x94e7,   INV, // 76a8..76af
+	0xe1ac,   INV,   INV,   INV, 0xe1ad,   INV,   INV,0xea89, // 76b0..76b7
+	0xe1ae,0xe1af,0xe1b0,   INV,    INV,   INV,   INV,0x8e4d, // 76b8..76bf
+	   INV,   INV,0xe1b1,0x9475,    INV,   INV,0x967e,   INV, // 76c0..76c7
+	0x896d,   INV,0x8976,   INV,    INV,0xe1b2,   INV,   INV, // 76c8..76cf
+	   INV,   INV,0xe1b4,   INV,    INV,   INV,0xe1b3,0x9390, // 76d0..76d7
+	   INV,   INV,   INV,0x90b7, 0x9f58,   INV,0xe1b5,0x96bf, // 76d8..76df
+	   INV,0xe1b6,   INV,0x8ac4, 0x94d5,0xe1b7,   INV,0xe1b8, // 76e0..76e7
+	   INV,   INV,0xe1b9,   INV,    INV,   INV,0x96da,   INV, // 76e8..76ef
+	   INV,   INV,0x96d3,   INV, 0x92bc,   INV,   INV,   INV, // 76f0..76f7
+	0x918a,   INV,   INV,0xe1bb,    INV,   INV,0x8f82,   INV, // 76f8..76ff
+    },
+    { //  52: 7700..77ff
+	   INV,0x8fc8,   INV,   INV, 0xe1be,   INV,   INV,0xe1bd, // 7700..7707
+	0xe1bc,0x94fb,   INV,0x8ac5, 0x8ca7,   INV,   INV,   INV, // 7708..770f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7710..7717
+	   INV,   INV,   INV,0xe1c4,    INV,   INV,0xe1c1,0x905e, // 7718..771f
+	0x96b0,   INV,   INV,   INV, 0xe1c0,0xe1c2,0xe1c3,   INV, // 7720..7727
+	   INV,0xe1bf,   INV,   INV,    INV,   INV,   INV,   INV, // 7728..772f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe1c5, // 7730..7737
+	0xe1c6,   INV,0x92ad,   INV, 0x8ae1,   INV,   INV,   INV, // 7738..773f
+	0x9285,   INV,   INV,   INV,    INV,   INV,   INV,0xe1c7, // 7740..7747
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7748..774f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7750..7757
+	   INV,   INV,0xe1c8,0xe1cb,    INV,   INV,   INV,   INV, // 7758..775f
+	   INV,0x9087,   INV,0x93c2,    INV,0xe1cc,0x9672,   INV, // 7760..7767
+	0xe1c9,   INV,   INV,0xe1ca,    INV,   INV,   INV,   INV, // 7768..776f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7770..7777
+	   INV,0xe1cf,   INV,   INV,    INV,   INV,0xe1ce,0xe1cd, // 7778..777f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7780..7787
+	   INV,   INV,   INV,0xe1d1,    INV,   INV,0xe1d0,   INV, // 7788..778f
+	   INV,0xe1d2,   INV,   INV,    INV,   INV,   INV,   INV, // 7790..7797
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe1d4,   INV, // 7798..779f
+	0xe1d3,   INV,   INV,   INV,    INV,0x95cb,   INV,   INV, // 77a0..77a7
+	   INV,   INV,   INV,   INV, 0x8f75,0x97c4,   INV,   INV, // 77a8..77af
+	0xe1d5,   INV,   INV,0x93b5,    INV,   INV,0xe1d6,   INV, // 77b0..77b7
+	   INV,0xe1d7,   INV,0xe1db, 0xe1d9,0xe1da,   INV,0xe1d8, // 77b8..77bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe1dc, // 77c0..77c7
+	   INV,   INV,   INV,   INV,    INV,0xe1dd,   INV,   INV, // 77c8..77cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe1de, // 77d0..77d7
+	   INV,   INV,0xe1df,0x96b5, 0xe1e0,   INV,   INV,   INV, // 77d8..77df
+	   INV,   INV,0x96ee,0xe1e1,    INV,0x926d,   INV,0x948a, // 77e0..77e7
+	   INV,0x8be9,   INV,   INV,    INV,0x925a,0xe1e2,0x8bb8, // 77e8..77ef
+	   INV,   INV,   INV,0x90ce,    INV,   INV,   INV,   INV, // 77f0..77f7
+	   INV,   INV,   INV,   INV, 0xe1e3,   INV,   INV,   INV, // 77f8..77ff
+    },
+    { //  53: 7800..78ff
+	   INV,   INV,0x8dbb,   INV,    INV,   INV,   INV,   INV, // 7800..7807
+	   INV,   INV,   INV,   INV, 0xe1e4,   INV,   INV,   INV, // 7808..780f
+	   INV,   INV,0xe1e5,   INV, 0x8ca4,0x8dd3,   INV,   INV, // 7810..7817
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7818..781f
+	0xe1e7,   INV,   INV,   INV,    INV,0x9375,0x8dd4,0x8b6d, // 7820..7827
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7828..782f
+	   INV,   INV,0x9643,   INV, 0x946a,   INV,   INV,   INV, // 7830..7837
+	   INV,   INV,0x9376,   INV,    INV,   INV,   INV,0x8d7b, // 7838..783f
+	   INV,   INV,   INV,   INV,    INV,0xe1e9,   INV,   INV, // 7840..7847
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7848..784f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7850..7857
+	   INV,   INV,   INV,   INV,    INV,0x8fc9,   INV,   INV, // 7858..785f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7860..7867
+	   INV,   INV,   INV,0x97b0, 0x8d64,   INV,   INV,0x8ca5, // 7868..786f
+	   INV,   INV,0x94a1,   INV, 0xe1eb,   INV,   INV,   INV, // 7870..7877
+	   INV,   INV,   INV,   INV, 0xe1ed,   INV,   INV,   INV, // 7878..787f
+	   INV,0x8ce9,   INV,   INV,    INV,   INV,0xe1ec,0x92f4, // 7880..7887
+	   INV,   INV,   INV,   INV, 0xe1ef,0x8a56,0xe1ea,   INV, // 7888..788f
+	   INV,0x94e8,   INV,0x894f,    INV,0x8dea,   INV,0x9871, // 7890..7897
+	   INV,   INV,0xe1ee,   INV,    INV,   INV,   INV,   INV, // 7898..789f
+	   INV,   INV,   INV,0xe1f0,    INV,   INV,   INV,0x95c9, // 78a0..78a7
+	   INV,0x90d7,0xe1f2,   INV,    INV,   INV,   INV,0xe1f3, // 78a8..78af
+	   INV,   INV,   INV,   INV,    INV,0xe1f1,   INV,   INV, // 78b0..78b7
+	   INV,   INV,0x8a6d,   INV, 0xe1f9,   INV,0xe1f8,   INV, // 78b8..78bf
+	   INV,0x8ea5,   INV,   INV,    INV,0xe1fa,0xe1f5,   INV, // 78c0..78c7
+	   INV,   INV,0xe1fb,0xe1f6,    INV,   INV,   INV,   INV, // 78c8..78cf
+	0x94d6,0xe1f4,   INV,   INV, 0xe1f7,   INV,   INV,   INV, // 78d0..78d7
+	   INV,   INV,0xe241,   INV,    INV,   INV,   INV,   INV, // 78d8..78df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe240, // 78e0..78e7
+	0x9681,   INV,   INV,   INV, 0xe1fc,   INV,   INV,0x88e9, // 78e8..78ef
+	   INV,   INV,   INV,   INV, 0xe243,   INV,   INV,   INV, // 78f0..78f7
+	   INV,   INV,   INV,   INV,    INV,0xe242,   INV,   INV, // 78f8..78ff
+    },
+    { //  54: 7900..79ff
+	   INV,0x8fca,   INV,   INV,    INV,   INV,   INV,0xe244, // 7900..7907
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9162,   INV, // 7908..790f
+	   INV,0xe246,0xe245,   INV,    INV,   INV,   INV,   INV, // 7910..7917
+	   INV,0xe247,   INV,   INV,    INV,   INV,   INV,   INV, // 7918..791f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe1e6,   INV, // 7920..7927
+	   INV,   INV,0xe1e8,0xe249, 0xe248,   INV,   INV,   INV, // 7928..792f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7930..7937
+	   INV,   INV,0x8ea6,   INV, 0x97e7,   INV,0x8ed0,   INV, // 7938..793f
+	0xe24a,0x8c56,   INV,   INV,    INV,   INV,   INV,0x8b5f, // 7940..7947
+	0x8b46,0x8e83,   INV,   INV,    INV,   INV,   INV,   INV, // 7948..794f
+	0x9753,   INV,   INV,0xe250,    INV,0xe24f,0x9163,0xe24c, // 7950..7957
+	   INV,   INV,0xe24e,   INV,    INV,0x8f6a,0x905f,0xe24d, // 7958..795f
+	0xe24b,   INV,0x9449,   INV,    INV,0x8fcb,   INV,   INV, // 7960..7967
+	0x955b,   INV,   INV,   INV,    INV,0x8dd5,   INV,   INV, // 7968..796f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9398, // 7970..7977
+	   INV,   INV,0xe251,   INV,    INV,   INV,   INV,0xe252, // 7978..797f
+	0xe268,0x8bd6,   INV,   INV, 0x985c,0x9154,   INV,   INV, // 7980..7987
+	   INV,   INV,0xe253,   INV,    INV,0x89d0,0x92f5,0x959f, // 7988..798f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7990..7997
+	   INV,   INV,   INV,   INV,    INV,0xe254,   INV,   INV, // 7998..799f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8b9a,0xe255, // 79a0..79a7
+	   INV,   INV,0xe257,   INV,    INV,   INV,0xe258,   INV, // 79a8..79af
+	0x9448,   INV,   INV,0xe259,    INV,   INV,   INV,   INV, // 79b0..79b7
+	   INV,0xe25a,0xe25b,   INV,    INV,0x8bd7,0x89d1,0x93c3, // 79b8..79bf
+	0x8f47,0x8e84,   INV,   INV,    INV,   INV,   INV,   INV, // 79c0..79c7
+	   INV,0xe25c,   INV,0x8f48,    INV,   INV,   INV,   INV, // 79c8..79cf
+	   INV,0x89c8,0x9562,   INV,    INV,0xe25d,   INV,   INV, // 79d0..79d7
+	0x94e9,   INV,   INV,   INV,    INV,   INV,   INV,0x9164, // 79d8..79df
+	   INV,0xe260,   INV,0xe261, 0x9489,   INV,0x9060,0xe25e, // 79e0..79e7
+	   INV,0x9281,   INV,   INV, 0xe25f,   INV,   INV,   INV, // 79e8..79ef
+	0x8fcc,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 79f0..79f7
+	   INV,   INV,   INV,0x88da,    INV,   INV,   INV,   INV, // 79f8..79ff
+    },
+    { //  55: 7a00..7aff
+	0x8b48,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7a00..7a07
+	0xe262,   INV,   INV,0x92f6,    INV,0xe263,0x90c5,   INV, // 7a08..7a0f
+	   INV,   INV,   INV,   INV, 0x96ab,   INV,   INV,0x9542, // 7a10..7a17
+	0xe264,0xe265,0x9274,   INV, 0x97c5,   INV,   INV,0xe267, // 7a18..7a1f
+	0xe266,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7a20..7a27
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8eed,   INV, // 7a28..7a2f
+	   INV,0xe269,0x88ee,   INV,    INV,   INV,   INV,0xe26c, // 7a30..7a37
+	   INV,   INV,   INV,0xe26a, 0x89d2,0x8c6d,0xe26b,0x8d65, // 7a38..7a3f
+	0x8d92,   INV,0x95e4,0xe26d,    INV,   INV,0x9673,   INV, // 7a40..7a47
+	   INV,0xe26f,   INV,   INV,    INV,0x90cf,0x896e,0x89b8, // 7a48..7a4f
+	0x88aa,   INV,   INV,   INV,    INV,   INV,   INV,0xe26e, // 7a50..7a57
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7a58..7a5f
+	   INV,0xe270,0xe271,0x8ff5,    INV,   INV,   INV,   INV, // 7a60..7a67
+	   INV,0xe272,   INV,0x8a6e,    INV,   INV,   INV,   INV, // 7a68..7a6f
+	0xe274,   INV,   INV,   INV, 0x8c8a,   INV,0x8b86,   INV, // 7a70..7a77
+	   INV,0xe275,0x8bf3,   INV,    INV,0xe276,   INV,0x90fa, // 7a78..7a7f
+	   INV,0x93cb,   INV,0x90de, 0x8df3,   INV,   INV,   INV, // 7a80..7a87
+	0xe277,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7a88..7a8f
+	   INV,   INV,0x9282,0x918b,    INV,0xe279,0xe27b,0xe278, // 7a90..7a97
+	0xe27a,   INV,   INV,   INV,    INV,   INV,   INV,0x8c41, // 7a98..7a9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7aa0..7aa7
+	   INV,0xe27c,0x8c45,   INV,    INV,   INV,0x8b87,0x9771, // 7aa8..7aaf
+	0xe27e,   INV,   INV,   INV,    INV,   INV,0xe280,   INV, // 7ab0..7ab7
+	   INV,   INV,0x894d,   INV,    INV,   INV,   INV,0xe283, // 7ab8..7abf
+	   INV,   INV,   INV,0x8a96, 0xe282,0xe281,   INV,0xe285, // 7ac0..7ac7
+	0xe27d,   INV,0xe286,0x97a7,    INV,0xe287,   INV,0xe288, // 7ac8..7acf
+	   INV,   INV,0x9af2,0xe28a,    INV,0xe289,   INV,   INV, // 7ad0..7ad7
+	   INV,0xe28b,0xe28c,   INV, 0x97b3,0xe28d,   INV,0xe8ed, // 7ad8..7adf
+	0x8fcd,0xe28e,0xe28f,0x8f76,    INV,0x93b6,0xe290,   INV, // 7ae0..7ae7
+	   INV,   INV,0x9247,   INV,    INV,0xe291,   INV,0x925b, // 7ae8..7aef
+	0xe292,   INV,   INV,   INV,    INV,   INV,0x8ba3,   INV, // 7af0..7af7
+	0x995e,0x927c,0x8eb1,   INV,    INV,   INV,   INV,0x8ac6, // 7af8..7aff
+    },
+    { //  56: 7b00..7bff
+	   INV,   INV,0xe293,   INV, 0xe2a0,   INV,0xe296,   INV, // 7b00..7b07
+	0x8b88,   INV,0xe295,0xe2a2,    INV,   INV,   INV,0xe294, // 7b08..7b0f
+	   INV,0x8fce,   INV,   INV,    INV,   INV,   INV,   INV, // 7b10..7b17
+	0xe298,0xe299,   INV,0x934a,    INV,   INV,0xe29a,   INV, // 7b18..7b1f
+	0x8a7d,   INV,   INV,   INV,    INV,0x9079,0x9584,   INV, // 7b20..7b27
+	0xe29c,   INV,   INV,   INV, 0x91e6,   INV,   INV,   INV, // 7b28..7b2f
+	   INV,   INV,   INV,0xe297,    INV,0xe29b,0xe29d,   INV, // 7b30..7b37
+	   INV,0x8df9,   INV,   INV,    INV,   INV,   INV,   INV, // 7b38..7b3f
+	   INV,   INV,   INV,   INV,    INV,0xe2a4,0x954d,   INV, // 7b40..7b47
+	0x94a4,0x9399,   INV,0x8bd8, 0xe2a3,0xe2a1,   INV,0x94b3, // 7b48..7b4f
+	0xe29e,0x927d,0x939b,   INV, 0x939a,   INV,0x8df4,   INV, // 7b50..7b57
+	   INV,   INV,   INV,   INV,    INV,0xe2b6,   INV,   INV, // 7b58..7b5f
+	   INV,   INV,   INV,   INV,    INV,0xe2a6,   INV,0xe2a8, // 7b60..7b67
+	   INV,   INV,   INV,   INV, 0xe2ab,   INV,0xe2ac,   INV, // 7b68..7b6f
+	0xe2a9,0xe2aa,   INV,   INV, 0xe2a7,0xe2a5,   INV,   INV, // 7b70..7b77
+	   INV,   INV,0xe29f,   INV,    INV,   INV,   INV,   INV, // 7b78..7b7f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x95cd,0x89d3, // 7b80..7b87
+	   INV,   INV,   INV,0xe2b3,    INV,0xe2b0,   INV,0xe2b5, // 7b88..7b8f
+	   INV,   INV,0xe2b4,   INV, 0x9493,0x96a5,   INV,0x8e5a, // 7b90..7b97
+	0xe2ae,0xe2b7,0xe2b2,   INV, 0xe2b1,0xe2ad,   INV,0xe2af, // 7b98..7b9f
+	   INV,0x8ac7,   INV,   INV,    INV,   INV,   INV,   INV, // 7ba0..7ba7
+	   INV,   INV,0x925c,   INV,    INV,0x90fb,   INV,   INV, // 7ba8..7baf
+	   INV,0x94a0,   INV,   INV, 0xe2bc,   INV,   INV,   INV, // 7bb0..7bb7
+	0x94a2,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7bb8..7bbf
+	0x90df,0xe2b9,   INV,   INV, 0x94cd,   INV,0xe2bd,0x95d1, // 7bc0..7bc7
+	   INV,0x927a,   INV,0xe2b8, 0xe2ba,   INV,   INV,0xe2bb, // 7bc8..7bcf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7bd0..7bd7
+	   INV,   INV,   INV,   INV,    INV,0xe2be,   INV,   INV, // 7bd8..7bdf
+	0x8ec2,   INV,   INV,   INV, 0x93c4,0xe2c3,0xe2c2,   INV, // 7be0..7be7
+	   INV,0xe2bf,   INV,   INV,    INV,0x9855,   INV,   INV, // 7be8..7bef
+	   INV,   INV,   INV,0xe2c8,    INV,   INV,0xe2cc,0xe2c9, // 7bf0..7bf7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7bf8..7bff
+    },
+    { //  57: 7c00..7cff
+	0xe2c5,   INV,   INV,   INV,    INV,   INV,   INV,0xe2c6, // 7c00..7c07
+	   INV,   INV,   INV,   INV,    INV,0xe2cb,   INV,   INV, // 7c08..7c0f
+	   INV,0xe2c0,0x99d3,0xe2c7, 0xe2c1,   INV,   INV,0xe2ca, // 7c10..7c17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe2d0, // 7c18..7c1f
+	   INV,0x8ac8,   INV,0xe2cd,    INV,   INV,   INV,0xe2ce, // 7c20..7c27
+	   INV,   INV,0xe2cf,0xe2d2,    INV,   INV,   INV,   INV, // 7c28..7c2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe2d1, // 7c30..7c37
+	0x94f4,   INV,   INV,   INV,    INV,0xe2d3,0x97fa,0x95eb, // 7c38..7c3f
+	0xe2d8,   INV,   INV,0xe2d5,    INV,   INV,   INV,   INV, // 7c40..7c47
+	   INV,   INV,   INV,   INV, 0xe2d4,0x90d0,   INV,0xe2d7, // 7c48..7c4f
+	0xe2d9,   INV,   INV,   INV, 0xe2d6,   INV,0xe2dd,   INV, // 7c50..7c57
+	0xe2da,   INV,   INV,   INV,    INV,   INV,   INV,0xe2db, // 7c58..7c5f
+	0xe2c4,   INV,   INV,   INV, 0xe2dc,0xe2de,   INV,   INV, // 7c60..7c67
+	   INV,   INV,   INV,   INV, 0xe2df,   INV,   INV,   INV, // 7c68..7c6f
+	   INV,   INV,   INV,0x95c4,    INV,0xe2e0,   INV,   INV, // 7c70..7c77
+	   INV,   INV,   INV,   INV,    INV,   INV,0x96e0,   INV, // 7c78..7c7f
+	   INV,0x8bcc,0x8c48,0xe2e1,    INV,   INV,   INV,   INV, // 7c80..7c87
+	   INV,0x95b2,   INV,0x9088,    INV,0x96ae,   INV,   INV, // 7c88..7c8f
+	0xe2e2,   INV,0x97b1,   INV,    INV,0x9494,   INV,0x9165, // 7c90..7c97
+	0x9453,   INV,   INV,0x8f6c,    INV,   INV,   INV,0x88be, // 7c98..7c9f
+	   INV,0xe2e7,0xe2e5,   INV, 0xe2e3,0x8a9f,   INV,0x8fcf, // 7ca0..7ca7
+	0xe2e8,   INV,   INV,0xe2e6,    INV,0xe2e4,0xe2ec,   INV, // 7ca8..7caf
+	   INV,0xe2eb,0xe2ea,0xe2e9,    INV,   INV,   INV,   INV, // 7cb0..7cb7
+	   INV,0xe2ed,   INV,   INV,    INV,0xe2ee,0x90b8,   INV, // 7cb8..7cbf
+	0xe2ef,   INV,0xe2f1,   INV,    INV,0xe2f0,   INV,   INV, // 7cc0..7cc7
+	   INV,   INV,0x8cd0,   INV,    INV,   INV,0x9157,   INV, // 7cc8..7ccf
+	   INV,   INV,0xe2f3,   INV,    INV,   INV,0x939c,   INV, // 7cd0..7cd7
+	0xe2f2,   INV,   INV,   INV, 0xe2f4,   INV,0x95b3,0x918c, // 7cd8..7cdf
+	0x8d66,   INV,0xe2f5,   INV,    INV,   INV,   INV,0x97c6, // 7ce0..7ce7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe2f7, // 7ce8..7cef
+	   INV,   INV,0xe2f8,   INV, 0xe2f9,   INV,0xe2fa,   INV, // 7cf0..7cf7
+	0x8e85,   INV,0xe2fb,0x8c6e,    INV,   INV,0x8b8a,   INV, // 7cf8..7cff
+    },
+    { //  58: 7d00..7dff
+	0x8b49,   INV,0xe340,   INV, 0x96f1,0x8d67,0xe2fc,   INV, // 7d00..7d07
+	   INV,   INV,0xe343,0x96e4,    INV,0x945b,   INV,   INV, // 7d08..7d0f
+	0x9552,   INV,   INV,   INV, 0x8f83,0xe342,   INV,0x8ed1, // 7d10..7d17
+	0x8d68,0x8e86,0x8b89,0x95b4, 0xe341,   INV,   INV,   INV, // 7d18..7d1f
+	0x9166,0x9661,0x8df5,   INV,    INV,   INV,   INV,   INV, // 7d20..7d27
+	   INV,   INV,   INV,0x8e87, 0x92db,   INV,0xe346,0x97dd, // 7d28..7d2f
+	0x8dd7,   INV,0xe347,0x9061,    INV,0xe349,   INV,   INV, // 7d30..7d37
+	   INV,0x8fd0,0x8dae,   INV,    INV,   INV,   INV,0xe348, // 7d38..7d3f
+	   INV,   INV,0x8f49,0x8cbc, 0x9167,0xe344,0xe34a,   INV, // 7d40..7d47
+	   INV,   INV,   INV,0xe345, 0x8c6f,   INV,0xe34d,0xe351, // 7d48..7d4f
+	0x8c8b,   INV,   INV,   INV,    INV,   INV,0xe34c,   INV, // 7d50..7d57
+	   INV,   INV,   INV,0xe355,    INV,   INV,0x8d69,   INV, // 7d58..7d5f
+	   INV,0x978d,0x88ba,0xe352,    INV,   INV,0x8b8b,   INV, // 7d60..7d67
+	0xe34f,   INV,   INV,   INV,    INV,   INV,0xe350,   INV, // 7d68..7d6f
+	   INV,0x939d,0xe34e,0xe34b,    INV,0x8a47,0x90e2,   INV, // 7d70..7d77
+	   INV,0x8ca6,   INV,   INV,    INV,0xe357,   INV,   INV, // 7d78..7d7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7d80..7d87
+	   INV,0xe354,   INV,   INV,    INV,   INV,   INV,0xe356, // 7d88..7d8f
+	   INV,   INV,   INV,0xe353,    INV,   INV,   INV,   INV, // 7d90..7d97
+	   INV,0x8c70,0x91b1,0xe358, 0x918e,   INV,   INV,0xe365, // 7d98..7d9f
+	   INV,   INV,0xe361,0xe35b,    INV,   INV,   INV,   INV, // 7da0..7da7
+	   INV,   INV,   INV,0xe35f, 0x8ef8,0x88db,0xe35a,0xe362, // 7da8..7daf
+	0xe366,0x8d6a,0x96d4,   INV, 0x92d4,0xe35c,   INV,   INV, // 7db0..7db7
+	0xe364,   INV,0xe359,0x925d,    INV,0xe35e,0x88bb,0x96c8, // 7db8..7dbf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe35d, // 7dc0..7dc7
+	   INV,   INV,0x8bd9,0x94ea,    INV,   INV,   INV,0x918d, // 7dc8..7dcf
+	   INV,0x97ce,0x8f8f,   INV,    INV,0xe38e,   INV,   INV, // 7dd0..7dd7
+	0xe367,   INV,0x90fc,   INV, 0xe363,0xe368,0xe36a,   INV, // 7dd8..7ddf
+	0x92f7,0xe36d,   INV,   INV, 0xe369,   INV,   INV,   INV, // 7de0..7de7
+	0x95d2,0x8ac9,   INV,   INV, 0x96c9,   INV,   INV,0x88dc, // 7de8..7def
+	   INV,   INV,0xe36c,   INV, 0x97fb,   INV,   INV,   INV, // 7df0..7df7
+	   INV,   INV,   INV,0xe36b,    INV,   INV,   INV,   INV, // 7df8..7dff
+    },
+    { //  59: 7e00..7eff
+	   INV,0x898f,   INV,   INV, 0x93ea,0xe36e,   INV,   INV, // 7e00..7e07
+	   INV,0xe375,0xe36f,0xe376,    INV,   INV,   INV,   INV, // 7e08..7e0f
+	   INV,   INV,0xe372,   INV,    INV,   INV,   INV,   INV, // 7e10..7e17
+	   INV,   INV,   INV,0x949b,    INV,   INV,0x8ec8,0xe374, // 7e18..7e1f
+	   INV,0xe371,0xe377,0xe370,    INV,   INV,0x8f63,   INV, // 7e20..7e27
+	   INV,   INV,   INV,0x9644,    INV,   INV,0x8f6b,   INV, // 7e28..7e2f
+	   INV,0xe373,0xe380,   INV,    INV,0xe37b,   INV,0xe37e, // 7e30..7e37
+	   INV,0xe37c,0xe381,0xe37a,    INV,0xe360,0x90d1,   INV, // 7e38..7e3f
+	   INV,0x94c9,   INV,0xe37d,    INV,   INV,0xe378,   INV, // 7e40..7e47
+	   INV,   INV,0x9140,0x8c71,    INV,0x8f4a,   INV,   INV, // 7e48..7e4f
+	   INV,   INV,   INV,   INV, 0x9044,0x9155,0xe384,   INV, // 7e50..7e57
+	   INV,0xe386,0xe387,   INV,    INV,0xe383,0xe385,   INV, // 7e58..7e5f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe379,0xe382, // 7e60..7e67
+	   INV,0xe38a,0xe389,   INV,    INV,0x969a,   INV,   INV, // 7e68..7e6f
+	0x8c4a,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7e70..7e77
+	   INV,0xe388,   INV,0xe38c, 0xe38b,0xe38f,   INV,0xe391, // 7e78..7e7f
+	   INV,   INV,0x8e5b,0xe38d,    INV,   INV,   INV,   INV, // 7e80..7e87
+	0xe392,0xe393,   INV,   INV, 0xe394,   INV,0xe39a,0x935a, // 7e88..7e8f
+	0xe396,   INV,0xe395,0xe397, 0xe398,   INV,0xe399,   INV, // 7e90..7e97
+	   INV,   INV,   INV,0xe39b, 0xe39c,   INV,   INV,   INV, // 7e98..7e9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ea0..7ea7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ea8..7eaf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7eb0..7eb7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7eb8..7ebf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ec0..7ec7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ec8..7ecf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ed0..7ed7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ed8..7edf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ee0..7ee7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ee8..7eef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ef0..7ef7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7ef8..7eff
+    },
+    { //  60: 7f00..7fff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7f00..7f07
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7f08..7f0f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7f10..7f17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7f18..7f1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7f20..7f27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7f28..7f2f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8aca,   INV, // 7f30..7f37
+	0xe39d,   INV,0xe39e,   INV,    INV,   INV,   INV,   INV, // 7f38..7f3f
+	   INV,   INV,   INV,   INV,    INV,0xe39f,   INV,   INV, // 7f40..7f47
+	   INV,   INV,   INV,   INV, 0xe3a0,0xe3a1,0xe3a2,   INV, // 7f48..7f4f
+	0xe3a3,0xe3a4,   INV,   INV, 0xe3a6,0xe3a5,   INV,   INV, // 7f50..7f57
+	0xe3a7,   INV,   INV,   INV,    INV,   INV,   INV,0xe3a8, // 7f58..7f5f
+	0xe3a9,   INV,   INV,   INV,    INV,   INV,   INV,0xe3ac, // 7f60..7f67
+	0xe3aa,0xe3ab,0x8ddf,0x8c72,    INV,   INV,0x9275,   INV, // 7f68..7f6f
+	0x94b1,   INV,0x8f90,   INV,    INV,0x946c,   INV,0x94eb, // 7f70..7f77
+	0xe3ad,0x9ceb,   INV,   INV,    INV,   INV,   INV,   INV, // 7f78..7f7f
+	   INV,   INV,0xe3ae,0xe3b0,    INV,0x9785,0xe3af,0xe3b2, // 7f80..7f87
+	0xe3b1,   INV,0x9772,   INV, 0xe3b3,   INV,0x94fc,   INV, // 7f88..7f8f
+	   INV,   INV,   INV,   INV, 0xe3b4,   INV,   INV,   INV, // 7f90..7f97
+	   INV,   INV,0xe3b7,   INV,    INV,0xe3b6,0xe3b5,   INV, // 7f98..7f9f
+	   INV,   INV,   INV,0xe3b8, 0x8c51,   INV,   INV,   INV, // 7fa0..7fa7
+	0x9141,0x8b60,   INV,   INV,    INV,   INV,0xe3bc,0xe3b9, // 7fa8..7faf
+	   INV,   INV,0xe3ba,   INV,    INV,   INV,0xe3bd,   INV, // 7fb0..7fb7
+	0xe3be,0xe3bb,   INV,   INV,    INV,0x8948,   INV,   INV, // 7fb8..7fbf
+	   INV,0x89a5,   INV,   INV,    INV,0xe3c0,0xe3c1,   INV, // 7fc0..7fc7
+	   INV,   INV,0xe3c2,   INV, 0x9782,   INV,   INV,   INV, // 7fc8..7fcf
+	   INV,   INV,0x8f4b,   INV, 0xe3c4,0xe3c3,   INV,   INV, // 7fd0..7fd7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 7fd8..7fdf
+	0x9089,0xe3c5,   INV,   INV,    INV,   INV,0xe3c6,   INV, // 7fe0..7fe7
+	   INV,0xe3c7,   INV,0x8ae3,    INV,   INV,   INV,   INV, // 7fe8..7fef
+	0x8acb,   INV,   INV,0xe3c8,    INV,   INV,   INV,   INV, // 7ff0..7ff7
+	   INV,0xe3c9,   INV,0x967c, 0x9783,   INV,   INV,   INV, // 7ff8..7fff
+    },
+    { //  61: 8000..80ff
+	0x9773,0x9856,   INV,0x8d6c, 0xe3cc,0x8ed2,0xe3cb,   INV, // 8000..8007
+	   INV,   INV,   INV,0xe3cd, 0x8ea7,   INV,   INV,   INV, // 8008..800f
+	0x91cf,   INV,0xe3ce,   INV,    INV,0x8d6b,   INV,0x96d5, // 8010..8017
+	0xe3cf,0xe3d0,   INV,   INV, 0xe3d1,   INV,   INV,   INV, // 8018..801f
+	   INV,0xe3d2,   INV,   INV,    INV,   INV,   INV,   INV, // 8020..8027
+	0xe3d3,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8028..802f
+	   INV,   INV,   INV,0x8ea8,    INV,   INV,0x96eb,   INV, // 8030..8037
+	   INV,   INV,   INV,0xe3d5,    INV,0x925e,   INV,0xe3d4, // 8038..803f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe3d7,   INV, // 8040..8047
+	   INV,   INV,0xe3d6,   INV,    INV,   INV,   INV,   INV, // 8048..804f
+	   INV,   INV,0xe3d8,   INV,    INV,   INV,0x90b9,   INV, // 8050..8057
+	0xe3d9,   INV,0xe3da,   INV,    INV,   INV,0x95b7,0xe3db, // 8058..805f
+	   INV,0x918f,0xe3dc,   INV,    INV,   INV,   INV,   INV, // 8060..8067
+	0xe3dd,   INV,   INV,   INV,    INV,   INV,   INV,0x97fc, // 8068..806f
+	0xe3e0,   INV,0xe3df,0xe3de, 0x92ae,   INV,0xe3e1,0x9045, // 8070..8077
+	   INV,0xe3e2,   INV,   INV,    INV,0xe3e3,0x9857,0xe3e4, // 8078..807f
+	   INV,   INV,   INV,   INV, 0xe3e5,0xe3e7,0xe3e6,0x94a3, // 8080..8087
+	   INV,0x93f7,   INV,0x985d, 0x94a7,   INV,   INV,   INV, // 8088..808f
+	   INV,   INV,   INV,0xe3e9,    INV,   INV,0x8fd1,   INV, // 8090..8097
+	0x9549,   INV,0xe3ea,0xe3e8,    INV,0x8acc,   INV,   INV, // 8098..809f
+	   INV,0x8cd2,0x8e88,   INV,    INV,0x94ec,   INV,   INV, // 80a0..80a7
+	   INV,0x8ca8,0x9662,   INV, 0xe3ed,0xe3eb,   INV,0x8d6d, // 80a8..80af
+	   INV,0x8d6e,0x88e7,   INV, 0x8de6,   INV,   INV,   INV, // 80b0..80b7
+	   INV,   INV,0x9478,   INV,    INV,   INV,   INV,   INV, // 80b8..80bf
+	   INV,   INV,   INV,0x88dd, 0xe3f2,   INV,0x925f,   INV, // 80c0..80c7
+	   INV,   INV,   INV,   INV, 0x9477,   INV,0x91d9,   INV, // 80c8..80cf
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe3f4,   INV, // 80d0..80d7
+	   INV,0xe3f0,0xe3f3,0xe3ee,    INV,0xe3f1,0x9645,   INV, // 80d8..80df
+	   INV,0x8cd3,   INV,   INV, 0x88fb,0xe3ef,   INV,   INV, // 80e0..80e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe3f6, // 80e8..80ef
+	   INV,0xe3f7,   INV,   INV, 0x93b7,   INV,   INV,   INV, // 80f0..80f7
+	0x8bb9,   INV,   INV,   INV, 0xe445,0x945c,   INV,   INV, // 80f8..80ff
+    },
+    { //  62: 8100..81ff
+	   INV,   INV,0x8e89,   INV,    INV,0x8bba,0x90c6,0x9865, // 8100..8107
+	0x96ac,0xe3f5,0x90d2,   INV,    INV,   INV,   INV,   INV, // 8108..810f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8110..8117
+	   INV,   INV,0x8b72,0xe3f8,    INV,   INV,   INV,   INV, // 8118..811f
+	   INV,   INV,   INV,0xe3fa,    INV,   INV,   INV,   INV, // 8120..8127
+	   INV,0xe3f9,   INV,   INV,    INV,   INV,   INV,0xe3fb, // 8128..812f
+	   INV,0x9245,   INV,0x945d,    INV,   INV,   INV,   INV, // 8130..8137
+	   INV,0x92af,   INV,   INV,    INV,   INV,0xe442,   INV, // 8138..813f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe441,   INV, // 8140..8147
+	   INV,   INV,   INV,0xe3fc,    INV,   INV,0x9074,   INV, // 8148..814f
+	0x9585,0xe444,   INV,0xe443, 0x8d6f,0x9872,   INV,   INV, // 8150..8157
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe454, // 8158..815f
+	   INV,   INV,   INV,   INV,    INV,0xe448,0xe449,   INV, // 8160..8167
+	   INV,   INV,   INV,0x8eee,    INV,   INV,0xe447,   INV, // 8168..816f
+	0x8d98,0xe446,   INV,   INV, 0xe44a,   INV,   INV,   INV, // 8170..8177
+	0x92b0,0x95a0,0x9142,   INV,    INV,   INV,   INV,0x91da, // 8178..817f
+	0xe44e,   INV,0xe44f,0xe44b,    INV,   INV,   INV,   INV, // 8180..8187
+	0xe44c,   INV,0xe44d,   INV,    INV,   INV,   INV,0x8d70, // 8188..818f
+	   INV,   INV,   INV,0xe455,    INV,0xe451,   INV,   INV, // 8190..8197
+	   INV,   INV,0x9586,   INV, 0x968c,0x9547,   INV,   INV, // 8198..819f
+	0xe450,   INV,   INV,0xe453, 0xe452,   INV,   INV,   INV, // 81a0..81a7
+	0x9663,0xe456,   INV,   INV,    INV,   INV,   INV,   INV, // 81a8..81af
+	0xe457,   INV,   INV,0x9156,    INV,0xe458,   INV,   INV, // 81b0..81b7
+	0xe45a,   INV,0xe45e,   INV,    INV,0xe45b,0xe459,0x945e, // 81b8..81bf
+	0xe45c,   INV,0xe45d,   INV,    INV,   INV,0x89b0,   INV, // 81c0..81c7
+	0xe464,0xe45f,   INV,   INV,    INV,0xe460,   INV,   INV, // 81c8..81cf
+	   INV,0xe461,   INV,0x919f,    INV,   INV,   INV,   INV, // 81d0..81d7
+	0xe463,0xe462,0xe465,   INV,    INV,   INV,   INV,0xe466, // 81d8..81df
+	0xe467,   INV,   INV,0x9062,    INV,0x89e7,   INV,0xe468, // 81e0..81e7
+	0x97d5,   INV,0x8ea9,   INV,    INV,0x8f4c,   INV,   INV, // 81e8..81ef
+	   INV,   INV,   INV,0x8e8a, 0x9276,   INV,   INV,   INV, // 81f0..81f7
+	   INV,   INV,0xe469,0xe46a, 0x8950,   INV,0xe46b,   INV, // 81f8..81ff
+    },
+    { //  63: 8200..82ff
+	   INV,0xe46c,0xe46d,   INV,    INV,0xe46e,   INV,0xe46f, // 8200..8207
+	0x8bbb,0x9da8,0xe470,   INV, 0x90e3,0xe471,0x8ec9,   INV, // 8208..820f
+	0xe472,   INV,0x98ae,   INV,    INV,   INV,0xe473,0x95dc, // 8210..8217
+	0x8ada,   INV,   INV,0x9143, 0x8f77,   INV,0x9591,0x8f4d, // 8218..821f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8220..8227
+	   INV,0xe474,0x8d71,0xe475, 0x94ca,   INV,0xe484,   INV, // 8228..822f
+	   INV,   INV,   INV,0xe477,    INV,0x91c7,0x9495,0x8cbd, // 8230..8237
+	0xe476,0x9144,   INV,   INV,    INV,   INV,   INV,   INV, // 8238..823f
+	0xe478,   INV,   INV,   INV,    INV,   INV,   INV,0x92f8, // 8240..8247
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8248..824f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8250..8257
+	0xe47a,0xe479,0xe47c,   INV,    INV,0xe47b,   INV,0xe47d, // 8258..825f
+	   INV,   INV,0xe480,   INV, 0xe47e,   INV,0x8acd,   INV, // 8260..8267
+	0xe481,   INV,0xe482,0xe483,    INV,   INV,0x8daf,0x97c7, // 8268..826f
+	   INV,0xe485,0x9046,   INV,    INV,   INV,0x8990,0xe486, // 8270..8277
+	0xe487,   INV,   INV,   INV,    INV,   INV,0xe488,   INV, // 8278..827f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8280..8287
+	   INV,   INV,   INV,0x88f0,    INV,0xe489,   INV,   INV, // 8288..828f
+	   INV,   INV,0xe48a,   INV,    INV,   INV,   INV,   INV, // 8290..8297
+	   INV,0x9587,   INV,   INV,    INV,0x8ec5,   INV,0xe48c, // 8298..829f
+	   INV,   INV,   INV,   INV,    INV,0x8a48,0x88b0,   INV, // 82a0..82a7
+	   INV,   INV,   INV,0xe48b, 0xe48e,0x946d,   INV,0x9063, // 82a8..82af
+	   INV,0x89d4,   INV,0x9646,    INV,   INV,   INV,   INV, // 82b0..82b7
+	0x8c7c,0x8bda,   INV,0xe48d,    INV,0x89e8,   INV,   INV, // 82b8..82bf
+	   INV,   INV,   INV,   INV,    INV,0x8aa1,   INV,   INV, // 82c0..82c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 82c8..82cf
+	   INV,0x8991,0xe492,0x97e8, 0x91db,   INV,   INV,0x9563, // 82d0..82d7
+	   INV,0xe49e,   INV,0x89d5, 0xe49c,   INV,0xe49a,0xe491, // 82d8..82df
+	   INV,0xe48f,   INV,0xe490,    INV,0x8ee1,0x8bea,0x9297, // 82e0..82e7
+	   INV,   INV,   INV,0x93cf,    INV,   INV,   INV,   INV, // 82e8..82ef
+	   INV,0x8970,   INV,0xe494, 0xe493,   INV,   INV,   INV, // 82f0..82f7
+	   INV,0xe499,0xe495,0xe498,    INV,   INV,   INV,   INV, // 82f8..82ff
+    },
+    { //  64: 8300..83ff
+	   INV,   INV,0x96ce,0xe497, 0x89d6,0x8a9d,0xe49b,   INV, // 8300..8307
+	   INV,0xe49d,   INV,   INV,    INV,   INV,0x8c73,   INV, // 8308..830f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe4a1,0xe4aa, // 8310..8317
+	0xe4ab,   INV,   INV,   INV, 0x88a9,   INV,   INV,   INV, // 8318..831f
+	   INV,   INV,   INV,0xe4b2,    INV,   INV,   INV,   INV, // 8320..8327
+	0x88ef,   INV,   INV,0xe4a9,    INV,   INV,   INV,0xe4a8, // 8328..832f
+	   INV,0xe4a3,0xe4a2,   INV, 0xe4a0,0xe49f,0x9283,   INV, // 8330..8337
+	0x91f9,0xe4a5,   INV,   INV,    INV,   INV,   INV,   INV, // 8338..833f
+	0xe4a4,   INV,   INV,   INV,    INV,0xe4a7,   INV,   INV, // 8340..8347
+	   INV,0x9190,0x8c74,   INV,    INV,   INV,   INV,0x8960, // 8348..834f
+	0xe4a6,   INV,0x8d72,   INV,    INV,   INV,   INV,   INV, // 8350..8357
+	0x9191,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8358..835f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8360..8367
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8368..836f
+	   INV,   INV,   INV,0xe4b8,    INV,0xe4b9,   INV,0x89d7, // 8370..8377
+	   INV,   INV,   INV,0x89ac, 0xe4b6,   INV,   INV,   INV, // 8378..837f
+	   INV,   INV,   INV,   INV,    INV,0xe4ac,   INV,0xe4b4, // 8380..8387
+	   INV,0xe4bb,0xe4b5,   INV,    INV,   INV,0xe4b3,   INV, // 8388..838f
+	   INV,   INV,   INV,0xe496,    INV,   INV,0xe4b1,   INV, // 8390..8397
+	   INV,   INV,0xe4ad,   INV,    INV,   INV,0x8ace,0xe4af, // 8398..839f
+	0xe4ba,   INV,0xe4b0,   INV,    INV,   INV,   INV,   INV, // 83a0..83a7
+	0xe4bc,   INV,0xe4ae,0x949c,    INV,   INV,   INV,   INV, // 83a8..83af
+	   INV,0x9789,   INV,   INV,    INV,0xe4b7,   INV,   INV, // 83b0..83b7
+	   INV,   INV,   INV,   INV,    INV,0xe4cd,   INV,   INV, // 83b8..83bf
+	   INV,0xe4c5,   INV,   INV,    INV,0x909b,   INV,   INV, // 83c0..83c7
+	   INV,   INV,0x8b65,   INV, 0x8bdb,   INV,0xe4c0,   INV, // 83c8..83cf
+	   INV,   INV,   INV,0x89d9,    INV,   INV,0x8fd2,   INV, // 83d0..83d7
+	0xe4c3,   INV,   INV,   INV, 0x8dd8,   INV,   INV,0x9370, // 83d8..83df
+	0xe4c8,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 83e0..83e7
+	   INV,0x95ec,   INV,0xe4bf,    INV,   INV,   INV,0x89d8, // 83e8..83ef
+	0x8cd4,0x9548,0xe4c9,   INV, 0xe4bd,   INV,   INV,0xe4c6, // 83f0..83f7
+	   INV,   INV,   INV,0xe4d0,    INV,0xe4c1,   INV,   INV, // 83f8..83ff
+    },
+    { //  65: 8400..84ff
+	   INV,   INV,   INV,0xe4c2, 0x93b8,   INV,   INV,0xe4c7, // 8400..8407
+	   INV,   INV,   INV,0xe4c4, 0x9647,0xe4ca,0x88de,   INV, // 8408..840f
+	   INV,   INV,   INV,0xe4be,    INV,   INV,   INV,   INV, // 8410..8417
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8418..841f
+	0xe4cc,   INV,0xe4cb,   INV,    INV,   INV,   INV,   INV, // 8420..8427
+	   INV,0x948b,0xe4d2,   INV, 0xe4dd,   INV,   INV,   INV, // 8428..842f
+	   INV,0x8a9e,   INV,   INV,    INV,0xe4e0,   INV,   INV, // 8430..8437
+	0xe4ce,   INV,   INV,   INV, 0xe4d3,0x978e,   INV,   INV, // 8438..843f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe4dc,   INV, // 8440..8447
+	   INV,0x9774,   INV,   INV,    INV,   INV,0x97a8,   INV, // 8448..844f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9298, // 8450..8457
+	   INV,   INV,   INV,0x8a8b,    INV,   INV,   INV,   INV, // 8458..845f
+	   INV,0x9592,0xe4e2,0x939f,    INV,   INV,0x88af,   INV, // 8460..8467
+	   INV,0xe4db,   INV,0xe4d7, 0x9192,0xe4d1,0xe4d9,0xe4de, // 8468..846f
+	   INV,0x944b,   INV,   INV,    INV,0x88a8,   INV,0xe4d6, // 8470..8477
+	   INV,0xe4df,0x9598,   INV,    INV,   INV,   INV,   INV, // 8478..847f
+	   INV,   INV,0xe4da,   INV, 0xe4d5,   INV,   INV,   INV, // 8480..8487
+	   INV,   INV,   INV,0x8fd3,    INV,   INV,   INV,   INV, // 8488..848f
+	0x8f4e,   INV,   INV,   INV, 0x8eaa,   INV,   INV,   INV, // 8490..8497
+	   INV,0x96d6,   INV,   INV, 0x9566,   INV,   INV,0xe4e5, // 8498..849f
+	   INV,0xe4ee,   INV,   INV,    INV,   INV,   INV,   INV, // 84a0..84a7
+	   INV,   INV,   INV,   INV,    INV,0xe4d8,   INV,   INV, // 84a8..84af
+	   INV,   INV,0x8a97,   INV,    INV,   INV,   INV,   INV, // 84b0..84b7
+	0x8ff6,0xe4e3,   INV,0xe4e8, 0x9193,   INV,   INV,0xe4e4, // 84b8..84bf
+	   INV,0xe4eb,   INV,   INV, 0x927e,   INV,0xe4ec,   INV, // 84c0..84c7
+	   INV,0x9775,0xe4e1,0x8a57,    INV,0xe4e7,   INV,   INV, // 84c8..84cf
+	0xe4ea,0x96aa,   INV,   INV,    INV,   INV,0xe4ed,   INV, // 84d0..84d7
+	   INV,0xe4e6,0xe4e9,   INV,    INV,   INV,   INV,   INV, // 84d8..84df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 84e0..84e7
+	   INV,   INV,   INV,   INV, 0x9648,   INV,0x9840,   INV, // 84e8..84ef
+	   INV,   INV,   INV,   INV, 0xe4f1,   INV,   INV,   INV, // 84f0..84f7
+	   INV,   INV,   INV,   INV, 0xe4f8,   INV,   INV,0xe4f0, // 84f8..84ff
+    },
+    { //  66: 8500..85ff
+	0x8ec1,   INV,   INV,   INV,    INV,   INV,0xe4cf,   INV, // 8500..8507
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8508..850f
+	   INV,0x95cc,   INV,0x96a0, 0xe4f7,0xe4f6,   INV,0xe4f2, // 8510..8517
+	0xe4f3,   INV,0x8955,   INV,    INV,   INV,   INV,0xe4f5, // 8518..851f
+	   INV,0xe4ef,   INV,   INV,    INV,   INV,0x92d3,   INV, // 8520..8527
+	   INV,   INV,   INV,   INV, 0xe4f4,0x88fc,   INV,   INV, // 8528..852f
+	   INV,   INV,   INV,   INV,    INV,0x91a0,   INV,   INV, // 8530..8537
+	   INV,   INV,   INV,   INV,    INV,0x95c1,   INV,   INV, // 8538..853f
+	0xe4f9,0xe540,   INV,0x94d7,    INV,   INV,   INV,   INV, // 8540..8547
+	0xe4fc,0x8fd4,0x8ec7,0xe542,    INV,   INV,0x8bbc,   INV, // 8548..854f
+	   INV,   INV,   INV,   INV,    INV,0xe543,   INV,0x9599, // 8550..8557
+	0xe4fb,   INV,0xe4d4,   INV,    INV,   INV,   INV,   INV, // 8558..855f
+	   INV,   INV,   INV,0xe4fa,    INV,   INV,   INV,   INV, // 8560..8567
+	0x986e,0x93a0,0x9593,   INV,    INV,0xe54a,   INV,   INV, // 8568..856f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe550, // 8570..8577
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe551,   INV, // 8578..857f
+	0xe544,   INV,   INV,   INV, 0x9496,   INV,   INV,0xe54e, // 8580..8587
+	0xe546,   INV,0xe548,   INV,    INV,   INV,   INV,   INV, // 8588..858f
+	0xe552,0xe547,   INV,   INV, 0xe54b,   INV,   INV,0x8992, // 8590..8597
+	   INV,0x93e3,   INV,0xe54c, 0xe54f,   INV,   INV,   INV, // 8598..859f
+	   INV,   INV,   INV,   INV, 0xe545,   INV,0x9145,   INV, // 85a0..85a7
+	0xe549,0x8e46,0x9064,0x8c4f, 0x96f2,   INV,0x96f7,0x8f92, // 85a8..85af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 85b0..85b7
+	   INV,0xe556,0xe554,   INV,    INV,   INV,   INV,   INV, // 85b8..85bf
+	   INV,0x986d,   INV,   INV,    INV,   INV,   INV,   INV, // 85c0..85c7
+	   INV,0xe553,   INV,   INV,    INV,0x9795,   INV,0xe555, // 85c8..85cf
+	0xe557,   INV,   INV,   INV,    INV,0xe558,   INV,   INV, // 85d0..85d7
+	   INV,   INV,   INV,   INV, 0xe55b,0xe559,   INV,   INV, // 85d8..85df
+	   INV,   INV,   INV,   INV, 0x93a1,0xe55a,   INV,   INV, // 85e0..85e7
+	   INV,0x94cb,0xe54d,   INV,    INV,   INV,   INV,   INV, // 85e8..85ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x8f93, // 85f0..85f7
+	   INV,0xe55c,0xe561,0x9194,    INV,   INV,0xe560,   INV, // 85f8..85ff
+    },
+    { //  67: 8600..86ff
+	   INV,   INV,0xe541,   INV,    INV,   INV,0xe562,0x9168, // 8600..8607
+	   INV,   INV,0xe55d,0xe55f,    INV,   INV,   INV,   INV, // 8608..860f
+	   INV,   INV,   INV,0xe55e,    INV,   INV,0x9f50,0x9f41, // 8610..8617
+	   INV,   INV,0xe564,   INV,    INV,   INV,   INV,   INV, // 8618..861f
+	   INV,   INV,0xe563,   INV,    INV,   INV,   INV,   INV, // 8620..8627
+	   INV,   INV,   INV,   INV,    INV,0x9796,   INV,0xe1ba, // 8628..862f
+	0xe565,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8630..8637
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe566, // 8638..863f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8640..8647
+	   INV,   INV,   INV,   INV,    INV,0xe567,0x8cd5,   INV, // 8648..864f
+	0x8b73,   INV,   INV,   INV, 0xe569,0x997c,   INV,   INV, // 8650..8657
+	   INV,   INV,0x8b95,   INV, 0x97b8,   INV,0x8bf1,0xe56a, // 8658..865f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe56b, // 8660..8667
+	   INV,   INV,   INV,0x928e,    INV,   INV,   INV,   INV, // 8668..866f
+	   INV,0xe56c,   INV,   INV,    INV,   INV,   INV,   INV, // 8670..8677
+	   INV,0x93f8,   INV,0x88b8,    INV,   INV,   INV,   INV, // 8678..867f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8680..8687
+	   INV,   INV,0x89e1,0xe571, 0xe572,   INV,   INV,   INV, // 8688..868f
+	   INV,   INV,   INV,0xe56d,    INV,0x8e5c,   INV,   INV, // 8690..8697
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8698..869f
+	   INV,   INV,   INV,0xe56e, 0x9461,   INV,   INV,   INV, // 86a0..86a7
+	   INV,0xe56f,0xe570,0xe57a,    INV,   INV,   INV,0xe574, // 86a8..86af
+	0xe577,   INV,   INV,   INV,    INV,   INV,0xe573,   INV, // 86b0..86b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 86b8..86bf
+	   INV,   INV,   INV,   INV, 0xe575,   INV,0xe576,0x8ed6, // 86c0..86c7
+	   INV,0xe578,   INV,0x9260,    INV,0x8c75,0x8a61,   INV, // 86c8..86cf
+	   INV,   INV,   INV,   INV, 0xe57b,   INV,   INV,   INV, // 86d0..86d7
+	   INV,0x8a5e,   INV,0xe581,    INV,   INV,0xe57c,0xe580, // 86d8..86df
+	   INV,   INV,   INV,   INV, 0x94b8,   INV,   INV,   INV, // 86e0..86e7
+	   INV,0xe57d,   INV,   INV, 0xe57e,0x9567,0x94d8,0xe582, // 86e8..86ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 86f0..86f7
+	0x91fb,0xe58c,   INV,0xe588,    INV,   INV,0x89e9,   INV, // 86f8..86ff
+    },
+    { //  68: 8700..87ff
+	0xe586,   INV,0x9649,0xe587,    INV,   INV,0xe584,   INV, // 8700..8707
+	0xe585,0xe58a,0xe58d,   INV,    INV,0xe58b,   INV,   INV, // 8708..870f
+	   INV,0xe589,0xe583,   INV,    INV,   INV,   INV,   INV, // 8710..8717
+	0x9277,   INV,0xe594,   INV, 0x96a8,   INV,   INV,   INV, // 8718..871f
+	   INV,   INV,   INV,   INV,    INV,0xe592,   INV,   INV, // 8720..8727
+	   INV,0xe593,   INV,   INV,    INV,   INV,   INV,   INV, // 8728..872f
+	   INV,   INV,   INV,   INV, 0xe58e,   INV,   INV,0xe590, // 8730..8737
+	   INV,   INV,   INV,0xe591,    INV,   INV,   INV,0xe58f, // 8738..873f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8740..8747
+	   INV,0x90e4,   INV,0x9858, 0xe598,   INV,0xe599,   INV, // 8748..874f
+	   INV,   INV,   INV,0xe59f,    INV,0x9049,   INV,0xe59b, // 8750..8757
+	   INV,0xe59e,   INV,   INV,    INV,   INV,   INV,0xe596, // 8758..875f
+	0xe595,   INV,   INV,0xe5a0,    INV,   INV,0x89da,   INV, // 8760..8767
+	0xe59c,   INV,0xe5a1,   INV,    INV,   INV,0xe59d,   INV, // 8768..876f
+	   INV,   INV,   INV,   INV, 0xe59a,   INV,0x92b1,   INV, // 8770..8777
+	0xe597,   INV,   INV,   INV,    INV,   INV,   INV,0x9488, // 8778..877f
+	   INV,   INV,0xe5a5,   INV,    INV,   INV,   INV,   INV, // 8780..8787
+	   INV,   INV,   INV,   INV,    INV,0x975a,   INV,   INV, // 8788..878f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8790..8797
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe5a4, // 8798..879f
+	   INV,   INV,0xe5a3,   INV,    INV,   INV,   INV,   INV, // 87a0..87a7
+	   INV,   INV,   INV,0xe5ac,    INV,   INV,   INV,0xe5a6, // 87a8..87af
+	   INV,   INV,   INV,0xe5ae,    INV,   INV,   INV,   INV, // 87b0..87b7
+	   INV,   INV,0x9786,0xe5b1,    INV,0xe5a8,   INV,   INV, // 87b8..87bf
+	0xe5a9,   INV,   INV,   INV, 0xe5ad,   INV,0xe5b0,0xe5af, // 87c0..87c7
+	   INV,   INV,   INV,0xe5a7,    INV,   INV,   INV,   INV, // 87c8..87cf
+	0xe5aa,   INV,0xe5bb,   INV,    INV,   INV,   INV,   INV, // 87d0..87d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 87d8..87df
+	0xe5b4,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 87e0..87e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe5b2, // 87e8..87ef
+	   INV,   INV,0xe5b3,   INV,    INV,   INV,0xe5b8,0xe5b9, // 87f0..87f7
+	   INV,0x8a49,   INV,0x8b61,    INV,   INV,0xe5b7,   INV, // 87f8..87ff
+    },
+    { //  69: 8800..88ff
+	   INV,   INV,   INV,   INV,    INV,0xe5a2,   INV,   INV, // 8800..8807
+	   INV,   INV,   INV,   INV,    INV,0xe5b6,0xe5ba,0xe5b5, // 8808..880f
+	   INV,0xe5bc,   INV,   INV,    INV,0xe5be,0xe5bd,   INV, // 8810..8817
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8818..881f
+	   INV,0xe5c0,0xe5bf,0xe579,    INV,   INV,   INV,0xe5c4, // 8820..8827
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8828..882f
+	   INV,0xe5c1,   INV,   INV,    INV,   INV,0xe5c2,   INV, // 8830..8837
+	   INV,0xe5c3,   INV,0xe5c5,    INV,   INV,   INV,   INV, // 8838..883f
+	0x8c8c,   INV,0xe5c7,   INV, 0xe5c6,   INV,0x8f4f,   INV, // 8840..8847
+	   INV,   INV,   INV,   INV, 0x8d73,0x9fa5,   INV,   INV, // 8848..884f
+	   INV,   INV,0xe5c8,0x8f70,    INV,   INV,   INV,0x8a58, // 8850..8857
+	   INV,0xe5c9,   INV,0x8971,    INV,0x8fd5,0xe5ca,   INV, // 8858..885f
+	   INV,0x8d74,0xe5cb,0x88df,    INV,   INV,   INV,   INV, // 8860..8867
+	0x955c,   INV,   INV,0xe5cc,    INV,   INV,   INV,   INV, // 8868..886f
+	0x908a,   INV,0xe5d3,   INV,    INV,0xe5d0,   INV,0x928f, // 8870..8877
+	   INV,   INV,   INV,   INV,    INV,0xe5d1,0xe5ce,0x8bdc, // 8878..887f
+	   INV,0xe5cd,0xe5d4,   INV,    INV,   INV,   INV,   INV, // 8880..8887
+	0x8c55,   INV,   INV,0x91dc,    INV,0xe5da,   INV,   INV, // 8888..888f
+	   INV,   INV,0xe5d6,   INV,    INV,   INV,0x91b3,0xe5d5, // 8890..8897
+	   INV,0xe5d8,   INV,   INV,    INV,   INV,0xe5cf,   INV, // 8898..889f
+	   INV,   INV,0xe5d9,   INV, 0xe5db,   INV,   INV,   INV, // 88a0..88a7
+	   INV,   INV,   INV,0x94ed,    INV,   INV,0xe5d7,   INV, // 88a8..88af
+	0xe5dc,0xe5de,   INV,   INV, 0x8cd1,0xe5d2,   INV,0x88bf, // 88b0..88b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe5dd, // 88b8..88bf
+	   INV,0x8dd9,0x97f4,0xe5df, 0xe5e0,0x9195,   INV,   INV, // 88c0..88c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x97a0, // 88c8..88cf
+	   INV,   INV,   INV,   INV, 0xe5e1,0x9754,   INV,   INV, // 88d0..88d7
+	0xe5e2,0xe5e3,   INV,   INV, 0x95e2,0xe5e4,   INV,0x8dbe, // 88d8..88df
+	   INV,0x97a1,   INV,   INV,    INV,   INV,   INV,   INV, // 88e0..88e7
+	0xe5e9,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 88e8..88ef
+	   INV,   INV,0xe5ea,0x8fd6, 0xe5e8,   INV,   INV,   INV, // 88f0..88f7
+	0x9787,0xe5e5,   INV,   INV, 0xe5e7,0x90bb,0x909e,   INV, // 88f8..88ff
+    },
+    { //  70: 8900..89ff
+	   INV,   INV,0xe5e6,   INV, 0xe5eb,   INV,   INV,0x95a1, // 8900..8907
+	   INV,   INV,0xe5ed,   INV, 0xe5ec,   INV,   INV,   INV, // 8908..890f
+	0x8a8c,   INV,0x964a,0xe5ee,    INV,   INV,   INV,   INV, // 8910..8917
+	   INV,   INV,   INV,   INV,    INV,0xe5fa,0xe5f0,   INV, // 8918..891f
+	   INV,   INV,   INV,   INV,    INV,0xe5f1,   INV,   INV, // 8920..8927
+	   INV,   INV,0xe5f2,0xe5f3,    INV,   INV,   INV,   INV, // 8928..892f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe5f7,   INV, // 8930..8937
+	0xe5f8,   INV,   INV,0xe5f6,    INV,   INV,   INV,   INV, // 8938..893f
+	   INV,0xe5f4,   INV,0xe5ef, 0xe5f5,   INV,   INV,   INV, // 8940..8947
+	   INV,   INV,   INV,   INV, 0xe5f9,0xe8b5,   INV,   INV, // 8948..894f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x89a6,   INV, // 8950..8957
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe5fc,0x8bdd, // 8958..895f
+	0xe5fb,   INV,   INV,   INV, 0xe641,   INV,0xe640,   INV, // 8960..8967
+	   INV,   INV,0xe643,   INV,    INV,0xe642,   INV,0xe644, // 8968..896f
+	   INV,   INV,0x8f50,   INV, 0xe645,   INV,   INV,0xe646, // 8970..8977
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe647,0x90bc, // 8978..897f
+	   INV,0x9776,   INV,0xe648,    INV,   INV,0x95a2,0x9465, // 8980..8987
+	0xe649,   INV,0xe64a,0x8ca9,    INV,   INV,   INV,0x8b4b, // 8988..898f
+	   INV,   INV,   INV,0xe64b,    INV,   INV,0x8e8b,0x9460, // 8990..8997
+	0xe64c,   INV,0x8a6f,   INV,    INV,   INV,   INV,   INV, // 8998..899f
+	   INV,0xe64d,   INV,   INV,    INV,   INV,0xe64f,0x9797, // 89a0..89a7
+	   INV,0xe64e,0x9065,   INV, 0xe650,   INV,   INV,0xe651, // 89a8..89af
+	   INV,   INV,0xe652,0x8acf,    INV,   INV,   INV,   INV, // 89b0..89b7
+	   INV,   INV,0xe653,   INV,    INV,0xe654,   INV,0xe655, // 89b8..89bf
+	0xe656,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 89c0..89c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 89c8..89cf
+	   INV,   INV,0x8a70,   INV,    INV,   INV,   INV,   INV, // 89d0..89d7
+	   INV,   INV,0xe657,   INV, 0xe658,0xe659,   INV,   INV, // 89d8..89df
+	   INV,   INV,   INV,0x89f0,    INV,   INV,0x9047,0xe65a, // 89e0..89e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 89e8..89ef
+	   INV,   INV,   INV,   INV, 0xe65b,   INV,   INV,   INV, // 89f0..89f7
+	0xe65c,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 89f8..89ff
+    },
+    { //  71: 8a00..8aff
+	0x8cbe,   INV,0x92f9,0xe65d,    INV,   INV,   INV,   INV, // 8a00..8a07
+	0x8c76,   INV,0x9075,   INV, 0xe660,   INV,0x93a2,   INV, // 8a08..8a0f
+	0xe65f,   INV,   INV,0x8c50,    INV,   INV,0xe65e,0x91f5, // 8a10..8a17
+	0x8b4c,   INV,   INV,0xe661,    INV,0xe662,   INV,0x8fd7, // 8a18..8a1f
+	   INV,   INV,   INV,0x8c8d,    INV,0xe663,   INV,   INV, // 8a20..8a27
+	   INV,   INV,0x964b,   INV,    INV,0x90dd,   INV,   INV, // 8a28..8a2f
+	   INV,0x8b96,   INV,0x96f3, 0x9169,   INV,0xe664,   INV, // 8a30..8a37
+	   INV,   INV,0x9066,0x9290, 0x8fd8,   INV,   INV,   INV, // 8a38..8a3f
+	   INV,0xe665,   INV,   INV,    INV,   INV,0xe668,   INV, // 8a40..8a47
+	0xe669,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8a48..8a4f
+	0x8dbc,0x91c0,0xe667,   INV, 0x8fd9,0x955d,   INV,   INV, // 8a50..8a57
+	   INV,   INV,   INV,0xe666,    INV,   INV,0x8e8c,   INV, // 8a58..8a5f
+	0x8972,   INV,0xe66d,0x8c77,    INV,   INV,0x8e8e,   INV, // 8a60..8a67
+	   INV,0x8e8d,   INV,0x986c, 0xe66c,0xe66b,0x9146,   INV, // 8a68..8a6f
+	0x8b6c,0x9862,0x8a59,0x8fda,    INV,   INV,   INV,   INV, // 8a70..8a77
+	   INV,   INV,   INV,   INV, 0xe66a,   INV,   INV,   INV, // 8a78..8a7f
+	   INV,   INV,0xe66f,   INV, 0xe670,0xe66e,   INV,0x8cd6, // 8a80..8a87
+	   INV,0x975f,   INV,   INV, 0x8e8f,0x9446,   INV,   INV, // 8a88..8a8f
+	   INV,0xe673,   INV,0x90be,    INV,0x9261,   INV,   INV, // 8a90..8a97
+	0x9755,   INV,0xe676,   INV,    INV,   INV,0x8cea,   INV, // 8a98..8a9f
+	0x90bd,0xe672,   INV,0xe677, 0x8ceb,0xe674,0xe675,   INV, // 8aa0..8aa7
+	0xe671,   INV,   INV,   INV, 0x90e0,0x93c7,   INV,   INV, // 8aa8..8aaf
+	0x924e,   INV,0x89db,   INV,    INV,   INV,   INV,   INV, // 8ab0..8ab7
+	   INV,0x94ee,   INV,   INV, 0x8b62,   INV,   INV,0x92b2, // 8ab8..8abf
+	   INV,   INV,0xe67a,   INV, 0xe678,   INV,   INV,0x926b, // 8ac0..8ac7
+	   INV,   INV,   INV,0x90bf, 0x8ad0,0xe679,   INV,0x907a, // 8ac8..8acf
+	   INV,   INV,0x97c8,   INV,    INV,   INV,0x985f,   INV, // 8ad0..8ad7
+	   INV,   INV,0xe67b,0xe687, 0x92b3,   INV,0xe686,   INV, // 8ad8..8adf
+	0xe683,0xe68b,0xe684,   INV, 0xe680,   INV,0x92fa,0xe67e, // 8ae0..8ae7
+	   INV,   INV,   INV,0xe67c,    INV,0x9740,0x8e90,   INV, // 8ae8..8aef
+	   INV,0xe681,   INV,0xe67d,    INV,   INV,   INV,0xe685, // 8af0..8af7
+	0x8f94,   INV,0x8cbf,   INV,    INV,   INV,0x91f8,   INV, // 8af8..8aff
+    },
+    { //  72: 8b00..8bff
+	0x9664,0x8979,0x88e0,   INV, 0x93a3,   INV,   INV,0xe689, // 8b00..8b07
+	   INV,   INV,   INV,   INV, 0xe688,   INV,0x93e4,   INV, // 8b08..8b0f
+	0xe68d,   INV,   INV,   INV, 0xe682,   INV,0xe68c,0xe68e, // 8b10..8b17
+	   INV,0x8caa,0xe68a,0x8d75,    INV,0x8ed3,   INV,   INV, // 8b18..8b1f
+	0xe68f,0x9777,   INV,   INV,    INV,   INV,0xe692,   INV, // 8b20..8b27
+	0xe695,   INV,   INV,0xe693, 0x9554,   INV,   INV,   INV, // 8b28..8b2f
+	   INV,   INV,   INV,0xe690,    INV,   INV,   INV,   INV, // 8b30..8b37
+	   INV,0x8bde,   INV,   INV,    INV,   INV,0xe694,   INV, // 8b38..8b3f
+	   INV,0xe696,   INV,   INV,    INV,   INV,   INV,   INV, // 8b40..8b47
+	   INV,0xe69a,   INV,   INV, 0xe697,   INV,0xe699,0xe698, // 8b48..8b4f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe69b,   INV, // 8b50..8b57
+	0x8eaf,   INV,0xe69d,0xe69c, 0x9588,   INV,   INV,0xe69f, // 8b58..8b5f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8c78,   INV, // 8b60..8b67
+	   INV,   INV,   INV,0xe69e, 0xe6a0,   INV,   INV,0xe6a1, // 8b68..8b6f
+	0x8b63,0xe3bf,0x8ff7,   INV, 0xe6a2,   INV,   INV,0x8cec, // 8b70..8b77
+	   INV,   INV,   INV,   INV,    INV,0xe6a3,   INV,   INV, // 8b78..8b7f
+	0xe6a4,   INV,   INV,0x8e5d,    INV,   INV,   INV,   INV, // 8b80..8b87
+	   INV,   INV,0x9dcc,   INV, 0xe6a5,   INV,0xe6a6,   INV, // 8b88..8b8f
+	0x8f51,   INV,0xe6a7,0xe6a8,    INV,   INV,0xe6a9,   INV, // 8b90..8b97
+	   INV,0xe6aa,0xe6ab,   INV,    INV,   INV,   INV,   INV, // 8b98..8b9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8ba0..8ba7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8ba8..8baf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bb0..8bb7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bb8..8bbf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bc0..8bc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bc8..8bcf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bd0..8bd7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bd8..8bdf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8be0..8be7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8be8..8bef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bf0..8bf7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8bf8..8bff
+    },
+    { //  73: 8c00..8cff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c00..8c07
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c08..8c0f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c10..8c17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c18..8c1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c20..8c27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c28..8c2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x924a, // 8c30..8c37
+	   INV,   INV,0xe6ac,   INV,    INV,   INV,   INV,0xe6ae, // 8c38..8c3f
+	   INV,0xe6ad,   INV,   INV,    INV,   INV,0x93a4,   INV, // 8c40..8c47
+	0xe6af,   INV,0x964c,   INV, 0xe6b0,   INV,0xe6b1,   INV, // 8c48..8c4f
+	0xe6b2,   INV,   INV,   INV,    INV,0xe6b3,   INV,   INV, // 8c50..8c57
+	   INV,   INV,0x93d8,   INV,    INV,   INV,   INV,   INV, // 8c58..8c5f
+	   INV,0x8fdb,0xe6b4,   INV,    INV,   INV,   INV,   INV, // 8c60..8c67
+	   INV,   INV,0x8d8b,0x98ac, 0xe6b5,   INV,   INV,   INV, // 8c68..8c6f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8c70..8c77
+	0xe6b6,0x955e,0xe6b7,   INV, 0xe6bf,   INV,   INV,   INV, // 8c78..8c7f
+	   INV,   INV,0xe6b8,   INV,    INV,0xe6ba,   INV,   INV, // 8c80..8c87
+	   INV,0xe6b9,0xe6bb,   INV, 0x9665,0xe6bc,0xe6bd,   INV, // 8c88..8c8f
+	   INV,   INV,   INV,   INV, 0xe6be,   INV,   INV,   INV, // 8c90..8c97
+	0xe6c0,   INV,   INV,   INV,    INV,0x8a4c,0x92e5,   INV, // 8c98..8c9f
+	0x9589,0x8de0,0x8d76,   INV,    INV,   INV,   INV,0x956e, // 8ca0..8ca7
+	0x89dd,0x94cc,0xe6c3,0x8ad1, 0x90d3,0xe6c2,0xe6c7,0x9299, // 8ca8..8caf
+	0x96e1,   INV,0xe6c5,0xe6c6, 0x8b4d,   INV,0xe6c8,0x9483, // 8cb0..8cb7
+	0x91dd,   INV,   INV,0x94ef, 0x935c,0xe6c4,   INV,0x9666, // 8cb8..8cbf
+	0x89ea,0xe6ca,0x9847,0x92c0, 0x9864,   INV,   INV,0x8e91, // 8cc0..8cc7
+	0xe6c9,   INV,0x91af,   INV,    INV,0xe6da,0x9147,   INV, // 8cc8..8ccf
+	   INV,0x93f6,   INV,0x956f,    INV,   INV,   INV,   INV, // 8cd0..8cd7
+	   INV,   INV,0xe6cd,0x8e5e, 0x8e92,   INV,0x8fdc,   INV, // 8cd8..8cdf
+	0x9485,   INV,0x8cab,0xe6cc, 0xe6cb,   INV,0x958a,   INV, // 8ce0..8ce7
+	   INV,   INV,0x8ebf,   INV,    INV,0x9371,   INV,   INV, // 8ce8..8cef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8cf0..8cf7
+	   INV,   INV,0xe6cf,0xe6d0, 0x8d77,0xe6ce,   INV,   INV, // 8cf8..8cff
+    },
+    { //  74: 8d00..8dff
+	   INV,   INV,   INV,   INV, 0xe6d1,0xe6d2,   INV,0xe6d4, // 8d00..8d07
+	0x91a1,   INV,0xe6d3,0x8ae4,    INV,0xe6d6,   INV,0xe6d5, // 8d08..8d0f
+	0xe6d7,   INV,   INV,0xe6d9, 0xe6db,   INV,0xe6dc,   INV, // 8d10..8d17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d18..8d1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d20..8d27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d28..8d2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d30..8d37
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d38..8d3f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d40..8d47
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d48..8d4f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d50..8d57
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d58..8d5f
+	   INV,   INV,   INV,   INV, 0x90d4,   INV,0x8ecd,0xe6dd, // 8d60..8d67
+	   INV,   INV,   INV,0x8a71,    INV,0xe6de,   INV,   INV, // 8d68..8d6f
+	0x9196,0xe6df,   INV,0xe6e0, 0x958b,   INV,   INV,0x8b4e, // 8d70..8d77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d78..8d7f
+	   INV,0xe6e1,   INV,   INV,    INV,0x92b4,   INV,   INV, // 8d80..8d87
+	   INV,   INV,0x897a,   INV,    INV,   INV,   INV,   INV, // 8d88..8d8f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8d90..8d97
+	   INV,0xe6e2,   INV,   INV,    INV,   INV,   INV,   INV, // 8d98..8d9f
+	   INV,   INV,   INV,0x8eef,    INV,   INV,   INV,   INV, // 8da0..8da7
+	0x9096,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8da8..8daf
+	   INV,   INV,   INV,0x91ab,    INV,   INV,   INV,   INV, // 8db0..8db7
+	   INV,   INV,0xe6e5,   INV,    INV,   INV,0xe6e4,   INV, // 8db8..8dbf
+	   INV,   INV,0xe6e3,   INV,    INV,   INV,   INV,   INV, // 8dc0..8dc7
+	   INV,   INV,   INV,0xe6eb, 0xe6e9,   INV,   INV,0xe6e6, // 8dc8..8dcf
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe6e8,   INV, // 8dd0..8dd7
+	   INV,   INV,0xe6e7,0xe6ea,    INV,0x8b97,   INV,0xe6ee, // 8dd8..8ddf
+	   INV,0x90d5,   INV,0xe6ef,    INV,   INV,   INV,   INV, // 8de0..8de7
+	0x8cd7,   INV,0xe6ec,0xe6ed,    INV,   INV,   INV,0x9848, // 8de8..8def
+	   INV,   INV,   INV,0x92b5,    INV,0x9148,   INV,   INV, // 8df0..8df7
+	   INV,   INV,   INV,   INV, 0xe6f0,   INV,   INV,0xe6f3, // 8df8..8dff
+    },
+    { //  75: 8e00..8eff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8e00..8e07
+	0xe6f1,0xe6f2,0x9778,   INV,    INV,   INV,   INV,0x93a5, // 8e08..8e0f
+	0xe6f6,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8e10..8e17
+	   INV,   INV,   INV,   INV,    INV,0xe6f4,0xe6f5,0xe6f7, // 8e18..8e1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8e20..8e27
+	   INV,   INV,0xe748,   INV,    INV,   INV,   INV,   INV, // 8e28..8e2f
+	0xe6fa,   INV,   INV,   INV, 0xe6fb,0xe6f9,   INV,   INV, // 8e30..8e37
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8e38..8e3f
+	   INV,   INV,0xe6f8,   INV, 0x92fb,   INV,   INV,0xe740, // 8e40..8e47
+	0xe744,0xe741,0xe6fc,   INV, 0xe742,   INV,   INV,   INV, // 8e48..8e4f
+	0xe743,   INV,   INV,   INV,    INV,0xe74a,   INV,   INV, // 8e50..8e57
+	   INV,0xe745,   INV,   INV,    INV,   INV,   INV,0x90d6, // 8e58..8e5f
+	0xe747,   INV,   INV,0xe749, 0xe746,   INV,   INV,   INV, // 8e60..8e67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8e68..8e6f
+	   INV,   INV,0xe74c,   INV, 0x8f52,   INV,0xe74b,   INV, // 8e70..8e77
+	   INV,   INV,   INV,   INV, 0xe74d,   INV,   INV,   INV, // 8e78..8e7f
+	   INV,0xe74e,   INV,   INV, 0xe751,0xe750,   INV,0xe74f, // 8e80..8e87
+	   INV,   INV,0xe753,0xe752,    INV,0x96f4,   INV,   INV, // 8e88..8e8f
+	   INV,0xe755,   INV,0xe754, 0xe756,   INV,   INV,   INV, // 8e90..8e97
+	   INV,0xe757,   INV,   INV,    INV,   INV,   INV,   INV, // 8e98..8e9f
+	   INV,0xe759,   INV,   INV,    INV,   INV,   INV,   INV, // 8ea0..8ea7
+	   INV,   INV,0xe758,0x9067, 0xe75a,   INV,   INV,0x8beb, // 8ea8..8eaf
+	0xe75b,0xe75d,   INV,   INV,    INV,   INV,   INV,   INV, // 8eb0..8eb7
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe75e,   INV, // 8eb8..8ebf
+	   INV,   INV,   INV,   INV,    INV,0xe75f,0xe75c,   INV, // 8ec0..8ec7
+	0xe760,   INV,0x8ed4,0xe761, 0x8b4f,0x8c52,   INV,   INV, // 8ec8..8ecf
+	   INV,   INV,0x8cac,   INV,    INV,   INV,   INV,   INV, // 8ed0..8ed7
+	   INV,   INV,   INV,0xe762,    INV,   INV,   INV,0x93ee, // 8ed8..8edf
+	   INV,   INV,0x935d,0xe763,    INV,   INV,   INV,   INV, // 8ee0..8ee7
+	   INV,   INV,   INV,0xe766,    INV,   INV,   INV,   INV, // 8ee8..8eef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8ef0..8ef7
+	0x8eb2,   INV,   INV,0xe765, 0xe764,0x8c79,0xe767,   INV, // 8ef8..8eff
+    },
+    { //  76: 8f00..8fff
+	   INV,   INV,   INV,0x8a72,    INV,0xe769,   INV,   INV, // 8f00..8f07
+	   INV,0x8dda,0xe768,   INV, 0xe771,   INV,   INV,   INV, // 8f08..8f0f
+	   INV,   INV,0xe76b,0xe76d, 0x95e3,0xe76a,   INV,   INV, // 8f10..8f17
+	   INV,0xe76c,   INV,0xe770, 0xe76e,0x8b50,   INV,0xe76f, // 8f18..8f1f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe772,   INV, // 8f20..8f27
+	   INV,0x9479,0x97d6,   INV,    INV,   INV,   INV,0x8f53, // 8f28..8f2f
+	   INV,   INV,   INV,0xe773,    INV,   INV,   INV,   INV, // 8f30..8f37
+	0x9741,0xe775,   INV,0xe774,    INV,   INV,0xe778,0x9760, // 8f38..8f3f
+	   INV,   INV,0xe777,   INV, 0x8a8d,0xe776,0xe77b,   INV, // 8f40..8f47
+	   INV,0xe77a,   INV,   INV, 0xe779,0x9351,0xe77c,   INV, // 8f48..8f4f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe77d, // 8f50..8f57
+	   INV,   INV,   INV,   INV, 0xe77e,   INV,   INV,0x8d8c, // 8f58..8f5f
+	   INV,0x8c44,0xe780,0xe781, 0xe782,   INV,   INV,   INV, // 8f60..8f67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8f68..8f6f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8f70..8f77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8f78..8f7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8f80..8f87
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8f88..8f8f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 8f90..8f97
+	   INV,   INV,   INV,0x9068, 0xe783,   INV,0x8eab,0xe784, // 8f98..8f9f
+	   INV,   INV,   INV,0xe785,    INV,   INV,   INV,0x999f, // 8fa0..8fa7
+	0x999e,   INV,   INV,   INV,    INV,0xe786,0xe390,0xe787, // 8fa8..8faf
+	0x9243,0x904a,0x945f,   INV,    INV,   INV,   INV,0xe788, // 8fb0..8fb7
+	   INV,   INV,0x95d3,0x92d2, 0x8d9e,   INV,   INV,0x9248, // 8fb8..8fbf
+	   INV,   INV,0x8949,   INV, 0x9698,0x9076,   INV,   INV, // 8fc0..8fc7
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8c7d,   INV, // 8fc8..8fcf
+	   INV,0x8bdf,   INV,   INV, 0x95d4,   INV,   INV,   INV, // 8fd0..8fd7
+	   INV,   INV,0xe789,   INV,    INV,   INV,   INV,   INV, // 8fd8..8fdf
+	   INV,   INV,0xe78b,   INV,    INV,0xe78a,0x89de,   INV, // 8fe0..8fe7
+	   INV,0x93f4,0xe78c,0x9497,    INV,0x9352,   INV,0xe78d, // 8fe8..8fef
+	0x8f71,   INV,   INV,   INV, 0xe78f,   INV,   INV,0x96c0, // 8ff0..8ff7
+	0xe79e,0xe791,0xe792,   INV,    INV,0x92c7,   INV,   INV, // 8ff8..8fff
+    },
+    { //  77: 9000..90ff
+	0x91de,0x9197,   INV,0x93a6,    INV,0xe790,0x8b74,   INV, // 9000..9007
+	   INV,   INV,   INV,0xe799,    INV,0xe796,0xe7a3,0x93a7, // 9008..900f
+	0x9280,0xe793,   INV,0x92fc, 0x9372,0xe794,0xe798,0x9080, // 9010..9017
+	   INV,0x9487,0x92ca,   INV,    INV,0x90c0,0xe797,0x91ac, // 9018..901f
+	0x91a2,0xe795,0x88a7,0x9841,    INV,   INV,   INV,0xe79a, // 9020..9027
+	   INV,   INV,   INV,   INV,    INV,   INV,0x91df,   INV, // 9028..902f
+	   INV,0x8f54,0x9069,   INV,    INV,0xe79c,0xe79b,   INV, // 9030..9037
+	0x88ed,0xe79d,   INV,   INV, 0x954e,   INV,0xe7a5,   INV, // 9038..903f
+	   INV,0x93d9,0x908b,   INV,    INV,0x9278,   INV,0x8bf6, // 9040..9047
+	   INV,0xe7a4,0x9756,0x895e,    INV,0x95d5,0x89df,0xe79f, // 9048..904f
+	0xe7a0,0xe7a1,0xe7a2,0x93b9, 0x9242,0x88e1,0xe7a6,   INV, // 9050..9057
+	0xe7a7,0xeaa1,   INV,   INV, 0x91bb,   INV,0xe7a8,   INV, // 9058..905f
+	0x8993,0x916b,   INV,0x8cad,    INV,0x9779,   INV,   INV, // 9060..9067
+	0xe7a9,0x934b,   INV,   INV,    INV,0x9198,0x8ed5,0xe7aa, // 9068..906f
+	   INV,   INV,0xe7ad,   INV,    INV,0x8f85,0xe7ab,0x914a, // 9070..9077
+	0x9149,   INV,0x88e2,   INV, 0x97c9,0xe7af,   INV,0x94f0, // 9078..907f
+	0xe7b1,0xe7b0,0xe7ae,0xe284, 0x8ad2,   INV,   INV,0xe78e, // 9080..9087
+	   INV,0xe7b3,0xe7b2,   INV,    INV,   INV,   INV,0xe7b4, // 9088..908f
+	   INV,0x9757,   INV,   INV,    INV,   INV,   INV,   INV, // 9090..9097
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9098..909f
+	   INV,   INV,   INV,0x93df,    INV,   INV,0x964d,   INV, // 90a0..90a7
+	0xe7b5,   INV,0x8ed7,   INV,    INV,   INV,   INV,0xe7b6, // 90a8..90af
+	   INV,0xe7b7,   INV,   INV,    INV,0xe7b8,   INV,   INV, // 90b0..90b7
+	0x9340,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 90b8..90bf
+	   INV,0x88e8,   INV,   INV,    INV,   INV,   INV,   INV, // 90c0..90c7
+	   INV,   INV,0x8d78,   INV,    INV,   INV,0x9859,   INV, // 90c8..90cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 90d0..90d7
+	   INV,   INV,   INV,0xe7bc,    INV,   INV,   INV,   INV, // 90d8..90df
+	   INV,0x8c53,0xe7b9,   INV, 0xe7ba,   INV,   INV,   INV, // 90e0..90e7
+	0x9594,   INV,   INV,   INV,    INV,0x8a73,   INV,   INV, // 90e8..90ef
+	   INV,   INV,   INV,   INV,    INV,0x9758,   INV,0x8bbd, // 90f0..90f7
+	   INV,   INV,   INV,   INV,    INV,0x9373,   INV,   INV, // 90f8..90ff
+    },
+    { //  78: 9100..91ff
+	   INV,   INV,0xe7bd,   INV,    INV,   INV,   INV,   INV, // 9100..9107
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9108..910f
+	   INV,   INV,0xe7be,   INV,    INV,   INV,   INV,   INV, // 9110..9117
+	   INV,0xe7bf,   INV,   INV,    INV,   INV,   INV,   INV, // 9118..911f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9120..9127
+	   INV,   INV,   INV,   INV,    INV,0x9341,   INV,   INV, // 9128..912f
+	0xe7c1,   INV,0xe7c0,   INV,    INV,   INV,   INV,   INV, // 9130..9137
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9138..913f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9140..9147
+	   INV,0x93d1,0xe7c2,0x8f55, 0x8ede,0x947a,0x9291,   INV, // 9148..914f
+	   INV,   INV,0x8ef0,   INV, 0x908c,   INV,0xe7c3,   INV, // 9150..9157
+	0xe7c4,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9158..915f
+	   INV,   INV,0x907c,0xe7c5,    INV,0xe7c6,   INV,   INV, // 9160..9167
+	   INV,0xe7c7,0x978f,   INV, 0x8f56,   INV,   INV,   INV, // 9168..916f
+	   INV,   INV,0xe7c9,0xe7c8,    INV,0x8d79,   INV,0x8d93, // 9170..9177
+	0x8e5f,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9178..917f
+	   INV,   INV,0xe7cc,   INV,    INV,   INV,   INV,0x8f86, // 9180..9187
+	   INV,0xe7cb,   INV,0xe7ca,    INV,0x91e7,   INV,   INV, // 9188..918f
+	0x8ced,   INV,0x90c1,   INV,    INV,   INV,   INV,0x94ae, // 9190..9197
+	   INV,   INV,   INV,   INV, 0x8f58,   INV,   INV,   INV, // 9198..919f
+	   INV,   INV,0xe7cd,   INV, 0x8fdd,   INV,   INV,   INV, // 91a0..91a7
+	   INV,   INV,0xe7d0,0xe7ce,    INV,   INV,   INV,0xe7cf, // 91a8..91af
+	   INV,   INV,   INV,   INV, 0xe7d2,0xe7d1,   INV,   INV, // 91b0..91b7
+	0x8ff8,   INV,0xe7d3,   INV,    INV,   INV,   INV,   INV, // 91b8..91bf
+	0xe7d4,0xe7d5,   INV,   INV,    INV,   INV,0x94ce,0x8dd1, // 91c0..91c7
+	0x8edf,0xe7d6,   INV,0xe7d7, 0x97a2,0x8f64,0x96ec,0x97ca, // 91c8..91cf
+	0xe7d8,0x8be0,   INV,   INV,    INV,   INV,0xe7d9,   INV, // 91d0..91d7
+	0x9342,   INV,   INV,0xe7dc, 0x8a98,0x906a,   INV,0xe7da, // 91d8..91df
+	   INV,0xe7db,   INV,0x92de,    INV,   INV,0x9674,0x8bfa, // 91e0..91e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 91e8..91ef
+	   INV,   INV,   INV,   INV,    INV,0xe7de,0xe7df,   INV, // 91f0..91f7
+	   INV,   INV,   INV,   INV, 0xe7dd,   INV,   INV,0xe7e1, // 91f8..91ff
+    },
+    { //  79: 9200..92ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9200..9207
+	   INV,   INV,   INV,   INV,    INV,0x93dd,0x8a62,   INV, // 9208..920f
+	   INV,0xe7e5,   INV,   INV, 0xe7e2,0xe7e4,   INV,   INV, // 9210..9217
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe7e0,   INV, // 9218..921f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9220..9227
+	   INV,0xe86e,   INV,   INV, 0xe7e3,   INV,   INV,   INV, // 9228..922f
+	   INV,   INV,   INV,   INV, 0x97e9,   INV,   INV,0x8cd8, // 9230..9237
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe7ed, // 9238..923f
+	   INV,   INV,   INV,   INV, 0x9353,0xe7e8,   INV,   INV, // 9240..9247
+	0xe7eb,0xe7e9,   INV,0xe7ee,    INV,   INV,   INV,   INV, // 9248..924f
+	0xe7ef,   INV,   INV,   INV,    INV,   INV,   INV,0xe7e7, // 9250..9257
+	   INV,   INV,0xe7f4,0x8994,    INV,   INV,0xe7e6,   INV, // 9258..925f
+	   INV,   INV,0x94ab,   INV, 0xe7ea,   INV,0x8fde,   INV, // 9260..9267
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9268..926f
+	   INV,0x8d7a,   INV,   INV,    INV,   INV,   INV,   INV, // 9270..9277
+	   INV,   INV,   INV,   INV,    INV,   INV,0x9667,   INV, // 9278..927f
+	0x8be2,   INV,   INV,0x8f65,    INV,0x93ba,   INV,   INV, // 9280..9287
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9288..928f
+	   INV,0x914c,   INV,0xe7f2,    INV,0xe7ec,0xe7f1,   INV, // 9290..9297
+	0x96c1,   INV,0x92b6,0xe7f3, 0xe7f0,   INV,   INV,   INV, // 9298..929f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 92a0..92a7
+	   INV,   INV,   INV,   INV,    INV,0x914b,   INV,   INV, // 92a8..92af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe7f7, // 92b0..92b7
+	   INV,0xe7f6,   INV,   INV,    INV,   INV,   INV,   INV, // 92b8..92bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 92c0..92c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe7f5, // 92c8..92cf
+	   INV,   INV,0x964e,   INV,    INV,   INV,   INV,   INV, // 92d0..92d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 92d8..92df
+	   INV,   INV,   INV,   INV, 0x8f9b,   INV,   INV,   INV, // 92e0..92e7
+	   INV,0xe7f8,0x95dd,   INV,    INV,0x8973,   INV,   INV, // 92e8..92ef
+	   INV,   INV,0x9565,0x9292,    INV,   INV,   INV,   INV, // 92f0..92f7
+	0x8b98,   INV,0xe7fa,   INV, 0x8d7c,   INV,   INV,   INV, // 92f8..92ff
+    },
+    { //  80: 9300..93ff
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8e4b,   INV, // 9300..9307
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe7f9, // 9308..930f
+	0x908d,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9310..9317
+	0x908e,0xe840,0xe842,   INV,    INV,   INV,   INV,   INV, // 9318..931f
+	0x8ff9,   INV,0xe841,0xe843,    INV,   INV,0x8bd1,   INV, // 9320..9327
+	0x9564,   INV,   INV,0x8ee0, 0x9842,   INV,0xe7fc,0x8df6, // 9328..932f
+	   INV,   INV,0x985e,   INV,    INV,0xe845,   INV,   INV, // 9330..9337
+	   INV,   INV,0xe844,0xe846,    INV,   INV,   INV,   INV, // 9338..933f
+	   INV,   INV,   INV,   INV, 0xe7fb,   INV,   INV,   INV, // 9340..9347
+	   INV,   INV,   INV,0x93e7,    INV,0x9374,   INV,   INV, // 9348..934f
+	   INV,   INV,   INV,   INV, 0x92d5,   INV,0xe84b,   INV, // 9350..9357
+	   INV,   INV,   INV,0x9262, 0xe847,   INV,   INV,   INV, // 9358..935f
+	0xe848,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9360..9367
+	   INV,   INV,   INV,   INV, 0x8c4c,   INV,0xe84a,   INV, // 9368..936f
+	   INV,   INV,   INV,   INV,    INV,0x8cae,   INV,   INV, // 9370..9377
+	   INV,   INV,   INV,   INV, 0xe849,   INV,0x8fdf,   INV, // 9378..937f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9380..9387
+	   INV,   INV,   INV,   INV, 0x8a99,   INV,   INV,   INV, // 9388..938f
+	   INV,   INV,   INV,   INV, 0xe84f,   INV,0x8dbd,0x9199, // 9390..9397
+	   INV,   INV,0x92c8,   INV,    INV,   INV,   INV,   INV, // 9398..939f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x8a5a, // 93a0..93a7
+	   INV,   INV,   INV,   INV, 0xe84d,0xe84e,0x92c1,   INV, // 93a8..93af
+	0xe84c,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 93b0..93b7
+	   INV,0xe850,   INV,   INV,    INV,   INV,   INV,   INV, // 93b8..93bf
+	   INV,   INV,   INV,0xe856,    INV,   INV,   INV,   INV, // 93c0..93c7
+	0xe859,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 93c8..93cf
+	0xe858,0x934c,   INV,   INV,    INV,   INV,0xe851,0xe852, // 93d0..93d7
+	0xe855,   INV,   INV,   INV,    INV,0xe857,   INV,   INV, // 93d8..93df
+	   INV,0x8bbe,   INV,   INV, 0xe85a,0xe854,   INV,   INV, // 93e0..93e7
+	0xe853,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 93e8..93ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 93f0..93f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 93f8..93ff
+    },
+    { //  81: 9400..94ff
+	   INV,   INV,   INV,0xe85e,    INV,   INV,   INV,0xe85f, // 9400..9407
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9408..940f
+	0xe860,   INV,   INV,0xe85d, 0xe85c,   INV,   INV,   INV, // 9410..9417
+	0x8fe0,0x93a8,0xe85b,   INV,    INV,   INV,   INV,   INV, // 9418..941f
+	   INV,0xe864,   INV,   INV,    INV,   INV,   INV,   INV, // 9420..9427
+	   INV,   INV,   INV,0xe862,    INV,   INV,   INV,   INV, // 9428..942f
+	   INV,   INV,   INV,   INV,    INV,0xe863,0xe861,   INV, // 9430..9437
+	0x91f6,   INV,0xe865,   INV,    INV,   INV,   INV,   INV, // 9438..943f
+	   INV,0xe866,   INV,   INV, 0xe868,   INV,   INV,   INV, // 9440..9447
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9448..944f
+	   INV,0x8ad3,0xe867,0x96f8,    INV,   INV,   INV,   INV, // 9450..9457
+	   INV,   INV,0xe873,0xe869,    INV,   INV,0xe86c,   INV, // 9458..945f
+	0xe86a,   INV,0xe86b,   INV,    INV,   INV,   INV,   INV, // 9460..9467
+	   INV,   INV,0xe86d,   INV,    INV,   INV,   INV,   INV, // 9468..946f
+	0xe86f,   INV,   INV,   INV,    INV,0xe870,   INV,0xe871, // 9470..9477
+	   INV,   INV,   INV,   INV, 0xe874,0xe872,0xe875,0xe877, // 9478..947f
+	   INV,0xe876,   INV,   INV,    INV,   INV,   INV,   INV, // 9480..9487
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9488..948f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9490..9497
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9498..949f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94a0..94a7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94a8..94af
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94b0..94b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94b8..94bf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94c0..94c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94c8..94cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94d0..94d7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94d8..94df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94e0..94e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94e8..94ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94f0..94f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 94f8..94ff
+    },
+    { //  82: 9500..95ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9500..9507
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9508..950f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9510..9517
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9518..951f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9520..9527
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9528..952f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9530..9537
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9538..953f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9540..9547
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9548..954f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9550..9557
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9558..955f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9560..9567
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9568..956f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x92b7, // 9570..9577
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9578..957f
+	0x96e5,   INV,0xe878,0x914d,    INV,   INV,   INV,0xe879, // 9580..9587
+	   INV,0x95c2,0xe87a,0x8a4a,    INV,   INV,   INV,0x895b, // 9588..958f
+	   INV,0x8ad5,   INV,0x8ad4, 0xe87b,   INV,0xe87c,   INV, // 9590..9597
+	0xe87d,0xe87e,   INV,   INV,    INV,   INV,   INV,   INV, // 9598..959f
+	0xe880,   INV,0x8ad6,0x8a74, 0x8d7d,0x94b4,   INV,0xe882, // 95a0..95a7
+	0xe881,   INV,   INV,   INV,    INV,0xe883,   INV,   INV, // 95a8..95af
+	   INV,   INV,0x897b,   INV,    INV,   INV,   INV,   INV, // 95b0..95b7
+	   INV,0xe886,   INV,0xe885, 0xe884,   INV,0xe887,   INV, // 95b8..95bf
+	   INV,   INV,   INV,0xe88a,    INV,   INV,   INV,0x88c5, // 95c0..95c7
+	   INV,   INV,0xe888,   INV, 0xe88c,0xe88b,   INV,   INV, // 95c8..95cf
+	   INV,   INV,   INV,   INV, 0xe88e,0xe88d,0xe88f,   INV, // 95d0..95d7
+	0x93ac,   INV,   INV,   INV, 0xe890,   INV,   INV,   INV, // 95d8..95df
+	   INV,0xe891,0xe893,   INV,    INV,0xe892,   INV,   INV, // 95e0..95e7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 95e8..95ef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 95f0..95f7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 95f8..95ff
+    },
+    { //  83: 9600..96ff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9600..9607
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9608..960f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9610..9617
+	   INV,   INV,   INV,   INV, 0x958c,   INV,   INV,   INV, // 9618..961f
+	   INV,0xe894,   INV,   INV,    INV,   INV,   INV,   INV, // 9620..9627
+	0xe895,   INV,0x8de3,   INV,    INV,   INV,0xe896,0xe897, // 9628..962f
+	   INV,   INV,0x9668,   INV,    INV,   INV,   INV,   INV, // 9630..9637
+	   INV,   INV,   INV,0x916a,    INV,   INV,   INV,0x88a2, // 9638..963f
+	0x91c9,   INV,0xe898,   INV, 0x958d,   INV,   INV,   INV, // 9640..9647
+	   INV,   INV,   INV,0xe89b, 0xe899,0x8d7e,   INV,0xe89a, // 9648..964f
+	0x8cc0,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9650..9657
+	   INV,   INV,   INV,0x95c3, 0xe89d,0xe89f,0xe89e,0xe8a0, // 9658..965f
+	   INV,   INV,0x8940,0x9077, 0x8f9c,0x8ad7,0xe8a1,   INV, // 9660..9667
+	   INV,   INV,0x9486,   INV, 0xe8a3,   INV,   INV,   INV, // 9668..966f
+	0x8941,   INV,0xe8a2,0x92c2,    INV,0x97cb,0x93a9,0xe89c, // 9670..9677
+	0x97a4,   INV,0x8caf,   INV,    INV,0x977a,   INV,   INV, // 9678..967f
+	   INV,   INV,   INV,   INV,    INV,0x8bf7,0x97b2,   INV, // 9680..9687
+	0x8c47,   INV,0x91e0,0xe440,    INV,0xe8a4,0x8a4b,0x908f, // 9688..968f
+	   INV,   INV,   INV,   INV, 0x8a75,0xe8a6,   INV,0xe8a7, // 9690..9697
+	0xe8a5,0x8c84,   INV,0x8ddb, 0x8fe1,   INV,   INV,   INV, // 9698..969f
+	0x8942,   INV,   INV,0x97d7,    INV,   INV,   INV,0xe8a9, // 96a0..96a7
+	0xe7ac,   INV,0xe8a8,   INV,    INV,   INV,   INV,   INV, // 96a8..96af
+	0xe8ac,0xe8aa,0xe8ab,   INV, 0xe8ad,   INV,0xe8ae,0x97ea, // 96b0..96b7
+	0xe8af,0xe8b0,   INV,0x90c7, 0x94b9,   INV,   INV,   INV, // 96b8..96bf
+	0x909d,0x8ae5,   INV,   INV, 0x9759,0x89eb,0x8f57,0x8cd9, // 96c0..96c7
+	   INV,0xe8b3,   INV,0xe8b2, 0x8e93,0xe8b4,0xe8b1,   INV, // 96c8..96cf
+	   INV,0x8e47,   INV,   INV,    INV,0xe8b8,0xe5ab,   INV, // 96d0..96d7
+	   INV,0x99d4,   INV,0x9097, 0xe8b6,   INV,   INV,   INV, // 96d8..96df
+	   INV,   INV,0x97a3,0x93ef,    INV,   INV,   INV,   INV, // 96e0..96e7
+	0x894a,   INV,0x90e1,0x8eb4,    INV,   INV,   INV,   INV, // 96e8..96ef
+	0x95b5,   INV,0x895f,   INV,    INV,   INV,0x97eb,0x978b, // 96f0..96f7
+	   INV,0xe8b9,   INV,0x9364,    INV,   INV,   INV,   INV, // 96f8..96ff
+    },
+    { //  84: 9700..97ff
+	0x8ef9,   INV,   INV,   INV, 0xe8ba,   INV,0xe8bb,0x906b, // 9700..9707
+	0xe8bc,   INV,0x97ec,   INV,    INV,0xe8b7,0xe8be,0xe8c0, // 9708..970f
+	   INV,0xe8bf,   INV,0xe8bd,    INV,   INV,0xe8c1,   INV, // 9710..9717
+	   INV,0xe8c2,   INV,   INV, 0x919a,   INV,0x89e0,   INV, // 9718..971f
+	   INV,   INV,   INV,   INV, 0xe8c3,   INV,   INV,0x96b6, // 9720..9727
+	   INV,   INV,0xe8c4,   INV,    INV,   INV,   INV,   INV, // 9728..972f
+	0xe8c5,   INV,0x9849,   INV,    INV,   INV,   INV,   INV, // 9730..9737
+	0x9e50,0xe8c6,   INV,   INV,    INV,0xe8c7,0xe8c8,   INV, // 9738..973f
+	   INV,   INV,0xe8cc,   INV, 0xe8c9,   INV,0xe8ca,   INV, // 9740..9747
+	0xe8cb,0xe8cd,   INV,   INV,    INV,   INV,   INV,   INV, // 9748..974f
+	   INV,   INV,0x90c2,   INV,    INV,   INV,0x96f5,   INV, // 9750..9757
+	   INV,0x90c3,   INV,   INV, 0xe8ce,   INV,0x94f1,   INV, // 9758..975f
+	0xe8cf,0xea72,0x96ca,   INV, 0xe8d0,   INV,0xe8d1,   INV, // 9760..9767
+	0xe8d2,0x8a76,   INV,0xe8d4,    INV,0x9078,   INV,   INV, // 9768..976f
+	   INV,0xe8d5,   INV,   INV, 0x8c43,   INV,   INV,   INV, // 9770..9777
+	   INV,0xe8d6,0xe8da,   INV, 0xe8d8,   INV,   INV,   INV, // 9778..977f
+	   INV,0xe8d9,   INV,   INV, 0x8a93,0xe8d7,0xe8db,   INV, // 9780..9787
+	   INV,   INV,   INV,0xe8dc,    INV,0x88c6,   INV,0xe8dd, // 9788..978f
+	0xe8de,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9790..9797
+	0x8fe2,   INV,   INV,   INV, 0xe8df,   INV,   INV,   INV, // 9798..979f
+	0x8b66,   INV,   INV,0xe8e2,    INV,   INV,0xe8e1,   INV, // 97a0..97a7
+	0xe8e0,   INV,   INV,0xe691,    INV,0x95da,   INV,   INV, // 97a8..97af
+	   INV,   INV,   INV,0xe8e3, 0xe8e4,   INV,   INV,   INV, // 97b0..97b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 97b8..97bf
+	   INV,   INV,   INV,0xe8e5,    INV,   INV,0xe8e6,   INV, // 97c0..97c7
+	0xe8e7,   INV,   INV,0xe8e8,    INV,   INV,   INV,   INV, // 97c8..97cf
+	   INV,   INV,   INV,0x8ad8,    INV,   INV,   INV,   INV, // 97d0..97d7
+	   INV,   INV,   INV,   INV, 0xe8e9,   INV,   INV,   INV, // 97d8..97df
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 97e0..97e7
+	   INV,   INV,   INV,   INV,    INV,0xe8ea,0x9442,   INV, // 97e8..97ef
+	   INV,   INV,0xe8ec,0x89b9,    INV,0xe8ef,0xe8ee,   INV, // 97f0..97f7
+	   INV,   INV,   INV,0x8943,    INV,   INV,   INV,0x8bbf, // 97f8..97ff
+    },
+    { //  85: 9800..98ff
+	   INV,0x95c5,0x92b8,0x8da0,    INV,0x8d80,0x8f87,   INV, // 9800..9807
+	0x907b,   INV,   INV,   INV, 0xe8f1,   INV,   INV,0xe8f0, // 9808..980f
+	0x9761,0x8ae6,0x94d0,0x93da,    INV,   INV,   INV,0x909c, // 9810..9817
+	0x97cc,   INV,0x8c7a,   INV,    INV,   INV,   INV,   INV, // 9818..981f
+	   INV,0xe8f4,   INV,   INV, 0xe8f3,   INV,   INV,   INV, // 9820..9827
+	   INV,   INV,   INV,   INV, 0x966a,0x93aa,   INV,   INV, // 9828..982f
+	   INV,   INV,   INV,   INV, 0x896f,   INV,   INV,0xe8f5, // 9830..9837
+	0xe8f2,   INV,   INV,0x9570, 0x978a,0xe8f6,   INV,   INV, // 9838..983f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe8f7,   INV, // 9840..9847
+	   INV,   INV,   INV,0xe8f9, 0x91e8,0x8a7a,0x8a7b,0xe8f8, // 9848..984f
+	   INV,   INV,   INV,   INV, 0x8ae7,0x8cb0,   INV,   INV, // 9850..9857
+	0x8ae8,   INV,   INV,0x935e,    INV,   INV,0x97de,   INV, // 9858..985f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x8cda, // 9860..9867
+	   INV,   INV,   INV,0xe8fa,    INV,   INV,   INV,0xe8fb, // 9868..986f
+	0xe8fc,0xe940,   INV,0xe942, 0xe941,   INV,   INV,   INV, // 9870..9877
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9878..987f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9880..9887
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9888..988f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9890..9897
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9898..989f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 98a0..98a7
+	0x9597,   INV,0xe943,   INV,    INV,   INV,   INV,0xe944, // 98a8..98af
+	   INV,0xe945,   INV,   INV,    INV,   INV,0xe946,   INV, // 98b0..98b7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 98b8..98bf
+	   INV,   INV,   INV,0xe948, 0xe947,   INV,0xe949,   INV, // 98c0..98c7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 98c8..98cf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 98d0..98d7
+	   INV,   INV,   INV,0x94f2, 0xe3ca,   INV,   INV,0x9048, // 98d8..98df
+	   INV,   INV,0x8b51,   INV,    INV,   INV,   INV,   INV, // 98e0..98e7
+	   INV,0xe94a,   INV,0xe94b,    INV,0x99aa,0x9f5a,0x94d1, // 98e8..98ef
+	   INV,   INV,0x88f9,   INV, 0x88b9,   INV,   INV,   INV, // 98f0..98f7
+	   INV,   INV,   INV,   INV, 0x8e94,0x964f,0x8ffc,   INV, // 98f8..98ff
+    },
+    { //  86: 9900..99ff
+	   INV,   INV,   INV,0xe94c,    INV,0x96dd,   INV,   INV, // 9900..9907
+	   INV,0xe94d,0x977b,   INV, 0x8961,   INV,   INV,   INV, // 9908..990f
+	0x8e60,   INV,0xe94e,0x89ec, 0xe94f,   INV,   INV,   INV, // 9910..9917
+	0xe950,   INV,   INV,   INV,    INV,0xe952,0xe953,   INV, // 9918..991f
+	0xe955,0xe951,   INV,   INV, 0xe954,   INV,   INV,   INV, // 9920..9927
+	0x8ad9,   INV,   INV,   INV, 0xe956,   INV,0xe957,   INV, // 9928..992f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9930..9937
+	   INV,   INV,   INV,   INV,    INV,0xe958,0xe959,   INV, // 9938..993f
+	   INV,   INV,0xe95a,   INV,    INV,0xe95c,   INV,   INV, // 9940..9947
+	   INV,0xe95b,   INV,0xe95e, 0xe961,   INV,   INV,   INV, // 9948..994f
+	0xe95d,0xe95f,0xe960,   INV,    INV,0xe962,   INV,0x8bc0, // 9950..9957
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9958..995f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9960..9967
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9968..996f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9970..9977
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9978..997f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9980..9987
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9988..998f
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8ef1,0xe963, // 9990..9997
+	0xe964,0x8d81,   INV,   INV,    INV,   INV,   INV,   INV, // 9998..999f
+	   INV,   INV,   INV,   INV,    INV,0xe965,   INV,   INV, // 99a0..99a7
+	0x8a5d,   INV,   INV,   INV, 0x946e,0xe966,0xe967,   INV, // 99a8..99af
+	   INV,   INV,   INV,0x9279, 0x93e9,   INV,   INV,   INV, // 99b0..99b7
+	   INV,   INV,   INV,   INV, 0xe968,   INV,   INV,   INV, // 99b8..99bf
+	   INV,0x949d,   INV,   INV, 0x91ca,0x8977,0x8bec,   INV, // 99c0..99c7
+	0x8bed,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 99c8..99cf
+	0x9293,0xe96d,0x8bee,   INV,    INV,0x89ed,   INV,   INV, // 99d0..99d7
+	0xe96c,   INV,   INV,0xe96a,    INV,0xe96b,   INV,0xe969, // 99d8..99df
+	   INV,   INV,0xe977,   INV,    INV,   INV,   INV,   INV, // 99e0..99e7
+	   INV,   INV,   INV,   INV,    INV,0xe96e,0xe96f,   INV, // 99e8..99ef
+	   INV,0xe970,0xe971,   INV,    INV,   INV,   INV,   INV, // 99f0..99f7
+	0xe973,   INV,   INV,0xe972,    INV,   INV,   INV,0x8f78, // 99f8..99ff
+    },
+    { //  87: 9a00..9aff
+	   INV,0xe974,   INV,   INV,    INV,0xe976,   INV,   INV, // 9a00..9a07
+	   INV,   INV,   INV,   INV,    INV,   INV,0x8b52,0xe975, // 9a08..9a0f
+	   INV,   INV,0x919b,0x8cb1,    INV,   INV,   INV,   INV, // 9a10..9a17
+	   INV,0xe978,   INV,   INV,    INV,   INV,   INV,   INV, // 9a18..9a1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a20..9a27
+	0x91cb,   INV,   INV,0xe979,    INV,   INV,   INV,   INV, // 9a28..9a2f
+	0x93ab,   INV,   INV,   INV,    INV,   INV,   INV,0xe97a, // 9a30..9a37
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe980,   INV, // 9a38..9a3f
+	0xe97d,   INV,0xe97c,0xe97e,    INV,0xe97b,   INV,   INV, // 9a40..9a47
+	   INV,   INV,   INV,   INV,    INV,0xe982,   INV,   INV, // 9a48..9a4f
+	   INV,   INV,   INV,   INV,    INV,0xe981,   INV,0xe984, // 9a50..9a57
+	   INV,   INV,0x8bc1,0xe983,    INV,   INV,   INV,0xe985, // 9a58..9a5f
+	   INV,   INV,0xe986,   INV, 0xe988,0xe987,   INV,   INV, // 9a60..9a67
+	   INV,0xe989,0xe98b,0xe98a,    INV,   INV,   INV,   INV, // 9a68..9a6f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a70..9a77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a78..9a7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a80..9a87
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a88..9a8f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a90..9a97
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9a98..9a9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9aa0..9aa7
+	0x8d9c,   INV,   INV,   INV,    INV,0xe98c,   INV,   INV, // 9aa8..9aaf
+	0xe98d,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9ab0..9ab7
+	0x8a5b,   INV,   INV,   INV, 0xe98e,   INV,   INV,   INV, // 9ab8..9abf
+	0xe98f,   INV,   INV,   INV, 0x9091,   INV,   INV,   INV, // 9ac0..9ac7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe990, // 9ac8..9acf
+	   INV,0xe991,   INV,0xe992, 0xe993,   INV,   INV,   INV, // 9ad0..9ad7
+	0x8d82,   INV,   INV,   INV,    INV,   INV,0xe994,0xe995, // 9ad8..9adf
+	   INV,   INV,0xe996,0xe997,    INV,   INV,0xe998,   INV, // 9ae0..9ae7
+	   INV,   INV,0x94af,0xe99a,    INV,0x9545,0xe99b,0xe999, // 9ae8..9aef
+	   INV,0xe99d,   INV,   INV, 0xe99c,   INV,   INV,0xe99e, // 9af0..9af7
+	   INV,   INV,   INV,0xe99f,    INV,   INV,   INV,   INV, // 9af8..9aff
+    },
+    { //  88: 9b00..9bff
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe9a0,   INV, // 9b00..9b07
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9b08..9b0f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9b10..9b17
+	0xe9a1,   INV,0xe9a2,   INV,    INV,   INV,   INV,0xe9a3, // 9b18..9b1f
+	   INV,   INV,0xe9a4,0xe9a5,    INV,0xe9a6,   INV,0xe9a7, // 9b20..9b27
+	0xe9a8,0xe9a9,0xe9aa,   INV,    INV,   INV,0xe9ab,0xe9ac, // 9b28..9b2f
+	   INV,0x9f54,0xe9ad,   INV,    INV,   INV,   INV,   INV, // 9b30..9b37
+	   INV,   INV,   INV,0xe2f6, 0x8b53,   INV,   INV,   INV, // 9b38..9b3f
+	   INV,0x8a40,0x8db0,0xe9af, 0xe9ae,0x96a3,   INV,   INV, // 9b40..9b47
+	   INV,   INV,   INV,   INV,    INV,0xe9b1,0xe9b2,0xe9b0, // 9b48..9b4f
+	   INV,0xe9b3,   INV,   INV, 0x9682,   INV,   INV,   INV, // 9b50..9b57
+	0xe9b4,   INV,0x8b9b,   INV,    INV,   INV,   INV,   INV, // 9b58..9b5f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9b60..9b67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0x9844, // 9b68..9b6f
+	   INV,   INV,   INV,   INV, 0xe9b5,   INV,   INV,   INV, // 9b70..9b77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9b78..9b7f
+	   INV,   INV,   INV,0xe9b7,    INV,   INV,   INV,   INV, // 9b80..9b87
+	   INV,   INV,   INV,   INV,    INV,   INV,0x88bc,   INV, // 9b88..9b8f
+	   INV,0xe9b8,0x95a9,0xe9b6,    INV,   INV,0xe9b9,0xe9ba, // 9b90..9b97
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xe9bb, // 9b98..9b9f
+	0xe9bc,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9ba0..9ba7
+	0xe9bd,   INV,0x968e,0x8e4c,    INV,0x8df8,0x914e,   INV, // 9ba8..9baf
+	   INV,   INV,   INV,   INV, 0xe9be,   INV,   INV,   INV, // 9bb0..9bb7
+	   INV,0xe9c1,   INV,   INV,    INV,   INV,   INV,   INV, // 9bb8..9bbf
+	0xe9bf,   INV,   INV,   INV,    INV,   INV,0xe9c2,   INV, // 9bc0..9bc7
+	   INV,0x8cef,0xe9c0,   INV,    INV,   INV,   INV,0xe9c3, // 9bc8..9bcf
+	   INV,0xe9c4,0xe9c5,   INV, 0xe9c9,   INV,0x8e49,   INV, // 9bd0..9bd7
+	   INV,   INV,   INV,0x91e2,    INV,   INV,   INV,   INV, // 9bd8..9bdf
+	   INV,0xe9ca,0xe9c7,0xe9c6, 0xe9c8,   INV,   INV,   INV, // 9be0..9be7
+	0x8c7e,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9be8..9bef
+	0xe9ce,0xe9cd,0xe9cc,   INV,    INV,0x88b1,   INV,   INV, // 9bf0..9bf7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9bf8..9bff
+    },
+    { //  89: 9c00..9cff
+	   INV,   INV,   INV,   INV, 0xe9d8,   INV,0xe9d4,   INV, // 9c00..9c07
+	0xe9d5,0xe9d1,0xe9d7,   INV, 0xe9d3,0x8a82,   INV,   INV, // 9c08..9c0f
+	0x986b,   INV,0xe9d6,0xe9d2, 0xe9d0,0xe9cf,   INV,   INV, // 9c10..9c17
+	   INV,   INV,   INV,0xe9da,    INV,   INV,   INV,   INV, // 9c18..9c1f
+	   INV,0xe9dd,   INV,   INV, 0xe9dc,0xe9db,   INV,   INV, // 9c20..9c27
+	   INV,   INV,   INV,   INV,    INV,0x9568,0xe9d9,0x88f1, // 9c28..9c2f
+	0xe9de,   INV,0xe9e0,   INV,    INV,   INV,   INV,   INV, // 9c30..9c37
+	   INV,0x8a8f,0xe9cb,0x8956,    INV,   INV,0xe9e2,   INV, // 9c38..9c3f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe9e1,0xe9df, // 9c40..9c47
+	0x924c,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c48..9c4f
+	   INV,   INV,0x9690,   INV,    INV,   INV,   INV,0x97d8, // 9c50..9c57
+	   INV,   INV,0xe9e3,   INV,    INV,   INV,   INV,   INV, // 9c58..9c5f
+	0xe9e4,   INV,   INV,   INV,    INV,   INV,   INV,0xe9e5, // 9c60..9c67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c68..9c6f
+	   INV,   INV,   INV,   INV,    INV,   INV,0xe9e6,   INV, // 9c70..9c77
+	0xe9e7,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c78..9c7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c80..9c87
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c88..9c8f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c90..9c97
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9c98..9c9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9ca0..9ca7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9ca8..9caf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cb0..9cb7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cb8..9cbf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cc0..9cc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cc8..9ccf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cd0..9cd7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cd8..9cdf
+	   INV,   INV,   INV,   INV,    INV,0x92b9,   INV,0xe9e8, // 9ce0..9ce7
+	   INV,0x94b5,   INV,0xe9ed, 0xe9e9,   INV,   INV,   INV, // 9ce8..9cef
+	0xe9ea,   INV,   INV,0x9650, 0x96c2,   INV,0x93ce,   INV, // 9cf0..9cf7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9cf8..9cff
+    },
+    { //  90: 9d00..9dff
+	   INV,   INV,   INV,0xe9ee,    INV,   INV,0xe9ef,0x93bc, // 9d00..9d07
+	0xe9ec,0xe9eb,   INV,   INV,    INV,   INV,0x89a8,   INV, // 9d08..9d0f
+	   INV,   INV,0xe9f7,   INV,    INV,0xe9f6,   INV,   INV, // 9d10..9d17
+	   INV,   INV,   INV,0x8995,    INV,   INV,   INV,0xe9f4, // 9d18..9d1f
+	   INV,   INV,   INV,0xe9f3,    INV,   INV,0xe9f1,   INV, // 9d20..9d27
+	0x8a9b,   INV,0xe9f0,0x8eb0, 0x89a7,   INV,   INV,   INV, // 9d28..9d2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9d30..9d37
+	   INV,   INV,   INV,0x8d83,    INV,   INV,0xe9fa,0xe9f9, // 9d38..9d3f
+	   INV,0xe9f8,   INV,   INV, 0xe9f5,   INV,0xe9fb,   INV, // 9d40..9d47
+	0xe9fc,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9d48..9d4f
+	0xea44,0xea43,   INV,   INV,    INV,   INV,   INV,   INV, // 9d50..9d57
+	   INV,0xea45,   INV,   INV, 0x894c,0xea40,0xea41,   INV, // 9d58..9d5f
+	0x8d94,0x96b7,   INV,   INV, 0xea42,   INV,   INV,   INV, // 9d60..9d67
+	   INV,   INV,   INV,   INV, 0x9651,   INV,   INV,0xea4a, // 9d68..9d6f
+	   INV,   INV,0xea46,   INV,    INV,   INV,   INV,   INV, // 9d70..9d77
+	   INV,   INV,0xea4b,   INV,    INV,   INV,   INV,   INV, // 9d78..9d7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xea48, // 9d80..9d87
+	   INV,0xea47,   INV,   INV,    INV,   INV,   INV,0x8c7b, // 9d88..9d8f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9d90..9d97
+	   INV,   INV,0xea4c,   INV,    INV,   INV,   INV,   INV, // 9d98..9d9f
+	   INV,   INV,   INV,   INV, 0xea4d,   INV,   INV,   INV, // 9da0..9da7
+	   INV,0xea4e,   INV,0xea49,    INV,   INV,   INV,0xe9f2, // 9da8..9daf
+	   INV,   INV,0xea4f,   INV, 0x92df,   INV,   INV,   INV, // 9db0..9db7
+	0xea53,   INV,0xea54,0xea52,    INV,   INV,   INV,   INV, // 9db8..9dbf
+	   INV,0xea51,0xea57,   INV, 0xea50,   INV,0xea55,   INV, // 9dc0..9dc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xea56, // 9dc8..9dcf
+	   INV,   INV,   INV,0xea59,    INV,   INV,   INV,   INV, // 9dd0..9dd7
+	   INV,0xea58,   INV,   INV,    INV,   INV,   INV,   INV, // 9dd8..9ddf
+	   INV,   INV,   INV,   INV,    INV,   INV,0xea5b,   INV, // 9de0..9de7
+	   INV,   INV,   INV,   INV,    INV,0xea5c,   INV,0xea5d, // 9de8..9def
+	   INV,   INV,0x9868,   INV,    INV,   INV,   INV,   INV, // 9df0..9df7
+	0xea5a,0x91e9,0x8deb,   INV,    INV,0xea5e,   INV,   INV, // 9df8..9dff
+    },
+    { //  91: 9e00..9eff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e00..9e07
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e08..9e0f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e10..9e17
+	   INV,   INV,0xea5f,0xea60,    INV,   INV,0xea61,   INV, // 9e18..9e1f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e20..9e27
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e28..9e2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e30..9e37
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e38..9e3f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e40..9e47
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e48..9e4f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e50..9e57
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e58..9e5f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e60..9e67
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9e68..9e6f
+	   INV,   INV,   INV,   INV,    INV,0xea62,   INV,   INV, // 9e70..9e77
+	0x8cb2,0xea63,   INV,   INV,    INV,0xea64,   INV,0x8ead, // 9e78..9e7f
+	   INV,0xea65,   INV,   INV,    INV,   INV,   INV,   INV, // 9e80..9e87
+	0xea66,   INV,   INV,0xea67, 0xea68,   INV,   INV,   INV, // 9e88..9e8f
+	   INV,0xea6b,0xea69,0x985b,    INV,0xea6a,   INV,0x97ed, // 9e90..9e97
+	   INV,   INV,   INV,   INV,    INV,0xea6c,   INV,0x97d9, // 9e98..9e9f
+	   INV,   INV,   INV,   INV,    INV,0xea6d,0x949e,   INV, // 9ea0..9ea7
+	   INV,0xea6e,0xea70,   INV,    INV,0xea71,   INV,   INV, // 9ea8..9eaf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9eb0..9eb7
+	0xea6f,0x8d8d,0x96cb,0x9683, 0x9bf5,   INV,0x9f80,0x969b, // 9eb8..9ebf
+	   INV,   INV,   INV,   INV, 0x89a9,   INV,   INV,   INV, // 9ec0..9ec7
+	   INV,   INV,   INV,   INV, 0xea73,0x8b6f,0xea74,0xea75, // 9ec8..9ecf
+	0xea76,   INV,0x8d95,   INV, 0xea77,   INV,   INV,   INV, // 9ed0..9ed7
+	0xe0d2,0x96d9,   INV,0x91e1, 0xea78,0xea7a,0xea79,   INV, // 9ed8..9edf
+	0xea7b,   INV,   INV,   INV,    INV,0xea7c,   INV,   INV, // 9ee0..9ee7
+	0xea7d,   INV,   INV,   INV,    INV,   INV,   INV,0xea7e, // 9ee8..9eef
+	   INV,   INV,   INV,   INV, 0xea80,   INV,0xea81,0xea82, // 9ef0..9ef7
+	   INV,0xea83,   INV,0xea84, 0xea85,0xea86,   INV,   INV, // 9ef8..9eff
+    },
+    { //  92: 9f00..9fff
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xea87, // 9f00..9f07
+	0xea88,   INV,   INV,   INV,    INV,   INV,0x9343,   INV, // 9f08..9f0f
+	   INV,   INV,   INV,0x8cdb,    INV,0xea8a,   INV,   INV, // 9f10..9f17
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9f18..9f1f
+	0x916c,0xea8b,   INV,   INV,    INV,   INV,   INV,   INV, // 9f20..9f27
+	   INV,   INV,   INV,   INV, 0xea8c,   INV,   INV,   INV, // 9f28..9f2f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9f30..9f37
+	   INV,   INV,   INV,0x9540,    INV,   INV,0xea8d,   INV, // 9f38..9f3f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9f40..9f47
+	   INV,   INV,0xea8e,0xe256,    INV,   INV,0xe6d8,0xe8eb, // 9f48..9f4f
+	   INV,   INV,0xea8f,   INV, 0xea90,   INV,   INV,   INV, // 9f50..9f57
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,0xea92, // 9f58..9f5f
+	0xea93,0xea94,0x97ee,0xea91,    INV,   INV,0xea95,0xea96, // 9f60..9f67
+	   INV,   INV,0xea98,   INV, 0xea97,   INV,   INV,   INV, // 9f68..9f6f
+	   INV,   INV,0xea9a,   INV,    INV,   INV,0xea9b,0xea99, // 9f70..9f77
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9f78..9f7f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9f80..9f87
+	   INV,   INV,   INV,   INV,    INV,0x97b4,   INV,   INV, // 9f88..9f8f
+	   INV,   INV,   INV,   INV,    INV,0xea9c,   INV,   INV, // 9f90..9f97
+	   INV,   INV,   INV,   INV, 0xea9d,0xe273,   INV,   INV, // 9f98..9f9f
+	0xea9e,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fa0..9fa7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fa8..9faf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fb0..9fb7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fb8..9fbf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fc0..9fc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fc8..9fcf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fd0..9fd7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fd8..9fdf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fe0..9fe7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9fe8..9fef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9ff0..9ff7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // 9ff8..9fff
+    },
+    { //  93: ff00..ffff
+	   INV,0x8149,   INV,0x8194, 0x8190,0x8193,0x8195,   INV, // ff00..ff07
+	0x8169,0x816a,0x8196,0x817b, 0x8143,   INV,0x8144,0x815e, // ff08..ff0f
+	0x824f,0x8250,0x8251,0x8252, 0x8253,0x8254,0x8255,0x8256, // ff10..ff17
+	0x8257,0x8258,0x8146,0x8147, 0x8183,0x8181,0x8184,0x8148, // ff18..ff1f
+	0x8197,0x8260,0x8261,0x8262, 0x8263,0x8264,0x8265,0x8266, // ff20..ff27
+	0x8267,0x8268,0x8269,0x826a, 0x826b,0x826c,0x826d,0x826e, // ff28..ff2f
+	0x826f,0x8270,0x8271,0x8272, 0x8273,0x8274,0x8275,0x8276, // ff30..ff37
+	0x8277,0x8278,0x8279,0x816d, 0x815f,0x816e,0x814f,0x8151, // ff38..ff3f
+	0x814d,0x8281,0x8282,0x8283, 0x8284,0x8285,0x8286,0x8287, // ff40..ff47
+	0x8288,0x8289,0x828a,0x828b, 0x828c,0x828d,0x828e,0x828f, // ff48..ff4f
+	0x8290,0x8291,0x8292,0x8293, 0x8294,0x8295,0x8296,0x8297, // ff50..ff57
+	0x8298,0x8299,0x829a,0x816f, 0x8162,0x8170,   INV,   INV, // ff58..ff5f
+	   INV,  0xa1,  0xa2,  0xa3,   0xa4,  0xa5,  0xa6,  0xa7, // ff60..ff67
+	  0xa8,  0xa9,  0xaa,  0xab,   0xac,  0xad,  0xae,  0xaf, // ff68..ff6f
+	  0xb0,  0xb1,  0xb2,  0xb3,   0xb4,  0xb5,  0xb6,  0xb7, // ff70..ff77
+	  0xb8,  0xb9,  0xba,  0xbb,   0xbc,  0xbd,  0xbe,  0xbf, // ff78..ff7f
+	  0xc0,  0xc1,  0xc2,  0xc3,   0xc4,  0xc5,  0xc6,  0xc7, // ff80..ff87
+	  0xc8,  0xc9,  0xca,  0xcb,   0xcc,  0xcd,  0xce,  0xcf, // ff88..ff8f
+	  0xd0,  0xd1,  0xd2,  0xd3,   0xd4,  0xd5,  0xd6,  0xd7, // ff90..ff97
+	  0xd8,  0xd9,  0xda,  0xdb,   0xdc,  0xdd,  0xde,  0xdf, // ff98..ff9f
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffa0..ffa7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffa8..ffaf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffb0..ffb7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffb8..ffbf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffc0..ffc7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffc8..ffcf
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffd0..ffd7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffd8..ffdf
+	   INV,   INV,   INV,0x8150,    INV,0x818f,   INV,   INV, // ffe0..ffe7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // ffe8..ffef
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // fff0..fff7
+	   INV,   INV,   INV,   INV,    INV,   INV,   INV,   INV, // fff8..ffff
+    },
+};
+
 //
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////			    Interface			///////////////
@@ -1284,74 +4482,140 @@ int ScanShiftJISCharE ( cucp * str, cvp end )
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static u16 *get_shift_jis_cache = 0;
-
 void SetupGetShiftJISCache()
 {
-    if (get_shift_jis_cache)
-	return;
+    // Nothing to do: The reverse tables are static now.
+    // The function is still available for compatibility.
+}
 
-    const uint total_size = SJIS_CACHE_SIZE * sizeof(*get_shift_jis_cache);
-    get_shift_jis_cache = MALLOC(total_size);
-    memset(get_shift_jis_cache,~0,total_size);
+//-----------------------------------------------------------------------------
 
-    const shift_jis_list_t *ptr;
-    for ( ptr = shift_jis_list; ptr->tab; ptr++ )
+int GetShiftJISChar ( uint code )
+{
+    if ( code >= SJIS_CACHE_SIZE )
+	return -1;
+
+    const uint page = shift_jis_rev_index[code>>8];
+    if (!page)
+	return -1;
+
+    const u16 res = shift_jis_rev_page[page-1][code&0xff];
+    return res == SJIS_INVALID_CODE ? -1 : res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static inline bool IsShiftJISAscii ( uchar ch )
+{
+    // true, if 'ch' is mapped to itself in both directions
+    return ch < 0x80 && ch != 0x5c && ch != 0x7e;
+}
+
+//-----------------------------------------------------------------------------
+
+uint ShiftJISToUTF8FastBuf
+(
+    // Append the UTF-8 encoded Shift-JIS string 'source' to 'fb'.
+    // Returns the number of appended bytes.
+
+    FastBuf_t	*fb,			// valid destination buffer
+    const void	*source,		// NULL or Shift-JIS string to convert
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		invalid			// >=0: unicode replacement of invalid chars
+					//  <0: skip invalid chars
+)
+{
+    DASSERT(fb);
+    const uint start = GetFastBufLen(fb);
+
+    if (!source)
+	source = "";
+    cucp str = source;
+    cucp end = str + ( source_len < 0 ? strlen(source) : source_len );
+
+    while ( str < end )
     {
-	u16 code = ptr->sect << 8 | ptr->from;
-	const u16 *p = ptr->tab;
-	const u16 *e = p + ptr->count;
-	for ( ; p < e; p++, code++ )
+	cucp run = str;
+	while ( run < end && IsShiftJISAscii(*run) )
+	    run++;
+	if ( run > str )
 	{
-	    DASSERT_MSG( IsValidShiftJIS(*p) || *p == SJIS_INVALID_CODE,
-			"table %02x[%zu], val=%04x\n", ptr->sect, p-ptr->tab, *p );
-	    if ( *p != SJIS_INVALID_CODE )
-		get_shift_jis_cache[*p] = code;
+	    AppendFastBuf(fb,str,run-str);
+	    str = run;
+	    if ( str == end )
+		break;
 	}
-    }
 
-    uint i;
-    for ( i = 0; i < 0x100; i++ )
-    {
-	const u16 code = shift_jis_single[i];
-	if (IsValidShiftJIS(code))
-	    get_shift_jis_cache[code] = i;
+	int code = ScanShiftJISCharE(&str,end);
+	if ( code < 0 )
+	{
+	    if ( invalid < 0 )
+		continue;
+	    code = invalid;
+	}
+	char *dest = GetSpaceFastBuf(fb,4);
+	fb->ptr = PrintUTF8Char(dest,code);
     }
 
-    PRINT("Shift-JIS: %s\n",GetShiftJISStatistics());
+    return GetFastBufLen(fb) - start;
 }
 
 //-----------------------------------------------------------------------------
 
-int GetShiftJISChar ( uint code )
-{
-    if (get_shift_jis_cache)
-    {
-	if ( code >= SJIS_CACHE_SIZE )
-	    return -1;
-	u16 res = get_shift_jis_cache[code];
-	return res == SJIS_INVALID_CODE ? -1 : res;
-    }
+uint UTF8ToShiftJISFastBuf
+(
+    // Append the Shift-JIS encoded UTF-8 string 'source' to 'fb'.
+    // Invalid UTF-8 sequences are scanned as ANSI characters.
+    // Returns the number of appended bytes.
 
-    if (!IsValidShiftJIS(code))
-	return -1;
+    FastBuf_t	*fb,			// valid destination buffer
+    ccp		source,			// NULL or UTF-8 string to convert
+    int		source_len,		// length of 'source'; if <0: use strlen(source)
+    int		invalid			// >=0: Shift-JIS replacement of invalid chars
+					//  <0: skip invalid chars
+)
+{
+    DASSERT(fb);
+    const uint start = GetFastBufLen(fb);
 
-    uint i;
-    for ( i = 0; i < 0x100; i++ )
-	if ( shift_jis_single[i] == code )
-	    return i;
+    if (!source)
+	source = "";
+    ccp str = source;
+    ccp end = str + ( source_len < 0 ? strlen(source) : source_len );
 
-    const shift_jis_list_t *ptr;
-    for ( ptr = shift_jis_list; ptr->tab; ptr++ )
+    while ( str < end )
     {
-	const u16 *p = ptr->tab;
-	const u16 *e = p + ptr->count;
-	for ( ; p < e; p++ )
-	    if ( *p == code )
-		return ptr->sect << 8 | (p-ptr->tab) + ptr->from;
+	ccp run = str;
+	while ( run < end && IsShiftJISAscii(*run) )
+	    run++;
+	if ( run > str )
+	{
+	    AppendFastBuf(fb,str,run-str);
+	    str = run;
+	    if ( str == end )
+		break;
+	}
+
+	int code = GetShiftJISChar(ScanUTF8AnsiCharE(&str,end));
+	if ( code < 0 )
+	{
+	    if ( invalid < 0 )
+		continue;
+	    code = invalid;
+	}
+
+	if ( code > 0xff )
+	{
+	    char *dest = GetSpaceFastBuf(fb,2);
+	    dest[0] = code >> 8;
+	    dest[1] = code;
+	}
+	else
+	    AppendCharFastBuf(fb,code);
     }
 
-    return -1;
+    return GetFastBufLen(fb) - start;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1359,17 +4623,14 @@ int GetShiftJISChar ( uint code )
 
 ccp GetShiftJISStatistics()
 {
-    SetupGetShiftJISCache();
-
     uint i, cache_count = 0,cache_max = 0;
     for ( i = 0; i < SJIS_CACHE_SIZE; i++ )
-	if ( get_shift_jis_cache[i] != SJIS_INVALID_CODE )
+	if ( GetShiftJISChar(i) >= 0 )
 	{
 	    cache_count++;
 	    cache_max = i;
 	}
 
-
     uint single_count = 0;
     for ( i = 0; i < 0x100; i++ )
 	if (IsValidShiftJIS(shift_jis_single[i]))
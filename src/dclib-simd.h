@@ -0,0 +1,56 @@
+
+/***************************************************************************
+ *                                                                         *
+ *                     _____     ____                                      *
+ *                    |  __ \   / __ \   _     _ _____                     *
+ *                    | |  \ \ / /  \_\ | |   | |  _  \                    *
+ *                    | |   \ \| |      | |   | | |_| |                    *
+ *                    | |   | || |      | |   | |  ___/                    *
+ *                    | |   / /| |   __ | |   | |  _  \                    *
+ *                    | |__/ / \ \__/ / | |___| | |_| |                    *
+ *                    |_____/   \____/  |_____|_|_____/                    *
+ *                                                                         *
+ *                       Wiimms source code library                        *
+ *                                                                         *
+ ***************************************************************************
+ *                                                                         *
+ *        Copyright (c) 2012-2022 by Dirk Clemens <wiimm@wiimm.de>         *
+ *                                                                         *
+ ***************************************************************************
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This library is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   See file gpl-2.0.txt or http://www.gnu.org/licenses/gpl-2.0.txt       *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef DCLIB_SIMD_H
+#define DCLIB_SIMD_H 1
+
+///////////////////////////////////////////////////////////////////////////////
+// Private header of the library, include it before "dclib/dclib-basics.h",
+// because <immintrin.h> needs the original malloc() and free().
+//
+// SSE2 is part of the x86_64 base ISA, so SSE2 kernels need no runtime
+// selection. Kernels for later extensions (POPCNT, SSSE3, AVX2, ...) are
+// compiled with a target attribute and selected at runtime.
+
+#undef HAVE_X86_SIMD
+#if defined(__x86_64__) && __GNUC__ >= 6 && !defined(__clang__)
+  #include <immintrin.h>
+  #define HAVE_X86_SIMD 1
+#else
+  #define HAVE_X86_SIMD 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // DCLIB_SIMD_H
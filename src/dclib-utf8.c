@@ -38,6 +38,7 @@
 #include <limits.h>
 #include <arpa/inet.h>
 
+#include "dclib-simd.h"
 #include "dclib/dclib-basics.h"
 #include "dclib/dclib-debug.h"
 #include "dclib/dclib-utf8.h"
@@ -88,6 +89,99 @@ const unsigned short TableUTF8Mode[256] =
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Skip blocks of 16 well-formed bytes. Data is well-formed if each lead
+// byte is followed by exactly the continuation bytes it needs and no other
+// continuation bytes exist. For well-formed data all scanners of this file
+// agree: each non-continuation byte starts a new character. Sequences may
+// cross block borders; the expected continuation bytes are carried over.
+
+static ccp SkipUTF8Blocks
+(
+    // Returns a pointer to the first character, that is not processed.
+    // The caller continues there with its scalar scanner.
+
+    ccp		ptr,		// valid pointer to a character start
+    ccp		end,		// end of data; NULL is allowed and stops at once
+    uint	*n_chars,	// add the number of skipped characters
+    uint	max_chars	// stop before skipping more characters than this
+)
+{
+    uint count = 0;
+
+ #if HAVE_X86_SIMD
+
+    const __m128i c0 = _mm_set1_epi8(0xc0), c80 = _mm_set1_epi8(0x80);
+    const __m128i e0 = _mm_set1_epi8(0xe0), f0  = _mm_set1_epi8(0xf0);
+    const __m128i f8 = _mm_set1_epi8(0xf8);
+
+    u32 carry = 0;
+    ccp last_lead = 0;
+
+    for ( ; ptr && ptr + 16 <= end; ptr += 16 )
+    {
+	const __m128i v = _mm_loadu_si128((const __m128i*)ptr);
+	if (!_mm_movemask_epi8(v))
+	{
+	    // pure ASCII
+	    if ( carry || count + 16 > max_chars )
+		break;
+	    count += 16;
+	    continue;
+	}
+
+	#undef  UTF8_MASK
+	#define UTF8_MASK(m,c) \
+		_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(v,m),c))
+
+	if (UTF8_MASK(f8,f8))
+	    break;
+	const u32 cont  = UTF8_MASK(c0,c80);
+	const u32 lead2 = UTF8_MASK(e0,c0);
+	const u32 lead3 = UTF8_MASK(f0,e0);
+	const u32 lead4 = UTF8_MASK(f8,f0);
+	#undef UTF8_MASK
+
+	const u32 lead = lead2 | lead3 | lead4;
+	const u32 expect = carry | lead << 1 | ( lead3 | lead4 ) << 2 | lead4 << 3;
+	if ( ( expect & 0xffff ) != cont )
+	    break;
+
+	const uint n = 16 - TableBitCount[cont&0xff] - TableBitCount[cont>>8];
+	if ( count + n > max_chars )
+	    break;
+	count += n;
+
+	carry = expect >> 16;
+	if (carry)
+	    last_lead = ptr + 31 - __builtin_clz(lead);
+    }
+
+    if (carry)
+    {
+	// the last character is not verified => undo it
+	ptr = last_lead;
+	count--;
+    }
+
+ #else
+
+    // pure ASCII only
+
+    for ( ; ptr && ptr + 16 <= end && count + 16 <= max_chars; ptr += 16 )
+    {
+	if ( ( le64(ptr) | le64(ptr+8) ) & 0x8080808080808080ull )
+	    break;
+	count += 16;
+    }
+
+ #endif
+
+    *n_chars += count;
+    return ptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 int GetUTF8CharLength ( u32 code )
 {
     // returns the length of the char 'code'
@@ -285,12 +379,11 @@ char * SkipUTF8Char ( ccp str, int skip )
     {
 	if ( skip < 0 )
 	    skip += ScanUTF8Length(str);
-	while ( skip-- > 0 )
+	if ( skip > 0 )
 	{
-	    ccp next = NextUTF8Char(str);
-	    if ( str == next )
-		break;
-	    str = next;
+	    // 'skip' characters need at most 4*skip bytes
+	    ccp end = str + strnlen(str,4*(size_t)skip);
+	    return SkipUTF8CharE(str,end,skip);
 	}
     }
     return (char*)str;
@@ -304,12 +397,25 @@ char * SkipUTF8CharE ( ccp str, ccp end, int skip )
     {
 	if ( skip < 0 )
 	    skip += ScanUTF8LengthE(str,end);
-	while ( skip-- > 0 )
+
+	ccp slow_end = str;
+	while ( skip > 0 )
 	{
+	    if ( str >= slow_end )
+	    {
+		uint n_chars = 0;
+		str = SkipUTF8Blocks(str,end,&n_chars,skip);
+		skip -= n_chars;
+		if (!skip)
+		    break;
+		slow_end = str + 16;
+	    }
+
 	    ccp next = NextUTF8CharE(str,end);
 	    if ( str == next )
 		break;
 	    str = next;
+	    skip--;
 	}
     }
     return (char*)str;
@@ -790,42 +896,8 @@ u32 ScanUTF8AnsiCharE ( ccp * p_str, ccp end )
 
 int ScanUTF8Length ( ccp str )
 {
-    int count = 0;
-    if (str)
-    {
-	ccp ptr = str;
-	for(;;)
-	{
-	    const char ch = *ptr++;
-	    if (!ch)
-		break;
-	    switch (CheckUTF8Mode(ch))
-	    {
-		case DC_UTF8_2CHAR:
-		    if ( CheckUTF8Mode(*ptr) == DC_UTF8_CONT_ANY )
-			ptr++;
-		    break;
-
-		case DC_UTF8_3CHAR:
-		    if (   CheckUTF8Mode(ptr[0]) == DC_UTF8_CONT_ANY
-			&& CheckUTF8Mode(ptr[1]) == DC_UTF8_CONT_ANY )
-			    ptr += 2;
-		    break;
-
-		case DC_UTF8_4CHAR:
-		    if (   CheckUTF8Mode(ptr[0]) == DC_UTF8_CONT_ANY
-			&& CheckUTF8Mode(ptr[1]) == DC_UTF8_CONT_ANY
-			&& CheckUTF8Mode(ptr[2]) == DC_UTF8_CONT_ANY )
-			    ptr += 3;
-		    break;
-
-		default:
-		    break;
-	    }
-	    count++;
-	}
-    }
-    return count;
+    // the scanner never looks behind a NULL byte
+    return str ? ScanUTF8LengthE(str,str+strlen(str)) : 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -838,9 +910,19 @@ int ScanUTF8LengthE ( ccp str, ccp end )
     int count = 0;
     if (str)
     {
-	ccp ptr = str;
+	ccp ptr = str, slow_end = str;
 	while ( ptr < end )
 	{
+	    if ( ptr >= slow_end )
+	    {
+		uint n_chars = 0;
+		ptr = SkipUTF8Blocks(ptr,end,&n_chars,UINT_MAX);
+		count += n_chars;
+		if ( ptr >= end )
+		    break;
+		slow_end = ptr + 16;
+	    }
+
 	    const char ch = *ptr++;
 	    switch (CheckUTF8Mode(ch))
 	    {
@@ -981,6 +1063,54 @@ int CalcUTF8PrintFW ( ccp str, ccp end, uint wanted_fw )
 		: bytecount;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+int ValidateUTF8 ( ccp str, ccp end )
+{
+    // Returns the number of characters, if 'str' contains only complete
+    // UTF-8 sequences as classified by TableUTF8Mode[], or -1 if not.
+    // If 'end' is NULL, 'str' is NULL terminated.
+
+    if (!str)
+	return 0;
+    if (!end)
+	end = str + strlen(str);
+
+    int count = 0;
+    const u8 *ptr = (u8*)str;
+    ccp slow_end = str;
+    while ( (ccp)ptr < end )
+    {
+	if ( (ccp)ptr >= slow_end )
+	{
+	    uint n_chars = 0;
+	    ptr = (u8*)SkipUTF8Blocks((ccp)ptr,end,&n_chars,UINT_MAX);
+	    count += n_chars;
+	    if ( (ccp)ptr >= end )
+		break;
+	    slow_end = (ccp)ptr + 16;
+	}
+
+	uint n_cont;
+	switch (CheckUTF8Mode(*ptr++))
+	{
+	    case DC_UTF8_1CHAR: n_cont = 0; break;
+	    case DC_UTF8_2CHAR: n_cont = 1; break;
+	    case DC_UTF8_3CHAR: n_cont = 2; break;
+	    case DC_UTF8_4CHAR: n_cont = 3; break;
+	    default: return -1;
+	}
+
+	if ( n_cont > end - (ccp)ptr )
+	    return -1;
+	while ( n_cont-- > 0 )
+	    if ( CheckUTF8Mode(*ptr++) != DC_UTF8_CONT_ANY )
+		return -1;
+	count++;
+    }
+    return count;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -2225,28 +2355,594 @@ const dcUnicodeTripel TableUnicodeDecomp[] =
 	{0,0,0}
 };
 
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////			unicode_decomp_*[]		///////////////
+///////////////////////////////////////////////////////////////////////////////
+// Two-level lookup table for DecomposeUnicode(), generated from
+// TableUnicodeDecomp[]. The high bits of the code select a page by
+// unicode_decomp_index[] (0: no page), the low byte the element of that
+// page. Elements are indices into TableUnicodeDecomp[] plus 1 (0: none).
+// => Regenerate both tables if TableUnicodeDecomp[] is changed.
+
+static const u8 unicode_decomp_index[0x1d2] =
+{
+	  1,  2,  3,  4,  5,  0,  6,  0,    0,  7,  8,  9, 10, 11,  0, 12, // 000..00f
+	 13,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0, 14,  0,  0, 15, 16, // 010..01f
+	  0, 17, 18,  0,  0,  0,  0,  0,    0,  0, 19,  0,  0,  0,  0,  0, // 020..02f
+	 20,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 030..03f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 040..04f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 050..05f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 060..06f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 070..07f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 080..08f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 090..09f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 0a0..0af
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 0b0..0bf
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 0c0..0cf
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 0d0..0df
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 0e0..0ef
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0, 21,  0,  0,  0,  0, // 0f0..0ff
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 100..10f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 110..11f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 120..12f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 130..13f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 140..14f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 150..15f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 160..16f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 170..17f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 180..18f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 190..19f
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 1a0..1af
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 1b0..1bf
+	  0,  0,  0,  0,  0,  0,  0,  0,    0,  0,  0,  0,  0,  0,  0,  0, // 1c0..1cf
+	  0, 22, // 1d0..1d1
+};
+
+//-----------------------------------------------------------------------------
+
+static const u16 unicode_decomp_page[22][0x100] =
+{
+    { //  1: 00000..000ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00000
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00010
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00020
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00030
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00040
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00050
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00060
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00070
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00080
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00090
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 000a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 000b0
+	   1,   2,   3,   4,   5,   6,   0,   7,    8,   9,  10,  11,  12,  13,  14,  15, // 000c0
+	   0,  16,  17,  18,  19,  20,  21,   0,    0,  22,  23,  24,  25,  26,   0,   0, // 000d0
+	  27,  28,  29,  30,  31,  32,   0,  33,   34,  35,  36,  37,  38,  39,  40,  41, // 000e0
+	   0,  42,  43,  44,  45,  46,  47,   0,    0,  48,  49,  50,  51,  52,   0,  53, // 000f0
+    },
+    { //  2: 00100..001ff
+	  54,  55,  56,  57,  58,  59,  60,  61,   62,  63,  64,  65,  66,  67,  68,  69, // 00100
+	   0,   0,  70,  71,  72,  73,  74,  75,   76,  77,  78,  79,  80,  81,  82,  83, // 00110
+	  84,  85,  86,  87,  88,  89,   0,   0,   90,  91,  92,  93,  94,  95,  96,  97, // 00120
+	  98,   0,   0,   0,  99, 100, 101, 102,    0, 103, 104, 105, 106, 107, 108,   0, // 00130
+	   0,   0,   0, 109, 110, 111, 112, 113,  114,   0,   0,   0, 115, 116, 117, 118, // 00140
+	 119, 120,   0,   0, 121, 122, 123, 124,  125, 126, 127, 128, 129, 130, 131, 132, // 00150
+	 133, 134, 135, 136, 137, 138,   0,   0,  139, 140, 141, 142, 143, 144, 145, 146, // 00160
+	 147, 148, 149, 150, 151, 152, 153, 154,  155, 156, 157, 158, 159, 160, 161,   0, // 00170
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00180
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00190
+	 162, 163,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0, 164, // 001a0
+	 165,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 001b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0, 166, 167, 168, // 001c0
+	 169, 170, 171, 172, 173, 174, 175, 176,  177, 178, 179, 180, 181,   0, 182, 183, // 001d0
+	 184, 185, 186, 187,   0,   0, 188, 189,  190, 191, 192, 193, 194, 195, 196, 197, // 001e0
+	 198,   0,   0,   0, 199, 200,   0,   0,  201, 202, 203, 204, 205, 206, 207, 208, // 001f0
+    },
+    { //  3: 00200..002ff
+	 209, 210, 211, 212, 213, 214, 215, 216,  217, 218, 219, 220, 221, 222, 223, 224, // 00200
+	 225, 226, 227, 228, 229, 230, 231, 232,  233, 234, 235, 236,   0,   0, 237, 238, // 00210
+	   0,   0,   0,   0,   0,   0, 239, 240,  241, 242, 243, 244, 245, 246, 247, 248, // 00220
+	 249, 250, 251, 252,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00230
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00240
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00250
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00260
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00270
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00280
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00290
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 002a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 002b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 002c0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 002d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 002e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 002f0
+    },
+    { //  4: 00300..003ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00300
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00310
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00320
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00330
+	   0,   0,   0,   0, 253,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00340
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00350
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00360
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00370
+	   0,   0,   0,   0,   0, 254, 255,   0,  256, 257, 258,   0, 259,   0, 260, 261, // 00380
+	 262,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00390
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 263, 264, 265, 266, 267, 268, // 003a0
+	 269,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 003b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 270, 271, 272, 273, 274,   0, // 003c0
+	   0,   0,   0, 275, 276,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 003d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 003e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 003f0
+    },
+    { //  5: 00400..004ff
+	 277, 278,   0, 279,   0,   0,   0, 280,    0,   0,   0,   0, 281, 282, 283,   0, // 00400
+	   0,   0,   0,   0,   0,   0,   0,   0,    0, 284,   0,   0,   0,   0,   0,   0, // 00410
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00420
+	   0,   0,   0,   0,   0,   0,   0,   0,    0, 285,   0,   0,   0,   0,   0,   0, // 00430
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00440
+	 286, 287,   0, 288,   0,   0,   0, 289,    0,   0,   0,   0, 290, 291, 292,   0, // 00450
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00460
+	   0,   0,   0,   0,   0,   0, 293, 294,    0,   0,   0,   0,   0,   0,   0,   0, // 00470
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00480
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00490
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 004a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 004b0
+	   0, 295, 296,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 004c0
+	 297, 298, 299, 300,   0,   0, 301, 302,    0,   0, 303, 304, 305, 306, 307, 308, // 004d0
+	   0,   0, 309, 310, 311, 312, 313, 314,    0,   0, 315, 316, 317, 318, 319, 320, // 004e0
+	 321, 322, 323, 324, 325, 326,   0,   0,  327, 328,   0,   0,   0,   0,   0,   0, // 004f0
+    },
+    { //  6: 00600..006ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00600
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00610
+	   0,   0, 329, 330, 331, 332, 333,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00620
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00630
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00640
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00650
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00660
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00670
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00680
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00690
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 006a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 006b0
+	 334,   0, 335,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 006c0
+	   0,   0,   0, 336,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 006d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 006e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 006f0
+    },
+    { //  7: 00900..009ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00900
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00910
+	   0,   0,   0,   0,   0,   0,   0,   0,    0, 337,   0,   0,   0,   0,   0,   0, // 00920
+	   0, 338,   0,   0, 339,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00930
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00940
+	   0,   0,   0,   0,   0,   0,   0,   0,  340, 341, 342, 343, 344, 345, 346, 347, // 00950
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00960
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00970
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00980
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00990
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 009a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 009b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0, 348, 349,   0,   0,   0, // 009c0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0, 350, 351,   0, 352, // 009d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 009e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 009f0
+    },
+    { //  8: 00a00..00aff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a20
+	   0,   0,   0, 353,   0,   0, 354,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a30
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0, 355, 356, 357,   0,   0, 358,   0, // 00a50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a80
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00a90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00aa0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ab0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ac0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ad0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ae0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00af0
+    },
+    { //  9: 00b00..00bff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b20
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b30
+	   0,   0,   0,   0,   0,   0,   0,   0,  359,   0,   0, 360, 361,   0,   0,   0, // 00b40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0, 362, 363,   0,   0, // 00b50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b80
+	   0,   0,   0,   0, 364,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00b90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ba0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00bb0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 365, 366, 367,   0,   0,   0, // 00bc0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00bd0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00be0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00bf0
+    },
+    { // 10: 00c00..00cff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c20
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c30
+	   0,   0,   0,   0,   0,   0,   0,   0,  368,   0,   0,   0,   0,   0,   0,   0, // 00c40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c80
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00c90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ca0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00cb0
+	 369,   0,   0,   0,   0,   0,   0, 370,  371,   0, 372, 373,   0,   0,   0,   0, // 00cc0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00cd0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ce0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00cf0
+    },
+    { // 11: 00d00..00dff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d20
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d30
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 374, 375, 376,   0,   0,   0, // 00d40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d80
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00d90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00da0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00db0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00dc0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 377,   0, 378, 379, 380,   0, // 00dd0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00de0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00df0
+    },
+    { // 12: 00f00..00fff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00f00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00f10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00f20
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00f30
+	   0,   0,   0, 381,   0,   0,   0,   0,    0,   0,   0,   0,   0, 382,   0,   0, // 00f40
+	   0,   0, 383,   0,   0,   0,   0, 384,    0,   0,   0,   0, 385,   0,   0,   0, // 00f50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0, 386,   0,   0,   0,   0,   0,   0, // 00f60
+	   0,   0,   0, 387,   0, 388, 389,   0,  390,   0,   0,   0,   0,   0,   0,   0, // 00f70
+	   0, 391,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00f80
+	   0,   0,   0, 392,   0,   0,   0,   0,    0,   0,   0,   0,   0, 393,   0,   0, // 00f90
+	   0,   0, 394,   0,   0,   0,   0, 395,    0,   0,   0,   0, 396,   0,   0,   0, // 00fa0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0, 397,   0,   0,   0,   0,   0,   0, // 00fb0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00fc0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00fd0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00fe0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 00ff0
+    },
+    { // 13: 01000..010ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01000
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01010
+	   0,   0,   0,   0,   0,   0, 398,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01020
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01030
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01040
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01050
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01060
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01070
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01080
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01090
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 010a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 010b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 010c0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 010d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 010e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 010f0
+    },
+    { // 14: 01b00..01bff
+	   0,   0,   0,   0,   0,   0, 399,   0,  400,   0, 401,   0, 402,   0, 403,   0, // 01b00
+	   0,   0, 404,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b20
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0, 405,   0, 406,   0,   0, // 01b30
+	 407, 408,   0, 409,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b80
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01b90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01ba0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01bb0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01bc0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01bd0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01be0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 01bf0
+    },
+    { // 15: 01e00..01eff
+	 410, 411, 412, 413, 414, 415, 416, 417,  418, 419, 420, 421, 422, 423, 424, 425, // 01e00
+	 426, 427, 428, 429, 430, 431, 432, 433,  434, 435, 436, 437, 438, 439, 440, 441, // 01e10
+	 442, 443, 444, 445, 446, 447, 448, 449,  450, 451, 452, 453, 454, 455, 456, 457, // 01e20
+	 458, 459, 460, 461, 462, 463, 464, 465,  466, 467, 468, 469, 470, 471, 472, 473, // 01e30
+	 474, 475, 476, 477, 478, 479, 480, 481,  482, 483, 484, 485, 486, 487, 488, 489, // 01e40
+	 490, 491, 492, 493, 494, 495, 496, 497,  498, 499, 500, 501, 502, 503, 504, 505, // 01e50
+	 506, 507, 508, 509, 510, 511, 512, 513,  514, 515, 516, 517, 518, 519, 520, 521, // 01e60
+	 522, 523, 524, 525, 526, 527, 528, 529,  530, 531, 532, 533, 534, 535, 536, 537, // 01e70
+	 538, 539, 540, 541, 542, 543, 544, 545,  546, 547, 548, 549, 550, 551, 552, 553, // 01e80
+	 554, 555, 556, 557, 558, 559, 560, 561,  562, 563,   0, 564,   0,   0,   0,   0, // 01e90
+	 565, 566, 567, 568, 569, 570, 571, 572,  573, 574, 575, 576, 577, 578, 579, 580, // 01ea0
+	 581, 582, 583, 584, 585, 586, 587, 588,  589, 590, 591, 592, 593, 594, 595, 596, // 01eb0
+	 597, 598, 599, 600, 601, 602, 603, 604,  605, 606, 607, 608, 609, 610, 611, 612, // 01ec0
+	 613, 614, 615, 616, 617, 618, 619, 620,  621, 622, 623, 624, 625, 626, 627, 628, // 01ed0
+	 629, 630, 631, 632, 633, 634, 635, 636,  637, 638, 639, 640, 641, 642, 643, 644, // 01ee0
+	 645, 646, 647, 648, 649, 650, 651, 652,  653, 654,   0,   0,   0,   0,   0,   0, // 01ef0
+    },
+    { // 16: 01f00..01fff
+	 655, 656, 657, 658, 659, 660, 661, 662,  663, 664, 665, 666, 667, 668, 669, 670, // 01f00
+	 671, 672, 673, 674, 675, 676,   0,   0,  677, 678, 679, 680, 681, 682,   0,   0, // 01f10
+	 683, 684, 685, 686, 687, 688, 689, 690,  691, 692, 693, 694, 695, 696, 697, 698, // 01f20
+	 699, 700, 701, 702, 703, 704, 705, 706,  707, 708, 709, 710, 711, 712, 713, 714, // 01f30
+	 715, 716, 717, 718, 719, 720,   0,   0,  721, 722, 723, 724, 725, 726,   0,   0, // 01f40
+	 727, 728, 729, 730, 731, 732, 733, 734,    0, 735,   0, 736,   0, 737,   0, 738, // 01f50
+	 739, 740, 741, 742, 743, 744, 745, 746,  747, 748, 749, 750, 751, 752, 753, 754, // 01f60
+	 755,   0, 756,   0, 757,   0, 758,   0,  759,   0, 760,   0, 761,   0,   0,   0, // 01f70
+	 762, 763, 764, 765, 766, 767, 768, 769,  770, 771, 772, 773, 774, 775, 776, 777, // 01f80
+	 778, 779, 780, 781, 782, 783, 784, 785,  786, 787, 788, 789, 790, 791, 792, 793, // 01f90
+	 794, 795, 796, 797, 798, 799, 800, 801,  802, 803, 804, 805, 806, 807, 808, 809, // 01fa0
+	 810, 811, 812, 813, 814,   0, 815, 816,  817, 818, 819,   0, 820,   0,   0,   0, // 01fb0
+	   0, 821, 822, 823, 824,   0, 825, 826,  827,   0, 828,   0, 829, 830, 831, 832, // 01fc0
+	 833, 834, 835,   0,   0,   0, 836, 837,  838, 839, 840,   0,   0, 841, 842, 843, // 01fd0
+	 844, 845, 846,   0, 847, 848, 849, 850,  851, 852, 853,   0, 854, 855,   0,   0, // 01fe0
+	   0,   0, 856, 857, 858,   0, 859, 860,  861,   0, 862,   0, 863,   0,   0,   0, // 01ff0
+    },
+    { // 17: 02100..021ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02100
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02110
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02120
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02130
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02140
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02150
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02160
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02170
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02180
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 864, 865,   0,   0,   0,   0, // 02190
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0, 866,   0, // 021a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 021b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0, 867, 868, 869, // 021c0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 021d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 021e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 021f0
+    },
+    { // 18: 02200..022ff
+	   0,   0,   0,   0, 870,   0,   0,   0,    0, 871,   0,   0, 872,   0,   0,   0, // 02200
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02210
+	   0,   0,   0,   0, 873,   0, 874,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02220
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02230
+	   0, 875,   0,   0, 876,   0,   0, 877,    0, 878,   0,   0,   0,   0,   0,   0, // 02240
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02250
+	 879,   0, 880,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0, 881, 882, 883, // 02260
+	 884, 885,   0,   0, 886, 887,   0,   0,  888, 889,   0,   0,   0,   0,   0,   0, // 02270
+	 890, 891,   0,   0, 892, 893,   0,   0,  894, 895,   0,   0,   0,   0,   0,   0, // 02280
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02290
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0, 896, 897, 898, 899, // 022a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 022b0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 022c0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 022d0
+	 900, 901, 902, 903,   0,   0,   0,   0,    0,   0, 904, 905, 906, 907,   0,   0, // 022e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 022f0
+    },
+    { // 19: 02a00..02aff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a20
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a30
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a80
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02a90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02aa0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02ab0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02ac0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0, 908,   0,   0,   0, // 02ad0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02ae0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 02af0
+    },
+    { // 20: 03000..030ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 03000
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 03010
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 03020
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 03030
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0, 909,   0, 910,   0, // 03040
+	 911,   0, 912,   0, 913,   0, 914,   0,  915,   0, 916,   0, 917,   0, 918,   0, // 03050
+	 919,   0, 920,   0,   0, 921,   0, 922,    0, 923,   0,   0,   0,   0,   0,   0, // 03060
+	 924, 925,   0, 926, 927,   0, 928, 929,    0, 930, 931,   0, 932, 933,   0,   0, // 03070
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 03080
+	   0,   0,   0,   0, 934,   0,   0,   0,    0,   0,   0,   0,   0,   0, 935,   0, // 03090
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0, 936,   0, 937,   0, // 030a0
+	 938,   0, 939,   0, 940,   0, 941,   0,  942,   0, 943,   0, 944,   0, 945,   0, // 030b0
+	 946,   0, 947,   0,   0, 948,   0, 949,    0, 950,   0,   0,   0,   0,   0,   0, // 030c0
+	 951, 952,   0, 953, 954,   0, 955, 956,    0, 957, 958,   0, 959, 960,   0,   0, // 030d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 030e0
+	   0,   0,   0,   0, 961,   0,   0, 962,  963, 964, 965,   0,   0,   0, 966,   0, // 030f0
+    },
+    { // 21: 0fb00..0fbff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fb00
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0, 967,   0, 968, // 0fb10
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0, 969, 970, 971, 972, 973, 974, // 0fb20
+	 975, 976, 977, 978, 979, 980, 981,   0,  982, 983, 984, 985, 986,   0, 987,   0, // 0fb30
+	 988, 989,   0, 990, 991,   0, 992, 993,  994, 995, 996, 997, 998, 999,1000,   0, // 0fb40
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fb50
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fb60
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fb70
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fb80
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fb90
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fba0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fbb0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fbc0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fbd0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fbe0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 0fbf0
+    },
+    { // 22: 1d100..1d1ff
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d100
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d110
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d120
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d130
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d140
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,1001,1002, // 1d150
+	1003,1004,1005,1006,1007,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d160
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d170
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d180
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d190
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d1a0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,1008,1009,1010,1011,1012, // 1d1b0
+	1013,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d1c0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d1d0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d1e0
+	   0,   0,   0,   0,   0,   0,   0,   0,    0,   0,   0,   0,   0,   0,   0,   0, // 1d1f0
+    },
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 
 const dcUnicodeTripel * DecomposeUnicode ( u32 code )
 {
-    int beg = 0;
-    int end = sizeof(TableUnicodeDecomp)/sizeof(*TableUnicodeDecomp) - 2;
-    while ( beg <= end )
+    if ( code >= sizeof(unicode_decomp_index) * 0x100 )
+	return 0;
+
+    const uint page = unicode_decomp_index[code>>8];
+    const uint idx = page ? unicode_decomp_page[page-1][code&0xff] : 0;
+    if (!idx)
     {
-	const int pos = (beg+end)/2;
-	const dcUnicodeTripel * ptr = TableUnicodeDecomp+pos;
-	if ( code < ptr->code1 )
-	    end = pos-1;
-	else if ( code > ptr->code1 )
-	    beg = pos+1;
-	else
+	noTRACE("DecomposeUnicode(%lx) -> NONE\n",code);
+	return 0;
+    }
+
+    const dcUnicodeTripel * ptr = TableUnicodeDecomp + idx - 1;
+    DASSERT( ptr->code1 == code );
+    noTRACE("DecomposeUnicode(%lx) -> %lx,%lx\n",code,ptr->code2,ptr->code3);
+    return ptr;
+}
+
+//
+///////////////////////////////////////////////////////////////////////////////
+///////////////		    decompose and fold strings		///////////////
+///////////////////////////////////////////////////////////////////////////////
+
+static inline bool IsUnicodeMark ( u32 code )
+{
+    // combining diacritical marks
+
+    return code >= 0x0300 && code < 0x0370
+	|| code >= 0x1ab0 && code < 0x1b00
+	|| code >= 0x1dc0 && code < 0x1e00
+	|| code >= 0x20d0 && code < 0x2100
+	|| code >= 0xfe20 && code < 0xfe30;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+u32 FoldUnicodeCase ( u32 code )
+{
+    if ( code < 0x80 )
+	return code >= 'A' && code <= 'Z' ? code + 0x20 : code;
+
+    if ( code < 0x100 )
+	return code >= 0xc0 && code <= 0xde && code != 0xd7 ? code + 0x20 : code;
+
+    if ( code < 0x180 )
+    {
+	// Latin Extended-A: pairs of upper and lower case
+	if ( code < 0x130 || code >= 0x132 && code < 0x138 || code >= 0x14a && code < 0x178 )
+	    return code | 1;
+	if ( code >= 0x139 && code < 0x149 || code >= 0x179 && code < 0x17f )
+	    return code + ( code & 1 );
+	return code == 0x178 ? 0xff : code == 0x17f ? 's' : code;
+    }
+
+    if ( code >= 0x391 && code < 0x3ac && code != 0x3a2 )
+	return code + 0x20;	// Greek
+
+    if ( code >= 0x400 && code < 0x430 )
+	return code + ( code < 0x410 ? 0x50 : 0x20 ); // Cyrillic
+
+    return code;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+uint DecomposeUTF8FastBuf
+(
+    // Append the decomposed and folded UTF-8 string 'source' to 'fb'.
+    // Invalid UTF-8 sequences are scanned as ANSI characters.
+    // Returns the number of appended bytes.
+
+    FastBuf_t		*fb,		// valid destination buffer
+    ccp			source,		// NULL or UTF-8 string to convert
+    int			source_len,	// length of 'source'; if <0: use strlen(source)
+    dcUnicodeFold	mode		// bit field of DC_UFOLD_*
+)
+{
+    DASSERT(fb);
+    const uint start = GetFastBufLen(fb);
+
+    if (!source)
+	source = "";
+    ccp str = source;
+    ccp end = str + ( source_len < 0 ? strlen(source) : source_len );
+
+    while ( str < end )
+    {
+	ccp run = str;
+	while ( run < end && !( *run & 0x80 ) )
+	    run++;
+	if ( run > str )
+	{
+	    if ( mode & DC_UFOLD_CASE )
+	    {
+		char *dest = GetSpaceFastBuf(fb,run-str);
+		while ( str < run )
+		{
+		    const char ch = *str++;
+		    *dest++ = ch >= 'A' && ch <= 'Z' ? ch + 0x20 : ch;
+		}
+	    }
+	    else
+	    {
+		AppendFastBuf(fb,str,run-str);
+		str = run;
+	    }
+	    if ( str == end )
+		break;
+	}
+
+	// decompose recursively, chars are stored in reverse order
+	u32 list[4];
+	uint n = 0;
+	u32 code = ScanUTF8AnsiCharE(&str,end);
+	if ( mode & DC_UFOLD_DECOMP )
+	{
+	    const dcUnicodeTripel *dt;
+	    while ( n < 3 && ( dt = DecomposeUnicode(code) ) != 0 )
+	    {
+		list[n++] = dt->code3;
+		code = dt->code2;
+	    }
+	}
+	list[n++] = code;
+
+	char *dest = GetSpaceFastBuf(fb,4*n);
+	while ( n-- > 0 )
 	{
-	    noTRACE("DecomposeUnicode(%lx) -> %lx,%lx\n",code,ptr->code2,ptr->code3);
-	    return ptr;
+	    code = list[n];
+	    if ( mode & DC_UFOLD_MARKS && IsUnicodeMark(code) )
+		continue;
+	    if ( mode & DC_UFOLD_CASE )
+		code = FoldUnicodeCase(code);
+	    dest = PrintUTF8Char(dest,code);
 	}
+	fb->ptr = dest;
     }
-    noTRACE("DecomposeUnicode(%lx) -> NONE\n",code);
-    return 0;
+
+    return GetFastBufLen(fb) - start;
 }
 
 //
@@ -352,6 +352,31 @@ static void AbortXParamLine ( XParam_t *p, XDump_t *xd, uint col )
 ///////////////			output functions		///////////////
 ///////////////////////////////////////////////////////////////////////////////
 
+static char * PrintXDumpHex ( char *num, const XDump_t *xd, u64 val )
+{
+    // same as sprintf(num,xd->num_format1,val) for hex formats
+
+    DASSERT(xd);
+    DASSERT(xd->num_hex_digits);
+
+    if (xd->mode_c)
+    {
+	*num++ = '0';
+	*num++ = 'x';
+	num = PrintHexNumber(num,val,xd->num_hex_digits,'0',LoDigits);
+	*num++ = ',';
+    }
+    else
+    {
+	*num++ = ' ';
+	num = PrintHexNumber(num,val,xd->num_hex_digits,
+				xd->mode_zero ? '0' : ' ', LoDigits );
+    }
+    return num;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 static int DumpInt32
 (
     // returns <0 on error, or number of dumped bytes
@@ -403,7 +428,10 @@ static int DumpInt32
 		      case 4:  val = xd->endian_func->rd32(p.d); p.d += 4; break;
 		      default: val = *p.d++; break;
 		    }
-		    num += sprintf(num,xd->num_format1,val);
+		    if (xd->num_hex_digits)
+			num = PrintXDumpHex(num,xd,val);
+		    else
+			num += sprintf(num,xd->num_format1,val);
 		    if ( xd->have_trigger && val == (u32)xd->trigger )
 			AbortXParamLine(&p,xd,col);
 		}
@@ -505,7 +533,10 @@ static int DumpInt64
 		      case 7:  val = xd->endian_func->rd56(p.d); p.d += 7; break;
 		      default: val = xd->endian_func->rd64(p.d); p.d += 8; break;
 		    }
-		    num += sprintf(num,xd->num_format1,val);
+		    if (xd->num_hex_digits)
+			num = PrintXDumpHex(num,xd,val);
+		    else
+			num += sprintf(num,xd->num_format1,val);
 		    if ( xd->have_trigger && val == (u32)xd->trigger )
 			AbortXParamLine(&p,xd,col);
 		}
@@ -900,6 +931,10 @@ void SetupXDump ( XDump_t *xd, XDumpCommand_t cmd )
     }
 
 
+    xd->num_hex_digits = xd->dump_func != DumpFloat && !xd->mode_dec
+			? 2 * xd->bytes_per_col : 0;
+
+
     //--- bytes per line
 
     uint min = xd->min_width ? xd->min_width : 16;
@@ -3479,7 +3479,6 @@ enumError CreateRawBMG
 	break;
 
      case BMG_ENC_SHIFT_JIS:
-	SetupGetShiftJISCache();
 	create_raw_shift_jis(&bc);
 	break;
 
@@ -674,12 +674,10 @@ uint TranslateDolOffsets
     if (!mm_off)
 	return 0;
 
-    uint mi, count = 0;
-    for ( mi = 0; mi < mm_off->used; mi++ )
-    {
-	const MemMapItem_t *src = mm_off->field[mi];
+    uint count = 0;
+    const MemMapItem_t *src;
+    for ( src = GetNextMemMap(mm_off,0); src; src = GetNextMemMap(mm_off,src) )
 	AddDolAddrByOffset(dol_head,mm,use_tie,src->off,src->size);
-    }
 
     return count;
 }
@@ -1034,10 +1032,10 @@ uint CompressDOL
 
     u8 *temp = MALLOC(total_data_size);
 
-    uint i, new_off = 0;
-    for ( i = 0; i < mm.used; i++ )
+    uint new_off = 0;
+    const MemMapItem_t *mi;
+    for ( mi = GetNextMemMap(&mm,0); mi; mi = GetNextMemMap(&mm,mi) )
     {
-	MemMapItem_t *mi = mm.field[i];
 	uint sect = strtoul(mi->info,0,10);
 	DASSERT( sect < DOL_N_SECTIONS );
 	const u32 off  = ntohl(dol->sect_off[sect]);